@@ -0,0 +1,178 @@
+/* linbox/algorithms/batch-det.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/batch-det.h
+ * @ingroup algorithms
+ * @brief Determinants of many small dense integer matrices by a shared CRA.
+ */
+
+#ifndef __LINBOX_batch_det_H
+#define __LINBOX_batch_det_H
+
+#include <fflas-ffpack/paladin/parallel.h>
+#include <fflas-ffpack/ffpack/ffpack.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "linbox/integer.h"
+#include "linbox/ring/modular.h"
+#include "linbox/matrix/dense-matrix.h"
+#include "linbox/randiter/random-prime.h"
+#include "linbox/algorithms/cra-builder-single.h"
+#include "linbox/solutions/methods.h"
+#include "linbox/util/commentator.h"
+#include "linbox/util/debug.h"
+
+namespace LinBox
+{
+	namespace Protected {
+		/// Residues R[k] for k = t, t+NT, ...: the determinant of A[active[k % na]] modulo fields[k / na].
+		template <class Ring, class Rep, class Field>
+		void batchModularDets (const std::vector<BlasMatrix<Ring, Rep> > &A,
+				       const std::vector<size_t> &active, const std::vector<Field> &fields,
+				       size_t t, size_t NT, typename Field::Element *W, typename Field::Element *R)
+		{
+			const size_t na = active.size(), npairs = na * fields.size();
+			for (size_t k = t; k < npairs; k += NT) {
+				const Field& F = fields[k / na];
+				const BlasMatrix<Ring, Rep>& Ai = A[active[k % na]];
+				const size_t n = Ai.rowdim();
+				for (size_t r = 0; r < n; ++r)
+					for (size_t c = 0; c < n; ++c)
+						F.init(W[r * n + c], Ai.getEntry(r, c));
+				F.init(R[k]);
+				FFPACK::Det(F, R[k], n, W, n);
+			}
+		}
+	}
+
+	/** @brief Determinants of a batch of dense integer matrices.
+	 * @ingroup CRA
+	 *
+	 * All the matrices are reduced modulo the same primes, taken from the
+	 * shared prime pool, and each keeps its own early terminated
+	 * CRABuilderEarlySingle: a matrix leaves the batch as soon as its
+	 * determinant is stable. Each round spreads (matrix, prime) pairs over
+	 * NUM_THREADS tasks; when fewer matrices than threads are left, a round
+	 * takes several primes so that all the cores stay busy. Every task
+	 * reduces into its own workspace, allocated once for the largest
+	 * dimension, so that no allocation, prime iterator or commentator
+	 * activity is set up per matrix.
+	 *
+	 * @param[out] d  the determinants, d[i] = det(A[i])
+	 * @param A  square matrices over the integers
+	 * @param Meth  only its earlyTerminationThreshold is used
+	 */
+	template <class Ring, class Rep, class MyMethod>
+	std::vector<typename Ring::Element>& batch_cra_det (std::vector<typename Ring::Element>     &d,
+							    const std::vector<BlasMatrix<Ring, Rep> > &A,
+							    const MyMethod                          &Meth)
+	{
+		typedef Givaro::ModularBalanced<double> Field;
+		typedef Field::Element                  Element;
+		typedef CRABuilderEarlySingle<Field>    Builder;
+
+		size_t nmax = 0;
+		for (const auto& Ai : A) {
+			if (Ai.rowdim() != Ai.coldim())
+				throw LinboxError("LinBox ERROR: matrix must be square for determinant computation\n");
+			nmax = std::max(nmax, Ai.rowdim());
+		}
+
+		commentator().start ("Batched Integer Determinant", "bidet");
+
+		d.resize(A.size());
+		std::vector<Builder> builders(A.size(), Builder(Meth.earlyTerminationThreshold));
+		std::vector<size_t> active;
+		active.reserve(A.size());
+		for (size_t i = 0; i < A.size(); ++i) {
+			if (A[i].rowdim() == 0)
+				A[i].field().assign(d[i], A[i].field().one);
+			else
+				active.push_back(i);
+		}
+
+		const size_t NN = std::max<size_t>(1, NUM_THREADS);
+		std::vector<std::vector<Element> > work(NN, std::vector<Element>(nmax * nmax));
+		std::vector<Field> fields;
+		std::vector<Element> residues;
+		PrimeIterator<IteratorCategories::PoolTag> genprime(FieldTraits<Field>::bestBitSize(nmax));
+		size_t nprimes = 0;
+
+		while (!active.empty()) {
+			const size_t na = active.size();
+			const size_t np = std::max<size_t>(1, NN / na);
+			fields.clear();
+			for (size_t j = 0; j < np; ++j, ++genprime)
+				fields.emplace_back(*genprime);
+			residues.resize(na * np);
+			const size_t npairs = na * np, NT = std::min(NN, npairs);
+
+			SYNCH_GROUP(
+			for (size_t t = 0; t < NT; ++t) {
+				Element* W = work[t].data();
+				Element* R = residues.data();
+				Element* Rt = R + t; // distinct per task, for the dependencies
+				{ TASK(MODE(CONSTREFERENCE(A, active, fields) READ(R) WRITE(W, Rt)),
+				       Protected::batchModularDets(A, active, fields, t, NT, W, R);)}
+			}
+			)
+
+			// builders are updated prime after prime, in sequence order
+			for (size_t j = 0; j < np; ++j)
+				for (size_t l = 0; l < na; ++l) {
+					Builder& B = builders[active[l]];
+					if (nprimes + j == 0)
+						B.initialize(fields[j], residues[j * na + l]);
+					else if (!B.terminated())
+						B.progress(fields[j], residues[j * na + l]);
+				}
+			nprimes += np;
+
+			auto done = std::remove_if(active.begin(), active.end(), [&](size_t i) {
+				if (!builders[i].terminated()) return false;
+				Integer di;
+				builders[i].result(di);
+				A[i].field().init(d[i], di);
+				return true;
+			});
+			active.erase(done, active.end());
+		}
+
+		commentator().report(Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
+			<< A.size() << " determinants with " << nprimes << " primes" << std::endl;
+		commentator().stop ("done", NULL, "bidet");
+		return d;
+	}
+
+} // end of LinBox namespace
+
+#endif // __LINBOX_batch_det_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,263 @@
+/* linbox/algorithms/blackbox-block-container-gf2.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/blackbox-block-container-gf2.h
+ * @ingroup algorithms
+ * @brief Block Krylov sequences over GF(2) on word-packed blocks
+ */
+
+#ifndef __LINBOX_blackbox_block_container_gf2_H
+#define __LINBOX_blackbox_block_container_gf2_H
+
+#include <time.h> // for seeding
+#include <algorithm>
+
+#include "linbox/util/debug.h"
+#include "linbox/field/gf2.h"
+#include "linbox/blackbox/zo-gf2.h"
+#include "linbox/matrix/bit-block.h"
+#include "linbox/vector/blas-vector.h"
+#include "linbox/randiter/mersenne-twister.h"
+
+#ifndef __BW_EXTRA_STEPS
+#define __BW_EXTRA_STEPS 10
+#endif
+
+namespace LinBox
+{
+
+	/** \brief Blackbox times @ref BitBlock
+	 *
+	 * Same role as MulHelper for the word-packed blocks: a
+	 * @ref ZeroOne<GF2> is applied to the whole block at once, any other
+	 * blackbox over GF(2) is applied column by column.
+	 */
+	template <size_t W>
+	class BitBlockMulHelper {
+	public:
+		typedef BitBlock<W>             Block;
+		typedef typename Block::Row     Row;
+
+		/// Y <- A X
+		static void mul (Block &Y, const ZeroOne<GF2> &A, const Block &X)
+		{
+			A.applyLeft (Y, X);
+		}
+
+		/// Y <- A^T X
+		static void mulTranspose (Block &Y, const ZeroOne<GF2> &A, const Block &X)
+		{
+			A.applyTransposeLeft (Y, X);
+		}
+
+		template <class Blackbox>
+		static void mul (Block &Y, const Blackbox &A, const Block &X)
+		{
+			columnwise (Y, A, X, false);
+		}
+
+		template <class Blackbox>
+		static void mulTranspose (Block &Y, const Blackbox &A, const Block &X)
+		{
+			columnwise (Y, A, X, true);
+		}
+
+	protected:
+
+		template <class Blackbox>
+		static void columnwise (Block &Y, const Blackbox &A, const Block &X, bool transpose)
+		{
+			const GF2 &F = A.field ();
+			const size_t in = transpose ? A.rowdim () : A.coldim ();
+			const size_t out = transpose ? A.coldim () : A.rowdim ();
+			BlasVector<GF2> u (F, in), v (F, out);
+
+			Row used = Block::zeroRow ();
+			for (size_t i = 0; i < in; ++i)
+				for (size_t w = 0; w < W; ++w)
+					used[w] |= X[i][w];
+
+			Y.clear ();
+
+			for (size_t c = 0; c < Block::width; ++c) {
+				const size_t h = c / 64;
+				const typename Block::Word bit = typename Block::Word (1) << (c % 64);
+
+				if (!(used[h] & bit))
+					continue;
+
+				for (size_t i = 0; i < in; ++i)
+					F.assign (u[i], (X[i][h] & bit) != 0);
+
+				if (transpose)
+					A.applyTranspose (v, u);
+				else
+					A.apply (v, u);
+
+				for (size_t i = 0; i < out; ++i)
+					if (!F.isZero (v[i]))
+						Y[i][h] |= bit;
+			}
+		}
+	};
+
+	/** \brief The sequence \f$U^TB^iV\f$ over GF(2) on word-packed blocks
+	 *
+	 * \f$U\f$ and \f$V\f$ are \f$N\times 64W\f$ @ref BitBlock, and
+	 * \f$B\f$ is either the blackbox \f$A\f$ (square) or \f$A^TA\f$ when
+	 * the container is built with \p symmetrize. Each step costs one block
+	 * apply of \f$B\f$ and one transposed product \f$U^TX\f$ by byte
+	 * tables. The default length is the one of @ref
+	 * BlackboxBlockContainerBase, \f$N/64W + N/64W + \f$
+	 * <code>__BW_EXTRA_STEPS</code>.
+	 */
+	template <class _Blackbox, size_t W = 1>
+	class BlackboxBlockContainerGF2 {
+	public:
+		typedef GF2                     Field;
+		typedef _Blackbox               Blackbox;
+		typedef BitBlock<W>             Block;
+		typedef BitBlock<W>             Value;
+
+		/// Sequence for given projection blocks
+		BlackboxBlockContainerGF2 (const Blackbox *BD, const Field &F, const Block &U, const Block &V, bool symmetrize = false) :
+			_field (&F), _BB (BD), _symmetrize (symmetrize),
+			_size (defaultSize (BD)), _blockU (U), _blockV (V)
+		{
+			linbox_check (U.rowdim () == BD->coldim () && V.rowdim () == BD->coldim ());
+			linbox_check (symmetrize || BD->rowdim () == BD->coldim ());
+			init ();
+		}
+
+		/// Sequence for random projection blocks
+		BlackboxBlockContainerGF2 (const Blackbox *BD, const Field &F, bool symmetrize = false,
+					   size_t seed = static_cast<size_t> (std::time (nullptr))) :
+			_field (&F), _BB (BD), _symmetrize (symmetrize),
+			_size (defaultSize (BD)), _blockU (BD->coldim ()), _blockV (BD->coldim ())
+		{
+			linbox_check (symmetrize || BD->rowdim () == BD->coldim ());
+			MersenneTwister MT ((uint32_t) seed);
+			BitBlockDomain<W>::random (_blockU, MT);
+			BitBlockDomain<W>::random (_blockV, MT);
+			init ();
+		}
+
+		// iterator of the sequence
+		class const_iterator {
+
+		protected:
+			BlackboxBlockContainerGF2<Blackbox, W> *_c;
+
+		public:
+			const_iterator () : _c (NULL) {}
+
+			const_iterator (BlackboxBlockContainerGF2<Blackbox, W> &C) :
+				_c (&C)
+			{}
+
+			const_iterator &operator ++ () { _c->_launch (); return *this; }
+
+			const Value    &operator * ()  { return _c->_value; }
+		};
+
+		// begin of the sequence iterator
+		const_iterator begin ()        { return const_iterator (*this); }
+
+		// end of the sequence iterator
+		const_iterator end ()          { return const_iterator (); }
+
+		// size of the sequence
+		size_t size () const           { return _size; }
+		void setSize (size_t s)        { _size = s; }
+
+		const Field &field () const    { return *_field; }
+		const Blackbox *getBB () const { return _BB; }
+
+		// dimensions of the sequence elements
+		size_t rowdim () const         { return Block::width; }
+		size_t coldim () const         { return Block::width; }
+
+		/// Left and right projections
+		const Block &getU () const     { return _blockU; }
+		const Block &getV () const     { return _blockV; }
+
+		/// X <- B X, with B the operator of the sequence
+		void applyOperator (Block &Y, const Block &X)
+		{
+			if (_symmetrize) {
+				_tmp.resize (_BB->rowdim ());
+				BitBlockMulHelper<W>::mul (_tmp, *_BB, X);
+				BitBlockMulHelper<W>::mulTranspose (Y, *_BB, _tmp);
+			}
+			else
+				BitBlockMulHelper<W>::mul (Y, *_BB, X);
+		}
+
+	protected:
+
+		friend class const_iterator;
+
+		static size_t defaultSize (const Blackbox *BD)
+		{
+			return 2 * std::max<size_t> (BD->coldim () / Block::width, 1) + __BW_EXTRA_STEPS;
+		}
+
+		void init ()
+		{
+			_blockW = _blockV;
+			_next.resize (_blockV.rowdim ());
+			BitBlockDomain<W>::mulTranspose (_value, _blockU, _blockW);
+		}
+
+		/// Next value \f$U^TB^{i+1}V\f$
+		void _launch ()
+		{
+			applyOperator (_next, _blockW);
+			std::swap (_next, _blockW);
+			BitBlockDomain<W>::mulTranspose (_value, _blockU, _blockW);
+		}
+
+		const Field                 *_field;
+		const Blackbox              *_BB;
+		bool                         _symmetrize;
+		size_t                       _size;
+		Block                        _blockU;
+		Block                        _blockV;
+		Block                        _blockW; // B^i V
+		Block                        _next;
+		Block                        _tmp;
+		Value                        _value;
+	};
+
+} // namespace LinBox
+
+#endif // __LINBOX_blackbox_block_container_gf2_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,706 @@
+/* linbox/algorithms/block-wiedemann-gf2.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/block-wiedemann-gf2.h
+ * @ingroup algorithms
+ * @brief Block Wiedemann over GF(2) on word-packed blocks
+ */
+
+#ifndef __LINBOX_block_wiedemann_gf2_H
+#define __LINBOX_block_wiedemann_gf2_H
+
+#include <algorithm>
+#include <ctime>
+#include <vector>
+
+#include "linbox/field/gf2.h"
+#include "linbox/matrix/bit-block.h"
+#include "linbox/algorithms/blackbox-block-container-gf2.h"
+#include "linbox/randiter/mersenne-twister.h"
+#include "linbox/solutions/methods.h"
+#include "linbox/util/commentator.h"
+#include "linbox/util/debug.h"
+
+namespace LinBox
+{
+
+	/** \brief Block Wiedemann over GF(2) with \f$64W\f$ packed columns
+	 *
+	 * The projection blocks \f$U\f$, \f$V\f$ are @ref BitBlock of width
+	 * \f$m = n = 64W\f$, so that one apply of a @ref ZeroOne<GF2> moves
+	 * \f$64W\f$ vectors at the cost of one row XOR per nonzero, and the
+	 * sequence \f$U^TB^iV\f$ is computed by byte tables (see @ref
+	 * BlackboxBlockContainerGF2).
+	 *
+	 * The right matrix generator is computed by Coppersmith's iteration as
+	 * described by Thomé: the \f$m+n\f$ candidate columns and their
+	 * discrepancies are kept packed, \f$2W\f$ words per row, and one step
+	 * is a small elimination on the constant discrepancy followed by a
+	 * product of all coefficients with the resulting \f$(m+n)\times(m+n)\f$
+	 * matrix. The cost is quadratic in the length of the sequence, which
+	 * is \f$2N/64W\f$.
+	 *
+	 * The generator gives \f$64W\f$ candidate vectors \f$z\f$ with
+	 * \f$Bz = 0\f$ or \f$Bz = b\f$. As in the GF(2) block Lanczos solver,
+	 * they are combined by a column elimination on their images under the
+	 * original matrix, so that returned solutions and nullspace vectors are
+	 * exact; only failure to find one is probabilistic.
+	 *
+	 * Any preconditioner other than <code>Preconditioner::None</code>, or a
+	 * non square matrix, runs the iteration on \f$B = A^TA\f$.
+	 */
+	template <size_t W>
+	class BitBlockWiedemannSolver {
+	public:
+		typedef GF2                         Field;
+		typedef GF2::Element                Element;
+		typedef BitBlock<W>                 Block;
+		typedef BitBlockDomain<W>           Domain;
+		typedef typename Block::Word        Word;
+		typedef typename Block::Row         Row;
+
+		static const size_t blockSize = Block::width;
+
+		BitBlockWiedemannSolver (const Field &F, const Method::BlockWiedemann &traits = Method::BlockWiedemann (),
+					 size_t seed = static_cast<size_t> (std::time (nullptr))) :
+			_field (&F), _traits (traits), _MT ((uint32_t) seed)
+		{}
+
+		/** Solve the linear system Ax = b.
+		 * @return true on success, false if no solution was found
+		 */
+		template <class Blackbox, class Vector>
+		bool solve (const Blackbox &A, Vector &x, const Vector &b);
+
+		/** Sample from the (right) nullspace of A
+		 *
+		 * The returned vectors are linearly independent. Trials stop
+		 * when the columns of \p X are filled or two consecutive trials
+		 * bring no new vector.
+		 *
+		 * @param A Black box for the matrix A
+		 * @param X Matrix into whose columns to store nullspace elements
+		 * @return Number of nullspace vectors found
+		 */
+		template <class Blackbox, class Matrix1>
+		size_t sampleNullspace (const Blackbox &A, Matrix1 &X);
+
+		/** Rank of A, as coldim minus the dimension of the sampled nullspace
+		 *
+		 * This is Monte Carlo: the nullspace is sampled until two
+		 * consecutive trials bring no new vector.
+		 */
+		template <class Blackbox>
+		size_t rank (const Blackbox &A);
+
+		/** Right generator of a matrix sequence.
+		 *
+		 * Computes \f$64W\f$ columns \f$f_j = \sum_k f_{j,k}X^k\f$ such
+		 * that \f$\sum_k S_{i+k}f_{j,k} = 0\f$ for all valid \f$i\f$.
+		 * Bit \f$j\f$ of row \f$c\f$ of <code>G[k]</code> is entry
+		 * \f$c\f$ of \f$f_{j,k}\f$.
+		 *
+		 * @return the degree of the generator
+		 */
+		size_t rightGenerator (std::vector<Block> &G, const std::vector<Block> &S) const;
+
+		const Field &field () const { return *_field; }
+
+	protected:
+
+		typedef BitBlock<2 * W>             Wide;
+		typedef typename Wide::Row          WideRow;
+
+		bool useSymmetrize (size_t m, size_t n) const
+		{
+			return m != n || _traits.preconditioner != Preconditioner::None;
+		}
+
+		/// Y <- B X
+		template <class Blackbox>
+		void applyOp (Block &Y, const Blackbox &A, const Block &X, bool symmetrize) const
+		{
+			if (symmetrize) {
+				Block T (A.rowdim ());
+				BitBlockMulHelper<W>::mul (T, A, X);
+				BitBlockMulHelper<W>::mulTranspose (Y, A, T);
+			}
+			else
+				BitBlockMulHelper<W>::mul (Y, A, X);
+		}
+
+		/** One block Wiedemann pass on the sequence of V = B Y, where
+		 * column 0 of V may also hold a right-hand side b.
+		 * With f the generator, z_j = sum_k B^(k-1) V f_(j,k) + Y f_(j,0)
+		 * satisfies B z_j = b f_(j,0)[0]; the bits f_(j,0)[0] are
+		 * returned in \p g0.
+		 */
+		template <class Blackbox>
+		void trial (BlackboxBlockContainerGF2<Blackbox, W> &seq, const Block &Y, Block &Z, Row &g0);
+
+		/// Nullspace candidates of one trial, in the pivot columns of Z
+		template <class Blackbox>
+		void sampleTrial (const Blackbox &A, Block &Z, Row &pivots);
+
+		typedef std::vector<std::vector<Word> > Basis;
+
+		/** Adds the pivot columns of Z to a nullspace basis in echelon
+		 * form (basis[l] has a one at pivot[l] and zeros at the pivots
+		 * of the earlier vectors), up to \p limit vectors.
+		 * @return the number of vectors added
+		 */
+		size_t extendBasis (Basis &basis, std::vector<size_t> &pivot,
+				    const Block &Z, const Row &pivots, size_t limit) const;
+
+		const Field                *_field;
+		Method::BlockWiedemann      _traits;
+		MersenneTwister             _MT;
+	};
+
+	template <size_t W> const size_t BitBlockWiedemannSolver<W>::blockSize;
+
+	template <size_t W>
+	inline size_t BitBlockWiedemannSolver<W>::rightGenerator (std::vector<Block> &G, const std::vector<Block> &S) const
+	{
+		const size_t m = blockSize, n = blockSize, b = m + n;
+		const size_t L = S.size ();
+		const size_t none = size_t (-1);
+
+		// Starting columns: m independent columns among those of S_0, S_1, ...
+		std::vector<size_t> sr, cr;
+		{
+			std::vector<Row> basis;
+			std::vector<size_t> piv;
+
+			for (size_t s = 0; s < L && sr.size () < m; ++s)
+				for (size_t c = 0; c < n && sr.size () < m; ++c) {
+					Row v = Block::zeroRow ();
+					for (size_t r = 0; r < m; ++r)
+						if (S[s].getEntry (r, c))
+							v[r / 64] |= Word (1) << (r % 64);
+
+					for (size_t l = 0; l < basis.size (); ++l)
+						if (v[piv[l] / 64] & (Word (1) << (piv[l] % 64)))
+							Block::addin (v, basis[l]);
+
+					if (Block::isZero (v))
+						continue;
+
+					basis.push_back (v);
+					piv.push_back (Block::lowestBit (v));
+					sr.push_back (s);
+					cr.push_back (c);
+				}
+		}
+
+		if (sr.empty ()) {
+			// Zero sequence: any vector is a generator
+			G.assign (1, Block (n));
+			for (size_t c = 0; c < n; ++c)
+				G[0].setEntry (c, c, true);
+			return 0;
+		}
+
+		const size_t t0 = *std::max_element (sr.begin (), sr.end ()) + 1;
+
+		// Column j < n of F is e_j, column n + r is X^(t0 - s_r) e_(c_r);
+		// unused columns n + r are disabled (infinite degree)
+		std::vector<size_t> delta (b, t0);
+		for (size_t r = sr.size (); r < m; ++r)
+			delta[n + r] = none;
+
+		// F(X) and the discrepancies E(X) = S(X) F(X) / X^t, by coefficient
+		Wide F ((L + 2) * n), E ((L - t0) * m);
+		size_t Fdeg = t0;
+
+		for (size_t c = 0; c < n; ++c)
+			F[c][c / 64] |= Word (1) << (c % 64);
+		for (size_t r = 0; r < sr.size (); ++r)
+			F[(t0 - sr[r]) * n + cr[r]][(n + r) / 64] |= Word (1) << ((n + r) % 64);
+
+		for (size_t s = 0; s + t0 < L; ++s)
+			for (size_t i = 0; i < m; ++i) {
+				WideRow &e = E[s * m + i];
+				for (size_t w = 0; w < W; ++w)
+					e[w] = S[s + t0][i][w];
+				for (size_t r = 0; r < sr.size (); ++r)
+					if (S[s + sr[r]].getEntry (i, cr[r]))
+						e[(n + r) / 64] |= Word (1) << ((n + r) % 64);
+			}
+
+		WideRow enabled = Wide::zeroRow ();
+		for (size_t j = 0; j < b; ++j)
+			if (delta[j] != none)
+				enabled[j / 64] |= Word (1) << (j % 64);
+
+		std::vector<size_t> order;
+		Wide tau (b), E0 (m);
+		std::vector<WideRow> T;
+
+		for (size_t t = t0; t < L; ++t) {
+			const size_t len = L - t; // valid coefficients of E
+
+			// Columns by increasing degree
+			order.clear ();
+			for (size_t j = 0; j < b; ++j)
+				if (delta[j] != none)
+					order.push_back (j);
+			std::stable_sort (order.begin (), order.end (),
+					  [&delta] (size_t i, size_t j) { return delta[i] < delta[j]; });
+
+			// Eliminate the constant discrepancy: lower degree columns are
+			// added to higher degree ones
+			for (size_t i = 0; i < m; ++i)
+				E0[i] = E[i];
+			tau.clear ();
+			for (size_t j = 0; j < b; ++j)
+				tau[j][j / 64] |= Word (1) << (j % 64);
+
+			WideRow remaining = enabled, P = Wide::zeroRow ();
+			bool identity = true;
+
+			for (size_t l = 0; l < order.size (); ++l) {
+				const size_t j = order[l], h = j / 64;
+				const Word bit = Word (1) << (j % 64);
+
+				remaining[h] &= ~bit;
+
+				size_t r = 0;
+				while (r < m && !(E0[r][h] & bit))
+					++r;
+				if (r == m)
+					continue;
+
+				P[h] |= bit;
+
+				WideRow M;
+				for (size_t w = 0; w < 2 * W; ++w)
+					M[w] = E0[r][w] & remaining[w];
+				if (Wide::isZero (M))
+					continue;
+
+				identity = false;
+				for (size_t i = r; i < m; ++i)
+					if (E0[i][h] & bit)
+						Wide::addin (E0[i], M);
+				for (size_t i = 0; i < b; ++i)
+					if (tau[i][h] & bit)
+						Wide::addin (tau[i], M);
+			}
+
+			// Apply the column operations to all coefficients
+			if (!identity) {
+				BitBlockDomain<2 * W>::tables (T, tau);
+				for (size_t i = 0; i < m; ++i)
+					E[i] = E0[i];
+				BitBlockDomain<2 * W>::mul (E.rows () + m, E.rows () + m, (len - 1) * m, T);
+				BitBlockDomain<2 * W>::mul (F.rows (), F.rows (), (Fdeg + 1) * n, T);
+			}
+
+			if (Wide::isZero (P)) {
+				// Every constant discrepancy vanished
+				for (size_t i = 0; i + m < len * m; ++i)
+					E[i] = E[i + m];
+				continue;
+			}
+
+			// Multiply the pivot columns by X: their discrepancy stays,
+			// the others move one coefficient down
+			for (size_t s = 0; s + 1 < len; ++s)
+				for (size_t i = 0; i < m; ++i) {
+					WideRow &e = E[s * m + i];
+					const WideRow &f = E[(s + 1) * m + i];
+					for (size_t w = 0; w < 2 * W; ++w)
+						e[w] = (f[w] & ~P[w]) | (e[w] & P[w]);
+				}
+
+			++Fdeg;
+			for (size_t k = Fdeg; k > 0; --k)
+				for (size_t c = 0; c < n; ++c) {
+					WideRow &f = F[k * n + c];
+					const WideRow &g = F[(k - 1) * n + c];
+					for (size_t w = 0; w < 2 * W; ++w)
+						f[w] = (f[w] & ~P[w]) | (g[w] & P[w]);
+				}
+			for (size_t c = 0; c < n; ++c)
+				for (size_t w = 0; w < 2 * W; ++w)
+					F[c][w] &= ~P[w];
+
+			for (size_t j = 0; j < b; ++j)
+				if (P[j / 64] & (Word (1) << (j % 64)))
+					++delta[j];
+		}
+
+		// The n columns of lowest degree, reversed
+		order.clear ();
+		for (size_t j = 0; j < b; ++j)
+			if (delta[j] != none)
+				order.push_back (j);
+		std::stable_sort (order.begin (), order.end (),
+				  [&delta] (size_t i, size_t j) { return delta[i] < delta[j]; });
+		order.resize (std::min (order.size (), n));
+
+		size_t D = 0;
+		for (size_t l = 0; l < order.size (); ++l)
+			D = std::max (D, delta[order[l]]);
+
+		G.assign (D + 1, Block (n));
+		for (size_t l = 0; l < order.size (); ++l) {
+			const size_t j = order[l], d = delta[j];
+			const Word bit = Word (1) << (j % 64);
+
+			for (size_t k = 0; k <= d; ++k)
+				for (size_t c = 0; c < n; ++c)
+					if (F[(d - k) * n + c][j / 64] & bit)
+						G[k][c][l / 64] |= Word (1) << (l % 64);
+		}
+
+		commentator().report (Commentator::LEVEL_UNIMPORTANT, INTERNAL_DESCRIPTION)
+		<< "Generator degree: " << D << " (sequence length " << L << ")" << std::endl;
+
+		return D;
+	}
+
+	template <size_t W>
+	template <class Blackbox>
+	inline void BitBlockWiedemannSolver<W>::trial (BlackboxBlockContainerGF2<Blackbox, W> &seq, const Block &Y,
+							Block &Z, Row &g0)
+	{
+		std::vector<Block> S;
+		S.reserve (seq.size ());
+
+		typename BlackboxBlockContainerGF2<Blackbox, W>::const_iterator it = seq.begin ();
+		for (size_t i = 0; i < seq.size (); ++i, ++it)
+			S.push_back (*it);
+
+		std::vector<Block> G;
+		const size_t D = rightGenerator (G, S);
+
+		// Z = sum_{k >= 1} B^(k-1) V f_k + Y f_0, by Horner
+		const Block &V = seq.getV ();
+		Block T (V.rowdim ());
+
+		Z.resize (V.rowdim ());
+		Z.clear ();
+		for (size_t k = D; k > 0; --k) {
+			if (k < D) {
+				seq.applyOperator (T, Z);
+				std::swap (T, Z);
+			}
+			Domain::axpyin (Z, V, G[k]);
+		}
+		Domain::axpyin (Z, Y, G[0]);
+
+		g0 = G[0][0];
+	}
+
+	template <size_t W>
+	template <class Blackbox, class Vector>
+	inline bool BitBlockWiedemannSolver<W>::solve (const Blackbox &A, Vector &x, const Vector &b)
+	{
+		linbox_check ((x.size () == A.coldim ()) &&
+			      (b.size () == A.rowdim ()));
+
+		commentator().start ("Solving linear system (block Wiedemann over GF(2))", "BitBlockWiedemannSolver::solve");
+
+		const size_t m = A.rowdim (), n = A.coldim ();
+		const bool symmetrize = useSymmetrize (m, n);
+		bool success = false;
+
+		// Right-hand side in column 0
+		Block bm (m), bB (n), Y (n), V (n), U (n), Z, R (m);
+		for (size_t k = 0; k < m; ++k)
+			bm[k][0] = field().isZero (b[k]) ? 0 : 1;
+
+		if (symmetrize)
+			BitBlockMulHelper<W>::mulTranspose (bB, A, bm);
+		else
+			bB = bm;
+
+		for (unsigned int i = 0; !success && i < _traits.trialsBeforeFailure; ++i) {
+			commentator().report (Commentator::LEVEL_UNIMPORTANT, INTERNAL_DESCRIPTION)
+			<< "In try: " << i << std::endl;
+
+			Domain::random (Y, _MT);
+			Domain::random (U, _MT);
+			for (size_t k = 0; k < n; ++k)
+				Y[k][0] &= ~Word (1);
+
+			applyOp (V, A, Y, symmetrize);
+			for (size_t k = 0; k < n; ++k)
+				V[k][0] ^= bB[k][0];
+
+			BlackboxBlockContainerGF2<Blackbox, W> seq (&A, field (), U, V, symmetrize);
+
+			Row g0;
+			trial (seq, Y, Z, g0);
+
+			if (Block::isZero (g0))
+				continue;
+
+			// Column j0 has B z = b, fold it into the other such columns
+			const size_t j0 = Block::lowestBit (g0);
+			const size_t h0 = j0 / 64;
+			const Word p0 = Word (1) << (j0 % 64);
+
+			g0[h0] &= ~p0;
+			for (size_t k = 0; k < n; ++k)
+				if (Z[k][h0] & p0)
+					Block::addin (Z[k], g0);
+
+			// Residuals: A z_j0 - b and A z_j, then combine
+			BitBlockMulHelper<W>::mul (R, A, Z);
+			for (size_t k = 0; k < m; ++k)
+				if (bm[k][0])
+					R[k][h0] ^= p0;
+
+			Row active, pivots, keep = Block::zeroRow ();
+			active.fill (~Word (0));
+			keep[h0] = p0;
+
+			Domain::eliminateColumns (R, &Z, active, pivots, keep);
+
+			success = (active[h0] & p0) != 0;
+
+			if (success) {
+				for (size_t k = 0; k < n; ++k)
+					field().assign (x[k], (Z[k][h0] & p0) != 0);
+			}
+		}
+
+		if (success && _traits.checkResult) {
+			Y.clear ();
+			for (size_t k = 0; k < n; ++k)
+				Y[k][0] = field().isZero (x[k]) ? 0 : 1;
+
+			BitBlockMulHelper<W>::mul (R, A, Y);
+			for (size_t k = 0; success && k < m; ++k)
+				success = (R[k][0] & 1) == bm[k][0];
+
+			commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
+			<< "Checking whether Ax=b ... " << (success ? "passed" : "FAILED") << std::endl;
+		}
+
+		commentator().stop (success ? "done" : "solve failed", NULL, "BitBlockWiedemannSolver::solve");
+
+		return success;
+	}
+
+	template <size_t W>
+	template <class Blackbox>
+	inline void BitBlockWiedemannSolver<W>::sampleTrial (const Blackbox &A, Block &Z, Row &pivots)
+	{
+		const size_t m = A.rowdim (), n = A.coldim ();
+		const bool symmetrize = useSymmetrize (m, n);
+
+		Block Y (n), V (n), U (n), R (m);
+
+		Domain::random (Y, _MT);
+		Domain::random (U, _MT);
+
+		applyOp (V, A, Y, symmetrize);
+
+		BlackboxBlockContainerGF2<Blackbox, W> seq (&A, field (), U, V, symmetrize);
+
+		Row g0;
+		trial (seq, Y, Z, g0);
+
+		BitBlockMulHelper<W>::mul (R, A, Z);
+
+		Row active, keep = Block::zeroRow ();
+		active.fill (~Word (0));
+
+		Domain::eliminateColumns (R, &Z, active, pivots, keep);
+
+		// Keep an independent subset of the columns mapped to zero
+		Domain::eliminateColumns (Z, NULL, active, pivots, keep);
+	}
+
+	template <size_t W>
+	inline size_t BitBlockWiedemannSolver<W>::extendBasis (Basis &basis, std::vector<size_t> &pivot,
+							       const Block &Z, const Row &pivots, size_t limit) const
+	{
+		const size_t n = Z.rowdim ();
+		const size_t words = (n + 63) / 64;
+		std::vector<Word> v (words);
+		size_t added = 0;
+
+		for (size_t c = 0; c < blockSize && basis.size () < limit; ++c) {
+			const size_t h = c / 64;
+			const Word bit = Word (1) << (c % 64);
+
+			if (!(pivots[h] & bit))
+				continue;
+
+			std::fill (v.begin (), v.end (), Word (0));
+			for (size_t k = 0; k < n; ++k)
+				if (Z[k][h] & bit)
+					v[k / 64] |= Word (1) << (k % 64);
+
+			for (size_t l = 0; l < basis.size (); ++l)
+				if (v[pivot[l] / 64] & (Word (1) << (pivot[l] % 64)))
+					for (size_t w = 0; w < words; ++w)
+						v[w] ^= basis[l][w];
+
+			size_t w = 0;
+			while (w < words && v[w] == 0)
+				++w;
+
+			if (w == words)
+				continue;
+
+			size_t p = 64 * w;
+			while (!(v[w] & (Word (1) << (p % 64))))
+				++p;
+
+			basis.push_back (v);
+			pivot.push_back (p);
+			++added;
+		}
+
+		return added;
+	}
+
+	template <size_t W>
+	template <class Blackbox, class Matrix1>
+	inline size_t BitBlockWiedemannSolver<W>::sampleNullspace (const Blackbox &A, Matrix1 &X)
+	{
+		linbox_check (X.rowdim () == A.coldim ());
+
+		commentator().start ("Sampling from nullspace (block Wiedemann over GF(2))", "BitBlockWiedemannSolver::sampleNullspace");
+
+		const size_t n = A.coldim ();
+		Basis basis;
+		std::vector<size_t> pivot;
+		Block Z;
+		Row pivots;
+		unsigned int quiet = 0;
+
+		// Stop when X is full or two consecutive trials bring nothing new
+		for (unsigned int i = 0; basis.size () < X.coldim () && quiet < 2 && i < _traits.trialsBeforeFailure; ++i) {
+			commentator().report (Commentator::LEVEL_UNIMPORTANT, INTERNAL_DESCRIPTION)
+			<< "in try: " << i << std::endl;
+
+			sampleTrial (A, Z, pivots);
+
+			quiet = extendBasis (basis, pivot, Z, pivots, X.coldim ()) ? 0 : quiet + 1;
+		}
+
+		for (size_t l = 0; l < basis.size (); ++l)
+			for (size_t k = 0; k < n; ++k)
+				X.setEntry (k, l, Element ((basis[l][k / 64] >> (k % 64)) & 1));
+
+		commentator().stop ("done", NULL, "BitBlockWiedemannSolver::sampleNullspace");
+
+		return basis.size ();
+	}
+
+	template <size_t W>
+	template <class Blackbox>
+	inline size_t BitBlockWiedemannSolver<W>::rank (const Blackbox &A)
+	{
+		commentator().start ("Rank (block Wiedemann over GF(2))", "BitBlockWiedemannSolver::rank");
+
+		const size_t n = A.coldim ();
+		Basis basis;
+		std::vector<size_t> pivot;
+		Block Z;
+		Row pivots;
+		unsigned int quiet = 0;
+
+		for (unsigned int i = 0; quiet < 2 && i < _traits.trialsBeforeFailure; ++i) {
+			sampleTrial (A, Z, pivots);
+
+			quiet = extendBasis (basis, pivot, Z, pivots, n) ? 0 : quiet + 1;
+		}
+
+		if (quiet < 2)
+			commentator().report (Commentator::LEVEL_IMPORTANT, INTERNAL_WARNING)
+			<< "Nullspace sampling did not settle, the rank may be overestimated" << std::endl;
+
+		commentator().stop ("done", NULL, "BitBlockWiedemannSolver::rank");
+
+		return n - basis.size ();
+	}
+
+	/** \brief Block Wiedemann over GF(2), blocking factor chosen at run time
+	 *
+	 * Forwards to @ref BitBlockWiedemannSolver with 64, 128 or 256 packed
+	 * columns: the smallest of them that is at least
+	 * <code>traits.blockingFactor</code>, 256 if none is.
+	 */
+	class BlockWiedemannSolverGF2 {
+	public:
+		typedef GF2 Field;
+
+		BlockWiedemannSolverGF2 (const Field &F, const Method::BlockWiedemann &traits = Method::BlockWiedemann ()) :
+			_field (&F), _traits (traits)
+		{}
+
+		template <class Blackbox, class Vector>
+		bool solve (const Blackbox &A, Vector &x, const Vector &b) const
+		{
+			if (_traits.blockingFactor <= 64)
+				return BitBlockWiedemannSolver<1> (*_field, _traits).solve (A, x, b);
+			if (_traits.blockingFactor <= 128)
+				return BitBlockWiedemannSolver<2> (*_field, _traits).solve (A, x, b);
+			return BitBlockWiedemannSolver<4> (*_field, _traits).solve (A, x, b);
+		}
+
+		template <class Blackbox, class Matrix1>
+		size_t sampleNullspace (const Blackbox &A, Matrix1 &X) const
+		{
+			if (_traits.blockingFactor <= 64)
+				return BitBlockWiedemannSolver<1> (*_field, _traits).sampleNullspace (A, X);
+			if (_traits.blockingFactor <= 128)
+				return BitBlockWiedemannSolver<2> (*_field, _traits).sampleNullspace (A, X);
+			return BitBlockWiedemannSolver<4> (*_field, _traits).sampleNullspace (A, X);
+		}
+
+		template <class Blackbox>
+		size_t rank (const Blackbox &A) const
+		{
+			if (_traits.blockingFactor <= 64)
+				return BitBlockWiedemannSolver<1> (*_field, _traits).rank (A);
+			if (_traits.blockingFactor <= 128)
+				return BitBlockWiedemannSolver<2> (*_field, _traits).rank (A);
+			return BitBlockWiedemannSolver<4> (*_field, _traits).rank (A);
+		}
+
+	protected:
+		const Field                *_field;
+		Method::BlockWiedemann      _traits;
+	};
+
+} // namespace LinBox
+
+#endif // __LINBOX_block_wiedemann_gf2_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
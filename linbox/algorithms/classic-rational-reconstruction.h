@@ -29,6 +29,7 @@
 #include <iostream>
 
 #include "linbox/algorithms/rational-reconstruction-base.h"
+#include "linbox/algorithms/half-gcd-rational-reconstruction.h"
 
 namespace LinBox
 {
@@ -104,6 +105,8 @@ namespace LinBox
 			a=x;
 			b=1;
 			//Element s0,s1; s0=1,s1=0;//test time gcdex;
+			// large moduli: same remainders, by half-gcd
+			if (!halfGcdRemainders(r0, t0, a, b, m, x, a_bound))
 			while(a>=a_bound)
 				//while (t0 <= b_bound)
 			{
@@ -263,6 +266,8 @@ namespace LinBox
 				Element T = (uint32_t) m.bitsize();
 				int c = 5;	//should be changed here to enhance probability of correctness
 
+				// large moduli: same maximal quotient, by half-gcd
+				if (!halfGcdMaxQuotient(amax, bmax, qmax, m, x, T.bitsize() + (size_t)c))
 				while((a>0) && (r0.bitsize() > T.bitsize() + (size_t)c))
 				{
 					q = r0;
@@ -0,0 +1,208 @@
+/* linbox/algorithms/cra-builder-early-coeffwise.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/cra-builder-early-coeffwise.h
+ * @ingroup algorithms
+ * @ingroup CRA
+ * @brief Chinese remaindering of a vector with early termination coefficient by coefficient
+ */
+
+#ifndef __LINBOX_cra_early_coeffwise_H
+#define __LINBOX_cra_early_coeffwise_H
+
+#include <ostream>
+#include <sstream>
+#include <vector>
+
+#include "linbox/integer.h"
+#include "linbox/solutions/methods.h"
+
+namespace LinBox
+{
+
+	/** @brief Chinese remaindering of a vector (of polynomial coefficients)
+	 * with early termination of each coefficient.
+	 * @ingroup CRA
+	 *
+	 * Each coefficient is reconstructed on its own and is considered
+	 * found once its symmetric residue has not changed for EARLY
+	 * consecutive primes; from then on it is neither checked nor updated,
+	 * so that the work of the following primes only goes to the
+	 * coefficients still unstable. The reconstruction terminates when all
+	 * of them are found, or when the modulus exceeds the optional bound.
+	 *
+	 * The dimension is degree-aware, for minimal polynomials: a residue
+	 * shorter than the current one comes from an unlucky prime and is
+	 * ignored, a longer one means that all the previous primes were
+	 * unlucky and restarts the reconstruction.
+	 */
+	template<class Domain_Type>
+	struct CRABuilderEarlyCoeffwise {
+		typedef Domain_Type                    Domain;
+		typedef typename Domain::Element DomainElement;
+		typedef CRABuilderEarlyCoeffwise<Domain>       Self_t;
+
+	protected:
+		const size_t          EARLY_TERM_THRESHOLD;
+		const double          LOGARITHMIC_UPPER_BOUND; //!< log2 of a bound on the result, 0 for none
+		Integer               primeProd_;
+		std::vector<Integer>  residue_;    //!< symmetric residues modulo primeProd_
+		std::vector<size_t>   occurency_;  //!< consecutive primes without change, per coefficient
+		size_t                unstable_ = 0;
+		size_t                unlucky_ = 0;
+		size_t                updates_ = 0;
+		bool                  initialized_ = false;
+
+	public:
+
+		friend std::ostream& operator<< (std::ostream& out, const Self_t& cra) {
+			std::ostringstream report;
+			report << "CRA Builder: "
+			       << "[EarlyTerminated] [CoefficientWise] [MultipleReconstructions]";
+			return out << report.str();
+		}
+
+		/** @param EARLY  number of consecutive primes without change for a coefficient to be found
+		 *  @param bnd  if positive, upper bound on log2 of the absolute values to reconstruct
+		 */
+		CRABuilderEarlyCoeffwise(const size_t EARLY = LINBOX_DEFAULT_EARLY_TERMINATION_THRESHOLD, const double bnd = 0.0) :
+			EARLY_TERM_THRESHOLD(EARLY ? EARLY : 1), LOGARITHMIC_UPPER_BOUND(bnd), primeProd_(1)
+		{
+#if __LB_CRA_REPORTING__
+			std::clog << *this << std::endl;
+#endif
+		}
+
+		template<class Vect>
+		void initialize (const Domain& D, const Vect& e)
+		{
+			D.characteristic(primeProd_);
+			residue_.resize(e.size());
+			occurency_.assign(e.size(), 0);
+			unstable_ = e.size();
+			auto r_it = residue_.begin();
+			for (auto e_it = e.begin(); e_it != e.end(); ++e_it, ++r_it)
+				D.convert(*r_it, *e_it);
+			updates_ += e.size();
+			initialized_ = true;
+		}
+
+		template<class Vect>
+		void progress (const Domain& D, const Vect& e)
+		{
+			if (!initialized_ || e.size() > residue_.size()) {
+				// the previous primes were unlucky
+				if (initialized_) ++unlucky_;
+				initialize(D, e);
+				return;
+			}
+			if (e.size() < residue_.size()) {
+				++unlucky_;
+				return;
+			}
+
+			Integer p;
+			D.characteristic(p);
+			DomainElement invProd, r, t;
+			D.init(invProd, primeProd_);
+			D.invin(invProd);
+			Integer newProd = primeProd_ * p, half = newProd >> 1, ti;
+
+			auto e_it = e.begin();
+			for (size_t i = 0; i < residue_.size(); ++i, ++e_it) {
+				if (occurency_[i] >= EARLY_TERM_THRESHOLD)
+					continue;
+				++updates_;
+				D.init(r, residue_[i]);
+				if (D.areEqual(r, *e_it)) {
+					if (++occurency_[i] == EARLY_TERM_THRESHOLD)
+						--unstable_;
+					continue;
+				}
+				occurency_[i] = 0;
+				// r_i += primeProd (e_i - r_i) / primeProd mod p, kept symmetric
+				D.sub(t, *e_it, r);
+				D.mulin(t, invProd);
+				D.convert(ti, t);
+				if (ti < 0) ti += p;
+				Integer::axpyin(residue_[i], primeProd_, ti);
+				if (residue_[i] > half) residue_[i] -= newProd;
+				else if (residue_[i] < -half) residue_[i] += newProd;
+			}
+			primeProd_ = newProd;
+		}
+
+		template<class Vect>
+		Vect& result (Vect& d) const
+		{
+			d.resize(residue_.size());
+			auto d_it = d.begin();
+			for (auto r_it = residue_.begin(); r_it != residue_.end(); ++r_it, ++d_it)
+				*d_it = *r_it;
+			return d;
+		}
+
+		bool terminated() const
+		{
+			if (!initialized_) return false;
+			return unstable_ == 0
+			       || (LOGARITHMIC_UPPER_BOUND > 0.0 && Givaro::logtwo(primeProd_) > LOGARITHMIC_UPPER_BOUND + 1.0);
+		}
+
+		bool noncoprime(const Integer& i) const
+		{
+			Integer g;
+			return gcd(g, i, primeProd_) != 1;
+		}
+
+		Integer& getModulus(Integer& m) const
+		{
+			return m = primeProd_;
+		}
+
+		template<class Vect>
+		Vect& getResidue(Vect& m) const
+		{
+			return result(m);
+		}
+
+		/// Number of coefficients not found yet
+		size_t unstable() const { return unstable_; }
+
+		/// Number of residues ignored or discarded because of an unlucky prime
+		size_t unlucky() const { return unlucky_; }
+
+		/// Number of coefficient residues read so far, a measure of the reconstruction work
+		size_t updates() const { return updates_; }
+	};
+
+}
+
+#endif //__LINBOX_cra_early_coeffwise_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
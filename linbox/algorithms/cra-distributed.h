@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -39,35 +40,61 @@
 #include "linbox/util/mpicpp.h"
 #include "linbox/util/timer.h"
 
+#include <fflas-ffpack/paladin/parallel.h>
+
 #if defined(__LINBOX_HAVE_MPI)
 
 namespace LinBox {
 
+    /** \brief Chinese remaindering over MPI nodes.
+     *
+     * The master (rank 0) owns the builder and the prime sequence, the
+     * workers compute residues.  The protocol is asynchronous:
+     * - a worker asks for a batch of primes (as many as it has threads)
+     *   and computes its residues in parallel (PALADIN tasks);
+     * - residues are sent back with nonblocking sends as soon as they are
+     *   computed, and the master folds them in arrival order;
+     * - when the builder is terminated (early termination or bound reached),
+     *   the master sends a stop to every worker, which drops its current
+     *   batch, and waits for their acknowledgment.
+     * As in the sequential and parallel loops, SKIP residues are dropped
+     * (the master draws another prime for its own first one) and a RESTART
+     * residue is sent with its own tag so that the master initializes the
+     * builder again.
+     * Fast nodes thus ask for more primes than slow ones and no work is
+     * done past termination, up to one round per worker.
+     */
     template <class CRABase>
     struct ChineseRemainderDistributed {
         using Domain = typename CRABase::Domain;
 
-        // @note This causes the algorithm to give wrong answer sometimes...
-        // using MaskedPrimeGenerator = MaskedPrimeIterator<IteratorCategories::HeuristicTag>;
-        using MaskedPrimeGenerator = MaskedPrimeIterator<IteratorCategories::DeterministicTag>;
-
     protected:
+        //! Message tags of the protocol.
+        enum Tag : int {
+            TagRequest = 1, //!< worker -> master, number of primes wanted
+            TagBatch,       //!< master -> worker, number of primes then the primes
+            TagResidue,     //!< worker -> master, a prime then its residue
+            TagStop,        //!< master -> worker, stop computing
+            TagDone,        //!< worker -> master, acknowledges the stop
+            TagRestart      //!< worker -> master, a prime then a residue discarding the previous ones
+        };
+
+        static const int MAXSKIP = 1000; //!< bad primes in a row on the master before giving up
+
         CRABase Builder_;
         Communicator* _pCommunicator;
-        double _hadamardLogBound;
-        double _workerHadamardLogBound = 0.0; //!< Each worker will compute primes until this is hit.
+        size_t _batchSize = 0; //!< Primes per request, 0 for the number of threads of the worker.
 
     public:
         ChineseRemainderDistributed(double b, Communicator* c)
             : Builder_(b)
             , _pCommunicator(c)
-            , _hadamardLogBound(b)
         {
-            if (c && c->size() > 1) {
-                _workerHadamardLogBound = _hadamardLogBound / (c->size() - 1);
-            }
         }
 
+        /// Number of primes handed out to a worker per request (0: its number of threads).
+        void setBatchSize(size_t batchSize) { _batchSize = batchSize; }
+
         /** \brief The CRA loop.
          *
          * \param Iteration  Function object of two arguments, \c
@@ -77,7 +104,7 @@ namespace LinBox {
          * returning the coefficients of the minimal polynomial of a
          * matrix \c mod \p p.
          *
-         * @warning  we won't detect bad primes.
+         * Bad primes are those for which \p Iteration returns SKIP or RESTART.
          *
          * \param primeGenerator  RandIter object for generating primes.
          * \param[out] res an integer
@@ -126,7 +153,7 @@ namespace LinBox {
             typename Domain::Element r;
 
             if (_pCommunicator->master()) {
-                master_process_task(Iteration, D, r);
+                master_process_task(Iteration, D, r, primeGenerator);
             }
             else {
                 worker_process_task(Iteration, r);
@@ -140,67 +167,173 @@ namespace LinBox {
             BlasVector<Domain> r(D);
 
             if (_pCommunicator->master()) {
-                master_process_task(Iteration, D, r);
+                master_process_task(Iteration, D, r, primeGenerator);
             }
             else {
                 worker_process_task(Iteration, r);
             }
         }
 
-        template <class Any, class PrimeIterator, class Function>
-        void worker_compute(PrimeIterator& gen, Function& Iteration, Any& r)
+    protected:
+        /// Computes the residues of a batch of primes with all the threads of the node.
+        template <class Any, class Function>
+        void worker_compute(std::vector<Domain>& domains, std::vector<Any>& residues,
+                            std::vector<IterationResult>& results, Function& Iteration)
         {
-            // Process mutual independent prime number generation
-            ++gen;
-            while (Builder_.noncoprime(*gen)) {
-                ++gen;
+            const size_t NN = domains.size();
+            SYNCH_GROUP(
+            for (size_t i = 0; i < NN; ++i) {
+                { TASK(MODE(CONSTREFERENCE(domains, residues, results)
+                            WRITE(results[i], residues[i])),
+                {
+                    results[i] = Iteration(residues[i], domains[i]);
+                })}
             }
-
-            Domain D(*gen);
-            Iteration(r, D);
+            )
         }
 
         template <class Any, class Function>
         void worker_process_task(Function& Iteration, Any& r)
         {
-            MaskedPrimeGenerator gen(_pCommunicator->rank() - 1, _pCommunicator->size() - 1);
+            const uint64_t wanted = (_batchSize > 0) ? _batchSize : std::max<size_t>(1, NUM_THREADS);
+            const size_t roundSize = std::max<size_t>(1, NUM_THREADS);
+
+            bool stopped = false;
+            while (!stopped) {
+                _pCommunicator->send(wanted, 0, TagRequest);
+
+                // Either a batch or the stop
+                _pCommunicator->probe(0, MPI_ANY_TAG);
+                if (_pCommunicator->status().MPI_TAG == TagStop) {
+                    break;
+                }
+
+                uint64_t count = 0;
+                _pCommunicator->recv(count, 0, TagBatch);
+                std::vector<uint64_t> primes(count);
+                for (auto& p : primes) {
+                    _pCommunicator->recv(p, 0, TagBatch);
+                }
+
+                // Rounds of one prime per thread, checking for the stop in between
+                for (size_t k = 0; k < primes.size() && !stopped; k += roundSize) {
+                    const size_t NN = std::min(roundSize, primes.size() - k);
+                    std::vector<Domain> domains;
+                    domains.reserve(NN);
+                    for (size_t i = 0; i < NN; ++i) {
+                        domains.emplace_back(primes[k + i]);
+                    }
+                    std::vector<Any> residues(NN, r);
+                    std::vector<IterationResult> results(NN);
 
-            // Each worker will work until _workerHadamardLogBound is hit
-            double primesLogSum = 0.0;
-            while (primesLogSum < _workerHadamardLogBound) {
-                worker_compute(gen, Iteration, r);
+                    worker_compute(domains, residues, results, Iteration);
 
-                uint64_t p = *gen;
-                primesLogSum += Givaro::logtwo(p);
-                _pCommunicator->send(p, 0);
-                _pCommunicator->send(r, 0);
+                    // As in ChineseRemainderParallel, a RESTART in the round restarts the
+                    // builder and the other good residues of the round are folded after it.
+                    // Messages to the master are not overtaking, so the restart comes first.
+                    const size_t restart = std::find(results.begin(), results.end(), IterationResult::RESTART) - results.begin();
+                    if (restart < NN) {
+                        _pCommunicator->isend(primes[k + restart], 0, TagRestart);
+                        _pCommunicator->isend(residues[restart], 0, TagRestart);
+                    }
+                    for (size_t i = 0; i < NN; ++i) {
+                        // Bad primes are simply not reported
+                        if (i == restart || results[i] == IterationResult::SKIP) continue;
+                        _pCommunicator->isend(primes[k + i], 0, TagResidue);
+                        _pCommunicator->isend(residues[i], 0, TagResidue);
+                    }
+
+                    stopped = _pCommunicator->iprobe(0, TagStop);
+                }
             }
 
-            uint64_t poisonPill = 0;
-            _pCommunicator->send(poisonPill, 0);
+            uint64_t stop = 0;
+            _pCommunicator->recv(stop, 0, TagStop);
+            _pCommunicator->waitall();
+            _pCommunicator->send(stop, 0, TagDone);
         }
 
-        template <class Any, class Function>
-        void master_process_task(Function& Iteration, Domain& D, Any& r)
+        template <class Any, class Function, class PrimeIterator>
+        void master_process_task(Function& Iteration, Domain& D, Any& r, PrimeIterator& primeGenerator)
         {
-            Iteration(r, D);
+            // Primes handed out, whose residues may not be folded yet
+            std::unordered_set<uint64_t> used;
+            used.insert(uint64_t(*primeGenerator));
+
+            // The first residue seeds the builder: a bad prime cannot
+            int nskip = 0;
+            while (Iteration(r, D) == IterationResult::SKIP) {
+                commentator().report(Commentator::LEVEL_IMPORTANT, INTERNAL_WARNING) << "bad prime, skipping\n";
+                if (++nskip > MAXSKIP) {
+                    throw LinboxError("LinBox ERROR: ran out of good primes in CRA\n");
+                }
+                ++primeGenerator;
+                used.insert(uint64_t(*primeGenerator));
+                D = Domain(*primeGenerator);
+            }
             Builder_.initialize(D, r);
 
-            uint32_t workersDone = _pCommunicator->size() - 1;
-            while (workersDone > 0) {
-                // Receive the prime
-                uint64_t p;
-                _pCommunicator->recv(p, MPI_ANY_SOURCE);
-                if (p == 0) {
-                    workersDone -= 1;
-                    continue;
+            uint32_t workersRunning = _pCommunicator->size() - 1;
+            bool stopped = false;
+
+            auto stopAll = [&]() {
+                uint64_t stop = 0;
+                for (int w = 1; w < _pCommunicator->size(); ++w) {
+                    _pCommunicator->send(stop, w, TagStop);
                 }
+                stopped = true;
+            };
 
-                // Receive result vector and update builder
-                _pCommunicator->recv(r, _pCommunicator->status().MPI_SOURCE);
+            if (Builder_.terminated()) stopAll();
 
-                Domain D(p);
-                Builder_.progress(D, r);
+            while (workersRunning > 0) {
+                _pCommunicator->probe(MPI_ANY_SOURCE, MPI_ANY_TAG);
+                const int source = _pCommunicator->status().MPI_SOURCE;
+                const int tag = _pCommunicator->status().MPI_TAG;
+
+                if (tag == TagRequest) {
+                    uint64_t count = 0;
+                    _pCommunicator->recv(count, source, TagRequest);
+                    // The worker will get the stop instead
+                    if (stopped) continue;
+
+                    std::vector<uint64_t> primes;
+                    while (primes.size() < count) {
+                        ++primeGenerator;
+                        uint64_t p = *primeGenerator;
+                        if (used.count(p) || Builder_.noncoprime(p)) continue;
+                        used.insert(p);
+                        primes.push_back(p);
+                    }
+
+                    _pCommunicator->send(count, source, TagBatch);
+                    for (auto p : primes) {
+                        _pCommunicator->send(p, source, TagBatch);
+                    }
+                }
+                else if (tag == TagResidue || tag == TagRestart) {
+                    uint64_t p = 0;
+                    _pCommunicator->recv(p, source, tag);
+                    _pCommunicator->recv(r, source, tag);
+                    // Residues still in flight after the stop are dropped
+                    if (stopped) continue;
+
+                    Domain Dp(p);
+                    if (tag == TagRestart) {
+                        commentator().report(Commentator::LEVEL_IMPORTANT, INTERNAL_WARNING)
+                            << "previous primes were bad; restarting\n";
+                        Builder_.initialize(Dp, r);
+                    }
+                    else {
+                        Builder_.progress(Dp, r);
+                    }
+                    if (Builder_.terminated()) stopAll();
+                }
+                else if (tag == TagDone) {
+                    uint64_t done = 0;
+                    _pCommunicator->recv(done, source, TagDone);
+                    workersRunning -= 1;
+                }
             }
         }
     };
@@ -35,8 +35,14 @@
  * we fall back to ChineseRemainderSequential
  */
 
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include "linbox/integer.h"
 #include "linbox/field/rebind.h"
+#include "linbox/util/timer.h"
 #include "linbox/vector/vector.h"
 
 namespace LinBox
@@ -100,6 +106,54 @@ namespace LinBox
             return ResidueType<Domain>(d);
 		}
 	};
+
+	/** \brief CRA iteration recording the cost of each prime.
+	 * \ingroup CRA
+	 *
+	 * Wraps an iteration function object and records, for every call,
+	 * the prime and the elapsed time of the modular computation. Calls
+	 * may come from concurrent tasks of ChineseRemainderParallel.
+	 */
+	template <class Function>
+	struct CRATimedIteration {
+		Function& Iteration;
+		std::vector<std::pair<Integer, double> > costs; //!< (prime, seconds) per call
+
+		CRATimedIteration(Function& f) :
+			Iteration(f)
+		{}
+
+		template <class Residue, class Field>
+		IterationResult operator()(Residue& r, const Field& F)
+		{
+			Timer chrono;
+			chrono.start();
+			IterationResult res = Iteration(r, F);
+			chrono.stop();
+			Integer p;
+			F.characteristic(p);
+			std::lock_guard<std::mutex> lock(mutex_);
+			costs.emplace_back(p, chrono.realtime());
+			return res;
+		}
+
+		/// Number of primes, mean and max time per prime.
+		std::ostream& report(std::ostream& os) const
+		{
+			double total = 0.0, most = 0.0;
+			for (const auto& c : costs) {
+				total += c.second;
+				most = std::max(most, c.second);
+			}
+			os << "Primes: " << costs.size();
+			if (costs.size())
+				os << ", mean: " << total / double(costs.size()) << "s, max: " << most << "s, total: " << total << 's';
+			return os;
+		}
+
+	protected:
+		std::mutex mutex_;
+	};
 }
 
 #ifdef __LINBOX_USE_OPENMP
@@ -0,0 +1,389 @@
+/*
+ * Copyright (C) 2026 The LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "../rational-solver.h"
+
+namespace LinBox {
+
+    /** \brief Certified dense Dixon solves of many right-hand sides with the same matrix.
+     *
+     * DixonSolver<..., Method::DenseElimination>::monolithicSolve factors
+     * (A|b) modulo p, inverts the leading minor, reduces the minor over the
+     * integers for the residue updates and, for the certificates, transposes
+     * all of it again, at each call. A session does that work once, on A
+     * alone:
+     *  - the PLUQ factorisation of A^T mod p gives the rank r and a
+     *    nonsingular minor M = A[I, J];
+     *  - M^-1 and M^-T mod p, M and M^T over the integers, the rows A[I, *]
+     *    and A[~I, J] mod p are kept;
+     *  - the lifting containers on M (solutions) and on M^T (certificates)
+     *    are created at their first use and then only restarted on the new
+     *    right-hand side, so that the setup of their residue update and the
+     *    norms of the matrix are not recomputed.
+     *
+     * A right-hand side is then checked for consistency modulo p with
+     * O(mr) operations, and only the p-adic lifting and the reconstruction
+     * are paid per call. The solution is the deterministic one (zero
+     * outside of the columns J) whatever method.singularSolutionType says:
+     * a random solution needs a fresh conditioner per call.
+     *
+     * When a prime turns out to be bad (a certificate does not verify, or
+     * the result check fails), the session factors A again modulo another
+     * prime and keeps it for the next calls.
+     */
+    template <class Ring, class Field, class RandomPrime>
+    class DixonSolverSession {
+    public:
+        typedef typename Ring::Element Integer_t;
+        typedef typename Field::Element Element;
+        typedef typename RandomPrime::Prime_Type Prime;
+        typedef DixonLiftingContainer<Ring, Field, BlasMatrix<Ring>, BlasMatrix<Field>> LiftingContainer;
+
+        /// Same meaning as in DixonSolver<..., Method::DenseElimination>, updated by each solve.
+        VectorFraction<Ring> lastCertificate;
+        Integer_t lastZBNumer;
+        Integer_t lastCertifiedDenFactor;
+
+    protected:
+        Ring _ring;
+        Field _field;
+        RandomPrime _genprime;
+        Prime _prime;
+        Method::Dixon _method;
+
+        BlasMatrix<Ring> _A;
+        std::unique_ptr<TransposeAugmentedSystem<Field>> _tas;
+        size_t _rank = 0;
+
+        std::unique_ptr<BlasMatrix<Field>> _Ap_minor_inv;  // M^-1 mod p
+        std::unique_ptr<BlasMatrix<Field>> _Atp_minor_inv; // M^-T mod p
+        std::unique_ptr<BlasMatrix<Field>> _Ap_rest;       // A[~I, J] mod p
+        std::unique_ptr<BlasMatrix<Ring>> _A_minor;        // M
+        std::unique_ptr<BlasMatrix<Ring>> _At_minor;       // M^T
+        std::unique_ptr<BlasMatrix<Ring>> _B;              // A[I, *]
+
+        std::unique_ptr<LiftingContainer> _lc;  // on M
+        std::unique_ptr<LiftingContainer> _lcT; // on M^T
+
+    public:
+        /** Factors A modulo a first prime.
+         * @param A       integer matrix of the systems, copied
+         * @param method  certifyInconsistency, certifyMinimalDenominator,
+         *                checkResult and trialsBeforeFailure are used
+         * @param r       a Ring, set by default
+         * @param rp      a RandomPrime generator, set by default
+         */
+        template <class IMatrix>
+        DixonSolverSession(const IMatrix& A, const Method::Dixon& method = Method::Dixon(), const Ring& r = Ring(),
+                           const RandomPrime& rp = RandomPrime())
+            : lastCertificate(r, 0)
+            , _ring(r)
+            , _genprime(rp)
+            , _method(method)
+            , _A(A)
+        {
+            if (_method.certifyMinimalDenominator) _method.certifyInconsistency = true;
+            _genprime.setBits(FieldTraits<Field>::bestBitSize());
+            _prime = *_genprime;
+            factor();
+        }
+
+        /// Rank of A modulo the current prime.
+        size_t rank() const { return _rank; }
+
+        /// The current prime.
+        const Prime& prime() const { return _prime; }
+
+        /** Solve \c Ax=b with the factorisations of the session.
+         *
+         * @param num  Vector of numerators of the solution, of size A.coldim()
+         * @param den  The common denominator
+         * @param b    Right-hand side, of size A.rowdim()
+         *
+         * @return as DixonSolver::monolithicSolve:
+         *  - \c SS_OK  solution found, \c lastCertifiedDenFactor, \c lastZBNumer
+         *    and \c lastCertificate are set if method.certifyMinimalDenominator;
+         *    they are the trivial certificate (zero, factor 1) if it could
+         *    not be made;
+         *  - \c SS_INCONSISTENT  the certificate is in \c lastCertificate if
+         *    method.certifyInconsistency;
+         *  - \c SS_FAILED  all the primes tried were bad.
+         */
+        template <class Vector1, class Vector2>
+        SolverReturnStatus solve(Vector1& num, Integer_t& den, const Vector2& b)
+        {
+            linbox_check(b.size() == _A.rowdim());
+            linbox_check(num.size() == _A.coldim());
+
+            for (size_t trials = 0; trials < _method.trialsBeforeFailure; ++trials) {
+                if (trials != 0) {
+                    ++_genprime;
+                    _prime = *_genprime;
+                    factor();
+                }
+                SolverReturnStatus status = solveModPrime(num, den, b);
+                if (status != SS_FAILED) return status;
+                commentator().report(Commentator::LEVEL_IMPORTANT, PARTIAL_RESULT)
+                    << "bad prime " << _prime << " for the session, factoring again" << std::endl;
+            }
+            return SS_FAILED;
+        }
+
+    protected:
+        /// Factorisations and minors of A modulo _prime.
+        void factor()
+        {
+            // the containers refer to the minors and to the field
+            _lc.reset();
+            _lcT.reset();
+
+            const size_t m = _A.rowdim(), n = _A.coldim();
+            MatrixDomain<Ring> MD(_ring);
+            for (;;) {
+                _field = Field(_prime);
+                BlasVector<Ring> zero(_ring, m);
+                _tas.reset(new TransposeAugmentedSystem<Field>(_ring, _field, _A, zero));
+                _rank = _tas->rank();
+                // A == 0 mod p but not over Z: the prime divides all the entries
+                if (_rank > 0 || !_method.certifyInconsistency || MD.isZero(_A)) break;
+                ++_genprime;
+                _prime = *_genprime;
+            }
+            if (_rank == 0) return;
+
+            const size_t r = _rank;
+            const std::vector<size_t>& srcRow = _tas->srcRow;
+            const std::vector<size_t>& srcCol = _tas->srcCol;
+
+            // the leading minor of the factors of A^T is M^T: invert it from L\U
+            _Atp_minor_inv.reset(new BlasMatrix<Field>(_field, r, r));
+            FFLAS::fassign(_field, r, r, _tas->factors->getPointer(), _tas->factors->getStride(), _Atp_minor_inv->getPointer(),
+                           _Atp_minor_inv->getStride());
+            FFPACK::ftrtri(_field, FFLAS::FflasUpper, FFLAS::FflasNonUnit, r, _Atp_minor_inv->getPointer(), _Atp_minor_inv->getStride());
+            FFPACK::ftrtri(_field, FFLAS::FflasLower, FFLAS::FflasUnit, r, _Atp_minor_inv->getPointer(), _Atp_minor_inv->getStride());
+            FFPACK::ftrtrm(_field, FFLAS::FflasLeft, FFLAS::FflasNonUnit, r, _Atp_minor_inv->getPointer(), _Atp_minor_inv->getStride());
+
+            _Ap_minor_inv.reset(new BlasMatrix<Field>(_field, r, r));
+            for (size_t i = 0; i < r; ++i)
+                for (size_t j = 0; j < r; ++j) _Ap_minor_inv->setEntry(i, j, _Atp_minor_inv->getEntry(j, i));
+
+            _A_minor.reset(new BlasMatrix<Ring>(_ring, r, r));
+            _At_minor.reset(new BlasMatrix<Ring>(_ring, r, r));
+            for (size_t i = 0; i < r; ++i)
+                for (size_t j = 0; j < r; ++j) {
+                    _ring.assign(_A_minor->refEntry(i, j), _A.getEntry(srcRow[i], srcCol[j]));
+                    _ring.assign(_At_minor->refEntry(j, i), _A_minor->getEntry(i, j));
+                }
+
+            _B.reset(new BlasMatrix<Ring>(_ring, r, n));
+            for (size_t i = 0; i < r; ++i)
+                for (size_t j = 0; j < n; ++j) _ring.assign(_B->refEntry(i, j), _A.getEntry(srcRow[i], j));
+
+            Integer tmp;
+            _Ap_rest.reset(new BlasMatrix<Field>(_field, m - r, r));
+            for (size_t i = r; i < m; ++i)
+                for (size_t j = 0; j < r; ++j)
+                    _field.init(_Ap_rest->refEntry(i - r, j), _ring.convert(tmp, _A.getEntry(srcRow[i], srcCol[j])));
+        }
+
+        /// Lifts the solution of M y = rhs (transposed: M^T y = rhs), reusing the container.
+        template <class Vector>
+        bool lift(BlasVector<Ring>& ynum, Integer_t& yden, const Vector& rhs, bool transposed)
+        {
+            std::unique_ptr<LiftingContainer>& lc = transposed ? _lcT : _lc;
+            if (lc == nullptr)
+                lc.reset(new LiftingContainer(_ring, _field, transposed ? *_At_minor : *_A_minor,
+                                              transposed ? *_Atp_minor_inv : *_Ap_minor_inv, rhs, _prime));
+            else
+                lc->resetRightHandSide(rhs);
+
+            RationalReconstruction<LiftingContainer> re(*lc);
+            return re.getRational(ynum, yden, 0);
+        }
+
+        /// Index in 0..m-r-1 of the first row of A[~I, *] on which b is inconsistent mod p, m-r if none.
+        template <class Vector2>
+        size_t firstInconsistentRow(const Vector2& b) const
+        {
+            const size_t m = _A.rowdim(), r = _rank;
+            if (r == m) return m - r;
+
+            Integer tmp;
+            BlasVector<Field> bI(_field, r), y(_field, r), z(_field, m - r);
+            for (size_t i = 0; i < r; ++i) _field.init(bI[i], _ring.convert(tmp, b[_tas->srcRow[i]]));
+
+            BlasApply<Field> BAF(_field);
+            BAF.applyV(y, *_Ap_minor_inv, bI);
+            BAF.applyV(z, *_Ap_rest, y);
+
+            Element bi;
+            for (size_t i = 0; i < m - r; ++i) {
+                _field.init(bi, _ring.convert(tmp, b[_tas->srcRow[r + i]]));
+                if (!_field.areEqual(bi, z[i])) return i;
+            }
+            return m - r;
+        }
+
+        template <class Vector1, class Vector2>
+        SolverReturnStatus solveModPrime(Vector1& num, Integer_t& den, const Vector2& b)
+        {
+            const size_t m = _A.rowdim(), n = _A.coldim(), r = _rank;
+
+            // ----- A == 0 mod p, and over Z in certified mode
+            if (r == 0) {
+                size_t i = 0;
+                while (i < m && _ring.isZero(b[i])) ++i;
+                if (i < m) {
+                    if (_method.certifyInconsistency) {
+                        VectorFraction<Ring> cert(_ring, m);
+                        _ring.assign(cert.numer[i], _ring.one);
+                        _ring.assign(cert.denom, _ring.one);
+                        lastCertificate.copy(cert);
+                    }
+                    return SS_INCONSISTENT;
+                }
+                for (size_t j = 0; j < n; ++j) _ring.assign(num[j], _ring.zero);
+                _ring.assign(den, _ring.one);
+                if (_method.certifyMinimalDenominator) trivialCertificate();
+                return SS_OK;
+            }
+
+            const std::vector<size_t>& srcRow = _tas->srcRow;
+            const std::vector<size_t>& srcCol = _tas->srcCol;
+            BlasApply<Ring> BAR(_ring);
+
+            // ----- Certifying inconsistency: u = (w, -1) on the rows (I, i) with M^T w = A[i, J]^T
+            const size_t k = firstInconsistentRow(b);
+            if (k < m - r) {
+                if (!_method.certifyInconsistency) return SS_INCONSISTENT;
+
+                BlasVector<Ring> zt(_ring, r), wnum(_ring, r);
+                Integer_t wden;
+                for (size_t j = 0; j < r; ++j) _ring.assign(zt[j], _A.getEntry(srcRow[r + k], srcCol[j]));
+                if (!lift(wnum, wden, zt, true)) return SS_FAILED;
+
+                VectorFraction<Ring> cert(_ring, m);
+                for (size_t j = 0; j < r; ++j) _ring.assign(cert.numer[srcRow[j]], wnum[j]);
+                _ring.neg(cert.numer[srcRow[r + k]], wden);
+                _ring.assign(cert.denom, _ring.one);
+
+                BlasVector<Ring> certnumer_A(_ring, n);
+                BAR.applyVTrans(certnumer_A, _A, cert.numer);
+                for (size_t j = 0; j < n; ++j)
+                    if (!_ring.isZero(certnumer_A[j])) return SS_FAILED; // A[i, *] is not in the span of A[I, *]
+
+                lastCertificate.copy(cert);
+                return SS_INCONSISTENT;
+            }
+
+            // ----- Lifting on the minor, y = M^-1 b[I]
+            BlasVector<Ring> newb(_ring, r), ynum(_ring, r);
+            for (size_t i = 0; i < r; ++i) _ring.assign(newb[i], b[srcRow[i]]);
+            if (!lift(ynum, den, newb, false)) return SS_FAILED;
+
+            for (size_t j = 0; j < n; ++j) _ring.assign(num[j], _ring.zero);
+            for (size_t j = 0; j < r; ++j) _ring.assign(num[srcCol[j]], ynum[j]);
+
+            if (_method.checkResult) {
+                BlasVector<Ring> A_times_xnumer(_ring, m);
+                BAR.applyV(A_times_xnumer, _A, num);
+                Integer_t tmpi;
+                for (size_t i = 0; i < m; ++i)
+                    if (!_ring.areEqual(_ring.mul(tmpi, b[i], den), A_times_xnumer[i])) return SS_FAILED;
+            }
+
+            if (_method.certifyMinimalDenominator) certifyMinimalDenominator(b);
+
+            return SS_OK;
+        }
+
+        /// As DixonSolver::certifyMinimalDenominator, on the kept M^T and M^-T mod p.
+        template <class Vector2>
+        void certifyMinimalDenominator(const Vector2& b)
+        {
+            const size_t m = _A.rowdim(), n = _A.coldim(), r = _rank;
+
+            // q in {0, 1}^rank
+            BlasVector<Ring> q(_ring, r);
+            bool allzero;
+            do {
+                allzero = true;
+                for (size_t i = 0; i < r; ++i) {
+                    if (rand() > RAND_MAX / 2) {
+                        _ring.assign(q[i], _ring.one);
+                        allzero = false;
+                    }
+                    else
+                        _ring.assign(q[i], _ring.zero);
+                }
+            } while (allzero);
+
+            BlasVector<Ring> u_num(_ring, r);
+            Integer_t u_den;
+            if (!lift(u_num, u_den, q, true)) {
+                trivialCertificate();
+                return;
+            }
+
+            // z <- denom(u . B) * u, with u spread on the rows I
+            BlasApply<Ring> BAR(_ring);
+            BlasVector<Ring> uB(_ring, n);
+            BAR.applyVTrans(uB, *_B, u_num);
+
+            Integer_t numergcd = _ring.zero;
+            vectorGcdIn(numergcd, _ring, uB);
+
+            VectorFraction<Ring> z(_ring, m);
+            for (size_t i = 0; i < r; ++i) _ring.assign(z.numer[_tas->srcRow[i]], u_num[i]);
+            z.denom = numergcd;
+            lastCertificate.copy(z);
+
+            // output new certified denom factor
+            Integer_t znumer_b, zbgcd;
+            VectorDomain<Ring> VDR(_ring);
+            VDR.dotprod(znumer_b, z.numer, b);
+            _ring.gcd(zbgcd, znumer_b, z.denom);
+            _ring.div(lastCertifiedDenFactor, z.denom, zbgcd);
+            _ring.div(lastZBNumer, znumer_b, zbgcd);
+        }
+
+        /// Certificate z = 0, which certifies the factor 1 of any denominator.
+        void trivialCertificate()
+        {
+            lastCertificate.clearAndResize(_A.rowdim());
+            _ring.assign(lastZBNumer, _ring.zero);
+            _ring.assign(lastCertifiedDenFactor, _ring.one);
+        }
+    };
+}
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,256 @@
+/* linbox/algorithms/four-russians-gf2.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/four-russians-gf2.h
+ * @ingroup algorithms
+ * @brief Dense elimination over GF(2) by the Method of Four Russians
+ */
+
+#ifndef __LINBOX_four_russians_gf2_H
+#define __LINBOX_four_russians_gf2_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace LinBox
+{
+
+	/** \brief Dense matrix over GF(2), 64 entries per word, row major
+	 *
+	 * Used as the dense tail of sparse elimination over GF(2) (see
+	 * GaussDomain<GF2>): rows are contiguous runs of
+	 * <code>stride()</code> words, so that adding a row to another is a
+	 * word loop.
+	 */
+	class PackedMatrixGF2 {
+	public:
+		typedef uint64_t Word;
+
+		PackedMatrixGF2 (size_t m = 0, size_t n = 0) :
+			_rowdim (m), _coldim (n), _stride ((n + 63) / 64), _data (m * _stride, Word (0))
+		{}
+
+		size_t rowdim () const { return _rowdim; }
+		size_t coldim () const { return _coldim; }
+		size_t stride () const { return _stride; }
+
+		Word *row (size_t i) { return _data.data () + i * _stride; }
+		const Word *row (size_t i) const { return _data.data () + i * _stride; }
+
+		bool getEntry (size_t i, size_t j) const
+		{
+			return (row (i)[j / 64] >> (j % 64)) & 1;
+		}
+
+		void setEntry (size_t i, size_t j, bool a)
+		{
+			const Word bit = Word (1) << (j % 64);
+
+			if (a)
+				row (i)[j / 64] |= bit;
+			else
+				row (i)[j / 64] &= ~bit;
+		}
+
+		void swapRows (size_t i, size_t j)
+		{
+			if (i != j)
+				std::swap_ranges (row (i), row (i) + _stride, row (j));
+		}
+
+		/** Row echelon form by the Method of Four Russians.
+		 *
+		 * Columns are processed by strips of \f$k\f$: a plain
+		 * elimination finds the pivots of the strip, then the
+		 * \f$2^k\f$ sums of the pivot rows are tabulated, one row
+		 * addition per entry, and every other row is cleared on the strip
+		 * by a single table lookup (M4RI). The table is applied by
+		 * stripes of words so that the part in use stays in cache.
+		 *
+		 * @param pivots on return, pivots[i] is the pivot column of row
+		 *        i; pivot columns are increasing
+		 * @param reduced also clear the pivot columns above the pivots
+		 * @param pivotCols only columns before pivotCols are pivots; the
+		 *        next ones (right-hand sides) are only carried along
+		 * @return the rank
+		 */
+		size_t echelonize (std::vector<size_t> &pivots, bool reduced = false, size_t pivotCols = size_t (-1))
+		{
+			pivotCols = std::min (pivotCols, _coldim);
+			pivots.clear ();
+
+			const size_t k = stripWidth ();
+			std::vector<size_t> pc (k);
+			std::vector<Word> T;
+			std::vector<uint32_t> index (_rowdim);
+
+			size_t r = 0;
+			for (size_t c = 0; c < pivotCols && r < _rowdim; c += k) {
+				const size_t kk = std::min (k, pivotCols - c);
+				const size_t found = gaussStrip (r, c, kk, pc.data ());
+
+				if (found == 0)
+					continue;
+
+				for (size_t l = 0; l < found; ++l)
+					pivots.push_back (pc[l]);
+
+				// Sums of the pivot rows, indexed by the bits of the strip
+				const size_t w0 = c / 64, width = _stride - w0;
+				const size_t entries = size_t (1) << kk;
+				std::vector<const Word *> pivotOf (kk, (const Word *) 0);
+				for (size_t l = 0; l < found; ++l)
+					pivotOf[pc[l] - c] = row (r + l) + w0;
+
+				T.assign (entries * width, Word (0));
+				for (size_t g = 1; g < entries; ++g) {
+					size_t b = 0;
+					while (!((g >> b) & 1))
+						++b;
+
+					Word *t = &T[g * width];
+					const Word *s = &T[(g & (g - 1)) * width];
+					if (pivotOf[b] != 0) {
+						const Word *p = pivotOf[b];
+						for (size_t w = 0; w < width; ++w)
+							t[w] = s[w] ^ p[w];
+					}
+					else
+						std::copy (s, s + width, t);
+				}
+
+				// Rows to clear: below the strip pivots, and above if reduced
+				const size_t first = reduced ? 0 : r + found;
+				for (size_t i = first; i < _rowdim; ++i)
+					index[i] = (i >= r && i < r + found) ? 0 : readBits (i, c, kk);
+
+				const size_t stripe = std::max<size_t> (1, (size_t (1) << 14) / entries);
+				for (size_t s0 = 0; s0 < width; s0 += stripe) {
+					const size_t s1 = std::min (width, s0 + stripe);
+
+					for (size_t i = first; i < _rowdim; ++i) {
+						if (index[i] == 0)
+							continue;
+
+						Word *x = row (i) + w0;
+						const Word *t = &T[index[i] * width];
+						for (size_t w = s0; w < s1; ++w)
+							x[w] ^= t[w];
+					}
+				}
+
+				r += found;
+			}
+
+			return r;
+		}
+
+	protected:
+
+		/// Strip width k, about 3/4 log2 of the dimension, at most 10
+		size_t stripWidth () const
+		{
+			size_t d = std::min (_rowdim, _coldim), l = 0;
+			while (d > 1) {
+				d >>= 1;
+				++l;
+			}
+			return std::max<size_t> (1, std::min<size_t> (10, (3 * l) / 4));
+		}
+
+		/// Bits c, ..., c + k - 1 of row i
+		uint32_t readBits (size_t i, size_t c, size_t k) const
+		{
+			const Word *x = row (i);
+			const size_t w = c / 64, off = c % 64;
+
+			Word v = x[w] >> off;
+			if (off + k > 64)
+				v |= x[w + 1] << (64 - off);
+
+			return uint32_t (v & ((Word (1) << k) - 1));
+		}
+
+		/** Pivots of columns c, ..., c + k - 1 among rows r, r + 1, ...
+		 * The pivot rows are moved to rows r, r + 1, ... and reduced with
+		 * respect to each other on the strip; candidate rows are reduced
+		 * lazily by the pivots already found.
+		 * @return the number of pivots found
+		 */
+		size_t gaussStrip (size_t r, size_t c, size_t k, size_t *pc)
+		{
+			const size_t w0 = c / 64;
+			size_t found = 0;
+
+			for (size_t j = c; j < c + k && r + found < _rowdim; ++j) {
+				for (size_t p = r + found; p < _rowdim; ++p) {
+					Word *x = row (p);
+
+					for (size_t l = 0; l < found; ++l)
+						if (getEntry (p, pc[l])) {
+							const Word *y = row (r + l);
+							for (size_t w = w0; w < _stride; ++w)
+								x[w] ^= y[w];
+						}
+
+					if (!getEntry (p, j))
+						continue;
+
+					swapRows (p, r + found);
+
+					const Word *y = row (r + found);
+					for (size_t l = 0; l < found; ++l)
+						if (getEntry (r + l, j)) {
+							Word *z = row (r + l);
+							for (size_t w = w0; w < _stride; ++w)
+								z[w] ^= y[w];
+						}
+
+					pc[found++] = j;
+					break;
+				}
+			}
+
+			return found;
+		}
+
+		size_t              _rowdim;
+		size_t              _coldim;
+		size_t              _stride;
+		std::vector<Word>   _data;
+	};
+
+} // namespace LinBox
+
+#endif // __LINBOX_four_russians_gf2_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
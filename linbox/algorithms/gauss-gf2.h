@@ -37,12 +37,19 @@
 #include "linbox/vector/vector-domain.h"
 #include "linbox/algorithms/gauss.h"
 #include "linbox/blackbox/zo-gf2.h"
+#include "linbox/algorithms/four-russians-gf2.h"
 
 /** @file algorithms/gauss-gf2.h
  * @brief  Gauss elimination and applications for sparse matrices on \f$F_2\f$.
  * Rank, nullspace, solve...
  */
 
+#ifndef LINBOX_GAUSS_GF2_DENSE_THRESHOLD
+/// Density of the active submatrix above which sparse elimination over
+/// \f$F_2\f$ finishes on a packed dense matrix (see GaussDomain<GF2>)
+#define LINBOX_GAUSS_GF2_DENSE_THRESHOLD 0.05
+#endif
+
 
 namespace LinBox
 {
@@ -59,12 +66,25 @@ namespace LinBox
 	public:
 
 		/** \brief The field parameter is the domain  over which to perform computations.
+		 *
+		 * Once the density of the active submatrix reaches \p denseThreshold,
+		 * the elimination converts it to a word-packed dense matrix and
+		 * finishes with the Method of Four Russians. A threshold above 1
+		 * keeps the elimination sparse throughout.
 		 */
-		GaussDomain (const Field &) {}
+		GaussDomain (const Field &, double denseThreshold = LINBOX_GAUSS_GF2_DENSE_THRESHOLD) :
+			_denseThreshold (denseThreshold)
+		{}
 
 		//Copy constructor
 		///
-		GaussDomain (const GaussDomain &)  {}
+		GaussDomain (const GaussDomain &G) :
+			_denseThreshold (G._denseThreshold)
+		{}
+
+		/// Density threshold of the dense tail
+		double denseThreshold () const { return _denseThreshold; }
+		void setDenseThreshold (double d) { _denseThreshold = d; }
 
 		/** accessor for the field of computation.
 		*/
@@ -178,13 +198,37 @@ namespace LinBox
 				 const Vector2& b, Random& generator) const;
 
 
+		/// Trailing rows finished by dense elimination
+		struct DenseTail {
+			size_t              row0;   ///< first row of A in the tail
+			size_t              rank0;  ///< the tail spans columns rank0, ..., Nj-1
+			size_t              rank;   ///< rank of the tail
+			PackedMatrixGF2     M;      ///< echelon form, right-hand side in the last column if any
+			std::vector<size_t> pivots; ///< pivot columns of M
+
+			DenseTail () : row0 (0), rank0 (0), rank (0) {}
+		};
+
+		/** Sparse elimination with reordering, finished on a dense tail
+		 * once the active submatrix is dense enough.
+		 * If \p rhs is given, its entries follow the row operations and
+		 * the tail is put in reduced echelon form with \p rhs as an extra
+		 * column. If \p tail is given it receives the dense tail; its
+		 * field M is empty when the elimination stayed sparse.
+		 * On return the first \p Rank rows of A are in row echelon form;
+		 * the rows of a dense tail are written back with their pivots at
+		 * columns rank0 + pivots[i], which P does not move onto the
+		 * diagonal, and its null rows are emptied.
+		 */
 		template <class SparseSeqMatrix, class Perm>
 		size_t& InPlaceLinearPivoting(size_t &Rank,
 						     Element& determinant,
 						     SparseSeqMatrix        &A,
 						     Perm                   &P,
 						     size_t Ni,
-						     size_t Nj) const;
+						     size_t Nj,
+						     std::vector<bool> *rhs = nullptr,
+						     DenseTail *tail = nullptr) const;
 		template <class SparseSeqMatrix>
 		size_t& NoReordering (size_t & Rank, Element& , SparseSeqMatrix &, size_t , size_t ) const
 		{
@@ -195,6 +239,26 @@ namespace LinBox
 
 	protected:
 
+		// Solve by elimination of [A|b] and back substitution; free
+		// variables take the values drawn by freeValue(bool&)
+		template <class SparseSeqMatrix, class Vector1, class Vector2, class FreeValue>
+		Vector1& hybridSolveInPlace(Vector1& x,
+					    SparseSeqMatrix        &A,
+					    const Vector2& b,
+					    FreeValue& freeValue) const;
+
+		// Dense elimination of rows k, ..., Ni-1 of A
+		template <class SparseSeqMatrix>
+		void denseTail (DenseTail &dense,
+				SparseSeqMatrix &A,
+				size_t k,
+				size_t Ni,
+				size_t Nj,
+				size_t Rank,
+				std::vector<bool> *rhs) const;
+
+		double _denseThreshold;
+
 		//-----------------------------------------
 		// Sparse elimination using a pivot row :
 		// lc <-- lc - lc[k]/lp[0] * lp
@@ -47,6 +47,7 @@
 #include "linbox/field/archetype.h"
 #include "linbox/field/gf2.h"
 #include "linbox/matrix/sparse-matrix.h"
+#include "linbox/matrix/sparsematrix/sparse-row-pool.h"
 #include "linbox/matrix/archetype.h"
 #include "linbox/solutions/methods.h"
 
@@ -181,7 +181,9 @@ namespace LinBox
 					// -------------------------------------------
 					// Elimination
 					size_t npiv = lignepivot.size ();
-					Vector construit (nj + npiv);
+					SparseRowPool<Vector> &pool = SparseRowPool<Vector>::local ();
+					Vector construit;
+					pool.acquire (construit, nj + npiv);
 
 					// construit : <-- j
 					// courante  : <-- m
@@ -253,7 +255,8 @@ namespace LinBox
 						construit[j++] = lignecourante[m++];
 
 					construit.resize (j);
-					lignecourante = construit;
+					lignecourante.swap (construit);
+					pool.release (construit);
 				}
 				else {
 					// -------------------------------------------
@@ -412,7 +415,9 @@ namespace LinBox
 					}
 					// -------------------------------------------
 					// Elimination
-					Vector construit (nj + npiv);
+					SparseRowPool<Vector> &pool = SparseRowPool<Vector>::local ();
+					Vector construit;
+					pool.acquire (construit, nj + npiv);
 
 					// construit : <-- j
 					// courante  : <-- m
@@ -487,7 +492,8 @@ namespace LinBox
 						construit[j++] = lignecourante[m++];
 
 					construit.resize (j);
-					lignecourante = construit;
+					lignecourante.swap (construit);
+					pool.release (construit);
 				}
 				else {
 					// -------------------------------------------
@@ -623,7 +629,9 @@ namespace LinBox
 					// -------------------------------------------
 					// Elimination
 					size_t npiv = lignepivot.size ();
-					Vector construit (nj + npiv);
+					SparseRowPool<Vector> &pool = SparseRowPool<Vector>::local ();
+					Vector construit;
+					pool.acquire (construit, nj + npiv);
 					// construit : <-- j
 					// courante  : <-- m
 					// pivot     : <-- l
@@ -686,7 +694,8 @@ namespace LinBox
 						construit[j++] = lignecourante[m++];
 
 					construit.resize (j);
-					lignecourante = construit;
+					lignecourante.swap (construit);
+					pool.release (construit);
 				}
 				else {
 					// -------------------------------------------
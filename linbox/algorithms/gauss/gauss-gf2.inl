@@ -45,6 +45,53 @@
 
 namespace LinBox
 {
+	template <class SparseSeqMatrix>
+	inline void
+	GaussDomain<GF2>::denseTail (DenseTail &dense,
+				     SparseSeqMatrix &LigneA,
+				     size_t k,
+				     size_t Ni,
+				     size_t Nj,
+				     size_t Rank,
+				     std::vector<bool> *rhs) const
+	{
+		// Rows k, ..., Ni-1 only have entries in columns Rank, ..., Nj-1
+		const size_t Rj = Nj - Rank;
+
+		commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
+		<< "Dense Four-Russians elimination of the trailing " << Ni - k << " x " << Rj << " submatrix" << std::endl;
+
+		dense.row0 = k;
+		dense.rank0 = Rank;
+		dense.M = PackedMatrixGF2 (Ni - k, Rj + (rhs != nullptr ? 1 : 0));
+
+		for (size_t i = k; i < Ni; ++i) {
+			for (size_t l = 0; l < LigneA[i].size(); ++l) {
+				linbox_check (LigneA[i][l] >= Rank);
+				dense.M.setEntry (i - k, LigneA[i][l] - Rank, true);
+			}
+			if ((rhs != nullptr) && (*rhs)[i])
+				dense.M.setEntry (i - k, Rj, true);
+		}
+
+		dense.rank = dense.M.echelonize (dense.pivots, rhs != nullptr, Rj);
+
+		// Write the echelon form back into rows k, ..., Ni-1: the tail
+		// pivots stay at columns Rank + pivots[i], the null rows are cleared
+		for (size_t i = k; i < Ni; ++i) {
+			size_t s = 0;
+			if (i - k < dense.rank) {
+				LigneA[i].resize (Rj);
+				for (size_t j = dense.pivots[i - k]; j < Rj; ++j)
+					if (dense.M.getEntry (i - k, j))
+						LigneA[i][s++] = Rank + j;
+			}
+			LigneA[i].resize (s);
+			if (rhs != nullptr)
+				(*rhs)[i] = dense.M.getEntry (i - k, Rj);
+		}
+	}
+
 	// Specialization over GF2
 	template <class SparseSeqMatrix, class Perm>
 	inline size_t&
@@ -53,7 +100,9 @@ namespace LinBox
 						 SparseSeqMatrix        &LigneA,
 						 Perm           &P,
 						 size_t Ni,
-						 size_t Nj) const
+						 size_t Nj,
+						 std::vector<bool> *rhs,
+						 DenseTail *tail) const
 	{
 		// Requirements : LigneA is an array of sparse rows
 		// In place (LigneA is modified)
@@ -74,14 +123,23 @@ namespace LinBox
 
 
 		// assignment of LigneA with the domain object
-		for (size_t jj = 0; jj < Ni; ++jj)
+		// nnz is the number of entries of the active rows
+		size_t nnz = 0;
+		for (size_t jj = 0; jj < Ni; ++jj) {
 			for (size_t k = 0; k < LigneA[jj].size(); ++k)
 				++col_density[LigneA[jj][k]];
+			nnz += LigneA[jj].size();
+		}
 
 		long last = (long)Ni - 1;
 		long c;
 		Rank = 0;
 
+		DenseTail localTail;
+		DenseTail &dense = (tail != nullptr) ? *tail : localTail;
+		dense = DenseTail();
+		bool switched = false;
+
 #ifdef __LINBOX_OFTEN__
 		long sstep = last/40;
 		if (sstep > __LINBOX_OFTEN__) sstep = __LINBOX_OFTEN__;
@@ -94,6 +152,15 @@ namespace LinBox
 		for (long k = 0; k < last; ++k, ++LigneA_k) {
 			long p = k, s = 0;
 
+			// Switch to dense elimination once the fill-in is high enough
+			const size_t Ri = Ni - (size_t)k, Rj = Nj - Rank;
+			if ((Ri >= 64) && (Rj >= 64) && (double(nnz) >= _denseThreshold * double(Ri) * double(Rj))) {
+				denseTail (dense, LigneA, (size_t)k, Ni, Nj, Rank, rhs);
+				Rank += dense.rank;
+				switched = true;
+				break;
+			}
+
 #ifdef __LINBOX_FILLIN__
 			if ( ! (k % 100) )
 #else
@@ -136,8 +203,14 @@ namespace LinBox
 				if (p != k) {
 					//                         std::cerr << "Permuting rows: " << k << " <--> " << p << std::endl;
 					std::swap( *LigneA_k, LigneA[(size_t)p]);
+					if (rhs != nullptr) {
+						const bool t = (*rhs)[(size_t)k];
+						(*rhs)[(size_t)k] = (*rhs)[(size_t)p];
+						(*rhs)[(size_t)p] = t;
+					}
 				}
 
+				nnz -= LigneA_k->size();
 
 				SparseFindPivotBinary (*LigneA_k, Rank, c, col_density, determinant);
 
@@ -151,7 +224,11 @@ namespace LinBox
 					long npiv=(long)LigneA_k->size();
 					for (ll = k+1; ll < static_cast<long>(Ni); ++ll) {
 						bool elim=false;
+						const size_t before = LigneA[(size_t)ll].size();
 						eliminateBinary (elim, LigneA[(size_t)ll], *LigneA_k, Rank, c, (size_t)npiv, col_density);
+						nnz = nnz + LigneA[(size_t)ll].size() - before;
+						if (elim && (rhs != nullptr) && (*rhs)[(size_t)k])
+							(*rhs)[(size_t)ll] = !(*rhs)[(size_t)ll];
 					}
 				}
 
@@ -163,12 +240,14 @@ namespace LinBox
 			// LigneA.write(rep << "U:= ", Tag::FileFormat::Maple) << std::endl;
 		}//for k
 
-		SparseFindPivotBinary ( LigneA[(size_t)last], Rank, c, determinant);
-		if (c != -1) {
-			if ( c != (static_cast<long>(Rank)-1) ) {
-				P.permute(Rank-1,(size_t)c);
-				for (long ll=0      ; ll < last ; ++ll)
-					permuteBinary( LigneA[(size_t)ll], Rank, c);
+		if (!switched && (Ni > 0)) {
+			SparseFindPivotBinary ( LigneA[(size_t)last], Rank, c, determinant);
+			if (c != -1) {
+				if ( c != (static_cast<long>(Rank)-1) ) {
+					P.permute(Rank-1,(size_t)c);
+					for (long ll=0      ; ll < last ; ++ll)
+						permuteBinary( LigneA[(size_t)ll], Rank, c);
+				}
 			}
 		}
 
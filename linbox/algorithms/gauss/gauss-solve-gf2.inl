@@ -55,27 +55,86 @@ namespace LinBox
 		return P.applyTranspose(x, w);
 	}
 
-	template <class SparseSeqMatrix, class Vector1, class Vector2>
-	Vector1& GaussDomain<GF2>::solveInPlace(Vector1& x,
-					   SparseSeqMatrix        &A,
-					   const Vector2& b) const
+	template <class SparseSeqMatrix, class Vector1, class Vector2, class FreeValue>
+	Vector1& GaussDomain<GF2>::hybridSolveInPlace(Vector1& x,
+						      SparseSeqMatrix        &A,
+						      const Vector2& b,
+						      FreeValue& freeValue) const
 	{
-
 		typename GF2::Element Det;
 		size_t Rank;
 		const GF2 F2;
-		SparseSeqMatrix L(F2, A.rowdim(), A.rowdim());
-		Permutation<GF2> Q(F2,(int)A.rowdim());
-		Permutation<GF2> P(F2,(int)A.coldim());
-
-		this->QLUPin(Rank, Det, Q, L, A, P, A.rowdim(), A.coldim() );
-
-		Vector1 w(F2, A.coldim());
+		const size_t Ni = A.rowdim(), Nj = A.coldim();
+		Permutation<GF2> P(F2, Nj);
+
+		// The right-hand side follows the row operations
+		std::vector<bool> rhs(Ni);
+		for (size_t i = 0; i < Ni; ++i)
+			rhs[i] = !F2.isZero(b[i]);
+
+		DenseTail tail;
+		this->InPlaceLinearPivoting(Rank, Det, A, P, Ni, Nj, &rhs, &tail);
+
+		// Solution in the renamed columns
+		std::vector<bool> w(Nj, false);
+		bool r;
+		size_t sparseRank = Rank;
+
+		if (tail.M.rowdim() > 0) {
+			// Reduced echelon form: the free columns of the tail are
+			// eliminated from the pivot rows by their values
+			const size_t C = Nj - tail.rank0;
+			std::vector<bool> isPivot(C, false);
+			for (size_t i = 0; i < tail.rank; ++i)
+				isPivot[tail.pivots[i]] = true;
+
+			for (size_t i = 0; i < tail.rank; ++i)
+				w[tail.rank0 + tail.pivots[i]] = tail.M.getEntry(i, C);
+
+			for (size_t d = 0; d < C; ++d) {
+				if (isPivot[d] || !freeValue.random(r))
+					continue;
+				w[tail.rank0 + d] = true;
+				for (size_t i = 0; i < tail.rank; ++i)
+					if (tail.M.getEntry(i, d))
+						w[tail.rank0 + tail.pivots[i]] = !w[tail.rank0 + tail.pivots[i]];
+			}
+
+			sparseRank = tail.rank0;
+		}
+		else {
+			for (size_t j = Rank; j < Nj; ++j)
+				w[j] = freeValue.random(r);
+		}
+
+		// Back substitution on the sparse pivot rows, whose first
+		// entry is the pivot
+		for (size_t i = sparseRank; i-- > 0; ) {
+			bool e = rhs[i];
+			for (size_t l = 1; l < A[i].size(); ++l)
+				e = (e != w[A[i][l]]);
+			w[A[i][0]] = e;
+		}
+
+		Vector1 v(F2, Nj);
+		for (size_t j = 0; j < Nj; ++j)
+			F2.assign(v[j], w[j] ? F2.one : F2.zero);
+
+		return P.applyTranspose(x, v);
+	}
 
-        for(typename Vector1::iterator it=w.begin()+(ptrdiff_t)Rank;it!=w.end();++it)
-				F2.assign(*it,F2.zero);
+	// Free variables set to zero
+	struct GaussZeroFreeValueGF2 {
+		bool& random(bool& a) const { return a = false; }
+	};
 
-		return this->solve(x, w, Rank, Q, L, A, P, b);
+	template <class SparseSeqMatrix, class Vector1, class Vector2>
+	Vector1& GaussDomain<GF2>::solveInPlace(Vector1& x,
+					   SparseSeqMatrix        &A,
+					   const Vector2& b) const
+	{
+		GaussZeroFreeValueGF2 zero;
+		return this->hybridSolveInPlace(x, A, b, zero);
 	}
 
 	template <class SparseSeqMatrix, class Vector1, class Vector2, class Random>
@@ -84,22 +143,7 @@ namespace LinBox
 					   const Vector2& b,
                        Random& generator) const
 	{
-
-		typename GF2::Element Det;
-		size_t Rank;
-		const GF2 F2;
-		SparseSeqMatrix L(F2, A.rowdim(), A.rowdim());
-		Permutation<GF2> Q((int)A.rowdim(),F2);
-		Permutation<GF2> P((int)A.coldim(),F2);
-
-		this->QLUPin(Rank, Det, Q, L, A, P, A.rowdim(), A.coldim() );
-
-		Vector1 w(F2, A.coldim());
-
-        for(typename Vector1::iterator it=w.begin()+Rank;it!=w.end();++it)
-            generator.random( *it );
-
-		return this->solve(x, w, Rank, Q, L, A, P, b);
+		return this->hybridSolveInPlace(x, A, b, generator);
 	}
 
 } // namespace LinBox
@@ -258,6 +258,7 @@ namespace LinBox
             commentator().report (Commentator::LEVEL_IMPORTANT, PARTIAL_RESULT)
             << "Rank : " << Rank
             << " over ") << std::endl;
+        SparseRowPool<Vector>::local ().compact ();
         commentator().stop ("done", 0, "IPLR");
 
 
@@ -490,7 +491,6 @@ namespace LinBox
 #endif
 
         field().assign(determinant,field().one);
-        Vector Vzer(0) ;
 
         // allocation of the column density
         std::vector<size_t> col_density (Nj);
@@ -549,9 +549,7 @@ namespace LinBox
 
                 if (p != k) {
                     field().negin(determinant);
-                    Vector vtm = LigneA[(size_t)k];
-                    LigneA[(size_t)k] = LigneA[(size_t)p];
-                    LigneA[(size_t)p] = vtm;
+                    std::swap (LigneA[(size_t)k], LigneA[(size_t)p]);
                 }
 
                 //                     LigneA.write(std::cerr << "BEF, k:" << k << ", Rank:" << Rank << ", c:" << c)<<std::endl;
@@ -567,7 +565,7 @@ namespace LinBox
 #ifdef __LINBOX_COUNT__
                 nbelem += LigneA[(size_t)k].size ();
 #endif
-                LigneA[(size_t)k] = Vzer;
+                SparseRowPool<Vector>::local ().release (LigneA[(size_t)k]);
             }
 
         }//for k
@@ -602,6 +600,7 @@ namespace LinBox
         commentator().report (Commentator::LEVEL_NORMAL, PARTIAL_RESULT)
         << "Rank : " << Rank
         << " over GF (" << card << ")" << std::endl;
+        SparseRowPool<Vector>::local ().compact ();
         commentator().stop ("done", 0, "IPLR");
         return Rank;
     }
@@ -694,9 +693,7 @@ namespace LinBox
 
                 if (p != k) {
                     field().negin(determinant);
-                    Vector vtm = LigneA[(size_t)k];
-                    LigneA[(size_t)k] = LigneA[(size_t)p];
-                    LigneA[(size_t)p] = vtm;
+                    std::swap (LigneA[(size_t)k], LigneA[(size_t)p]);
                 }
 
                 //                     LigneA.write(std::cerr << "BEF, k:" << k << ", Rank:" << Rank << ", c:" << c)<<std::endl;
@@ -757,6 +754,7 @@ namespace LinBox
         commentator().report (Commentator::LEVEL_NORMAL, PARTIAL_RESULT)
         << "Rank : " << Rank
         << " over GF (" << card << ")" << std::endl;
+        SparseRowPool<Vector>::local ().compact ();
         commentator().stop ("done", 0, "IPLR");
         return Rank;
     }
@@ -786,7 +784,6 @@ namespace LinBox
 #ifdef __LINBOX_COUNT__
         long long nbelem = 0;
 #endif
-        Vector Vzer (0);
 
         field().assign(determinant,field().one);
         const long last = (long)Ni - 1;
@@ -809,7 +806,7 @@ namespace LinBox
 #ifdef __LINBOX_COUNT__
                 nbelem += LigneA[(size_t)k].size ();
 #endif
-                LigneA[(size_t)k] = Vzer;
+                SparseRowPool<Vector>::local ().release (LigneA[(size_t)k]);
             }
         }
 
@@ -836,6 +833,7 @@ namespace LinBox
         commentator().report (Commentator::LEVEL_NORMAL, PARTIAL_RESULT)
         << "Rank : " << res
         << " over GF (" << card << ")" << std::endl;
+        SparseRowPool<Vector>::local ().compact ();
         commentator().stop ("done", 0, "NoRe");
         return res;
     }
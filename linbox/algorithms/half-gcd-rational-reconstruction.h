@@ -0,0 +1,384 @@
+/* linbox/algorithms/half-gcd-rational-reconstruction.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/half-gcd-rational-reconstruction.h
+ * @ingroup algorithms
+ * @brief Subquadratic rational reconstruction by half-GCD.
+ *
+ * The remainder sequence of \f$(m, x)\f$ is advanced by recursive
+ * half-GCD steps on the leading bits: the quotients found on truncated
+ * numbers are applied to the full numbers and the wrong ones, at the
+ * tail, are undone. Since \f$(r_0; r_1) = M (\alpha; \beta)\f$ with
+ * \f$\alpha > \beta > 0\f$ holds for a product \f$M\f$ of continued
+ * fraction matrices only when they carry the true first quotients of
+ * \f$r_0/r_1\f$, this check is exact and the results are those of the
+ * classical extended Euclidean algorithm.
+ *
+ * The functions below are used automatically above
+ * LINBOX_HALF_GCD_RR_THRESHOLD bits by ClassicRationalReconstruction,
+ * ClassicMaxQRationalReconstruction, the rational CRA builders and
+ * Dixon's RationalReconstruction.
+ */
+
+#ifndef __LINBOX_half_gcd_rational_reconstruction_H
+#define __LINBOX_half_gcd_rational_reconstruction_H
+
+#include <algorithm>
+#include <vector>
+
+#include <givaro/givrational.h>
+#include <givaro/zring.h>
+
+#include "linbox/integer.h"
+
+/// Bit size of the modulus above which rational reconstruction uses half-GCD.
+#ifndef LINBOX_HALF_GCD_RR_THRESHOLD
+#define LINBOX_HALF_GCD_RR_THRESHOLD 16384
+#endif
+
+/// Number of bits below which the half-GCD computes quotients one by one.
+#ifndef LINBOX_HALF_GCD_BASE_THRESHOLD
+#define LINBOX_HALF_GCD_BASE_THRESHOLD 256
+#endif
+
+namespace LinBox
+{
+	namespace Protected {
+
+		/** Product \f$M\f$ of the continued fraction matrices
+		 * \f$\begin{pmatrix} q_i & 1 \\ 1 & 0 \end{pmatrix}\f$ of some
+		 * quotients, so that \f$(r_0; r_1) = M (r_k; r_{k+1})\f$ and
+		 * \f$\det M = (-1)^k\f$.
+		 */
+		struct QuotientMatrix {
+			Integer m00 = 1, m01 = 0, m10 = 0, m11 = 1;
+			bool odd = false; //!< true when the determinant is -1
+
+			/// One more quotient.
+			void step(const Integer& q)
+			{
+				Integer t(m00);
+				Integer::axpyin(m00 = m01, q, t);
+				m01 = t;
+				t = m10;
+				Integer::axpyin(m10 = m11, q, t);
+				m11 = t;
+				odd = !odd;
+			}
+
+			/// Remove the last quotient q.
+			void unstep(const Integer& q)
+			{
+				Integer t(m01);
+				Integer::maxpyin(m01 = m00, q, t);
+				m00 = t;
+				t = m11;
+				Integer::maxpyin(m11 = m10, q, t);
+				m10 = t;
+				odd = !odd;
+			}
+
+			/// this <- this * N
+			void mulin(const QuotientMatrix& N)
+			{
+				Integer a00 = m00 * N.m00 + m01 * N.m10;
+				Integer a01 = m00 * N.m01 + m01 * N.m11;
+				Integer a10 = m10 * N.m00 + m11 * N.m10;
+				m11 = m10 * N.m01 + m11 * N.m11;
+				m00 = a00; m01 = a01; m10 = a10;
+				odd = (odd != N.odd);
+			}
+
+			/// \f$(\alpha; \beta) = M^{-1} (a; b)\f$
+			void solve(Integer& alpha, Integer& beta, const Integer& a, const Integer& b) const
+			{
+				alpha = m11 * a - m01 * b;
+				beta = m00 * b - m10 * a;
+				if (odd) {
+					Integer::negin(alpha);
+					Integer::negin(beta);
+				}
+			}
+
+			/// Coefficients of x in \f$\alpha\f$ and \f$\beta\f$ modulo r_0 when \f$r_1 = x\f$
+			void cofactors(Integer& talpha, Integer& tbeta) const
+			{
+				talpha = m01;
+				tbeta = m00;
+				if (odd) Integer::negin(tbeta);
+				else Integer::negin(talpha);
+			}
+		};
+
+		struct HalfGcd {
+
+			/// One step of the Euclidean algorithm on (a, b), b > 0.
+			static void step(Integer& a, Integer& b, QuotientMatrix& M, std::vector<Integer>& qs)
+			{
+				Integer q, r;
+				Integer::divmod(q, r, a, b);
+				a = b;
+				b = r;
+				M.step(q);
+				qs.push_back(q);
+			}
+
+			/** Advances the remainder sequence of (a, b), a >= b >= 0,
+			 * while b has more than s bits: on return a has more than s
+			 * bits and b at most s. The quotients are appended to qs and
+			 * M is multiplied by their matrix.
+			 */
+			static void reduce(Integer& a, Integer& b, size_t s, QuotientMatrix& M, std::vector<Integer>& qs)
+			{
+				while (b.bitsize() > s) {
+					const size_t n = a.bitsize(), k = n - s;
+					if (k <= LINBOX_HALF_GCD_BASE_THRESHOLD || n <= 4 * LINBOX_HALF_GCD_BASE_THRESHOLD) {
+						step(a, b, M, qs);
+						continue;
+					}
+
+					// reduce the leading 2h bits by h bits
+					const size_t h = std::min(k, n / 4), p = n - 2 * h;
+					Integer a0(a >> p), b0(b >> p);
+					QuotientMatrix M0;
+					std::vector<Integer> q0;
+					reduce(a0, b0, h, M0, q0);
+
+					// keep the quotients that are right for (a, b)
+					Integer alpha, beta;
+					M0.solve(alpha, beta, a, b);
+					while (!q0.empty() && !(alpha > beta && beta > 0 && alpha.bitsize() > s)) {
+						M0.unstep(q0.back());
+						Integer t(alpha);
+						Integer::axpyin(alpha = beta, q0.back(), t);
+						beta = t;
+						q0.pop_back();
+					}
+
+					if (q0.empty()) {
+						step(a, b, M, qs);
+						continue;
+					}
+					a = alpha;
+					b = beta;
+					M.mulin(M0);
+					qs.insert(qs.end(), q0.begin(), q0.end());
+				}
+			}
+
+			/// Matrix of the quotients qs[lo..hi), by a balanced product tree.
+			static QuotientMatrix product(const std::vector<Integer>& qs, size_t lo, size_t hi)
+			{
+				QuotientMatrix M;
+				if (hi - lo <= 8) {
+					for (size_t i = lo; i < hi; ++i) M.step(qs[i]);
+					return M;
+				}
+				const size_t mid = lo + (hi - lo) / 2;
+				M = product(qs, lo, mid);
+				M.mulin(product(qs, mid, hi));
+				return M;
+			}
+		};
+	}
+
+	/** @brief Remainder sequence of (m, x) stopped at the first remainder below a bound.
+	 *
+	 * On return r1 is the first remainder of the Euclidean sequence of
+	 * \f$(m, x)\f$, \f$0 < x < m\f$, smaller than bound (bound > 0), r0
+	 * the previous one, and \f$r_i \equiv t_i x \bmod m\f$; these are the
+	 * values of the classical loop of ClassicRationalReconstruction.
+	 *
+	 * @return false, without computing anything, when m has at most
+	 * LINBOX_HALF_GCD_RR_THRESHOLD bits, x is not in ]0, m[ or the ring
+	 * is not Integer.
+	 */
+	inline bool halfGcdRemainders(Integer& r0, Integer& t0, Integer& r1, Integer& t1,
+				      const Integer& m, const Integer& x, const Integer& bound)
+	{
+		if (m.bitsize() <= LINBOX_HALF_GCD_RR_THRESHOLD || x <= 0 || x >= m) return false;
+
+		Protected::QuotientMatrix M;
+		std::vector<Integer> qs;
+		r0 = m;
+		r1 = x;
+		Protected::HalfGcd::reduce(r0, r1, bound.bitsize(), M, qs);
+		while (r1 >= bound) Protected::HalfGcd::step(r0, r1, M, qs);
+		M.cofactors(t0, t1);
+		return true;
+	}
+
+	template <class Element>
+	bool halfGcdRemainders(Element&, Element&, Element&, Element&, const Element&, const Element&, const Element&)
+	{
+		return false;
+	}
+
+	/** @brief Pair of the maximal quotient (MQRR of Monagan) of the remainder sequence of (m, x).
+	 *
+	 * Same results as the classical loop of
+	 * ClassicMaxQRationalReconstruction: the quotients are taken while the
+	 * larger remainder has more than S bits and up to the first one of
+	 * more than S bits; a and b are the remainder and its cofactor at the
+	 * first maximal quotient qmax.
+	 *
+	 * @return false, without computing anything, when m has at most
+	 * LINBOX_HALF_GCD_RR_THRESHOLD bits, x is not in ]0, m[ or the ring
+	 * is not Integer.
+	 */
+	inline bool halfGcdMaxQuotient(Integer& a, Integer& b, Integer& qmax,
+				       const Integer& m, const Integer& x, size_t S)
+	{
+		if (m.bitsize() <= LINBOX_HALF_GCD_RR_THRESHOLD || x <= 0 || x >= m) return false;
+
+		Protected::QuotientMatrix M;
+		std::vector<Integer> qs;
+		Integer r0(m), r1(x);
+		Protected::HalfGcd::reduce(r0, r1, S, M, qs);
+		while (r1 > 0 && r0.bitsize() > S) Protected::HalfGcd::step(r0, r1, M, qs);
+
+		size_t jmax = qs.size();
+		qmax = 0;
+		for (size_t j = 0; j < qs.size(); ++j)
+			if (qs[j] > qmax) {
+				qmax = qs[j];
+				jmax = j;
+				if (qmax.bitsize() > S) break;
+			}
+
+		if (jmax == qs.size()) {
+			a = x;
+			b = 1;
+			return true;
+		}
+		// remainder and cofactor before the quotient jmax
+		Protected::QuotientMatrix P = Protected::HalfGcd::product(qs, 0, jmax);
+		Integer alpha, ta;
+		P.solve(alpha, a, m, x);
+		P.cofactors(ta, b);
+		return true;
+	}
+
+	template <class Element>
+	bool halfGcdMaxQuotient(Element&, Element&, Element&, const Element&, const Element&, size_t)
+	{
+		return false;
+	}
+
+	/** @brief Rational reconstruction by half-GCD.
+	 *
+	 * Computes the pair (n, d) of the Euclidean sequence of \f$(m, x \bmod m)\f$
+	 * at the first remainder \f$|n| \leq N\f$, with d > 0.
+	 * A residue already smaller than N in symmetric representation (as
+	 * happens when x has been multiplied by a known common denominator)
+	 * is returned as such, with d = 1.
+	 *
+	 * @return true iff \f$0 < d \leq D\f$ and \f$\gcd(n, d) = 1\f$,
+	 * i.e. n/d is the rational reconstruction of x.
+	 */
+	inline bool halfGcdRationalReconstruction(Integer& n, Integer& d, const Integer& x, const Integer& m,
+						  const Integer& N, const Integer& D)
+	{
+		Integer xm;
+		xm = x % m;
+		if (xm < 0) xm += m;
+		if (xm <= N) {
+			n = xm;
+			d = 1;
+			return d <= D;
+		}
+		if (m - xm <= N) {
+			n = xm - m;
+			d = 1;
+			return d <= D;
+		}
+
+		Protected::QuotientMatrix M;
+		std::vector<Integer> qs;
+		Integer r0(m);
+		n = xm;
+		Protected::HalfGcd::reduce(r0, n, N.bitsize(), M, qs);
+		while (n > N) Protected::HalfGcd::step(r0, n, M, qs);
+		Integer t0;
+		M.cofactors(t0, d);
+		if (d < 0) {
+			Integer::negin(n);
+			Integer::negin(d);
+		}
+		if (d > D) return false;
+		Integer g;
+		return gcd(g, n, d) == 1;
+	}
+
+	/** @brief Rational reconstruction with numerator and denominator bounds.
+	 *
+	 * Same as Givaro::Rational::RationalReconstruction, through
+	 * halfGcdRationalReconstruction above LINBOX_HALF_GCD_RR_THRESHOLD
+	 * bits.
+	 */
+	inline bool rationalReconstruction(Integer& n, Integer& d, const Integer& x, const Integer& m,
+					   const Integer& numbound, const Integer& denbound)
+	{
+		if (m.bitsize() <= LINBOX_HALF_GCD_RR_THRESHOLD)
+			return (bool)Givaro::Rational::RationalReconstruction(n, d, x, m, numbound, denbound);
+		return halfGcdRationalReconstruction(n, d, x, m, numbound, denbound);
+	}
+
+	/** @brief Rational reconstruction with a numerator bound k: \f$|n| < k\f$ and \f$0 < d \leq m/k\f$.
+	 *
+	 * Same as Givaro::ZRing<Integer>::RationalReconstruction, through
+	 * halfGcdRationalReconstruction above LINBOX_HALF_GCD_RR_THRESHOLD
+	 * bits.
+	 */
+	inline bool rationalReconstruction(Integer& n, Integer& d, const Integer& x, const Integer& m, const Integer& k)
+	{
+		if (m.bitsize() <= LINBOX_HALF_GCD_RR_THRESHOLD)
+			return (bool)Givaro::ZRing<Integer>().RationalReconstruction(n, d, x, m, k);
+		return halfGcdRationalReconstruction(n, d, x, m, k - 1, m / k);
+	}
+
+	/** @brief Rational reconstruction with Wang's bounds \f$|n|, d \leq \sqrt{m/2}\f$.
+	 *
+	 * Same as Givaro::ZRing<Integer>::RationalReconstruction, through
+	 * halfGcdRationalReconstruction above LINBOX_HALF_GCD_RR_THRESHOLD
+	 * bits.
+	 */
+	inline bool rationalReconstruction(Integer& n, Integer& d, const Integer& x, const Integer& m)
+	{
+		if (m.bitsize() <= LINBOX_HALF_GCD_RR_THRESHOLD)
+			return (bool)Givaro::ZRing<Integer>().RationalReconstruction(n, d, x, m);
+		Integer w;
+		Givaro::ZRing<Integer>().sqrt(w, m / 2);
+		return halfGcdRationalReconstruction(n, d, x, m, w, w);
+	}
+
+}
+
+#endif // __LINBOX_half_gcd_rational_reconstruction_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
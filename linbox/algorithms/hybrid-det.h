@@ -40,6 +40,9 @@
 #include "linbox/algorithms/matrix-hom.h"
 #include "linbox/solutions/det.h"
 
+#include <map>
+#include <mutex>
+
 // #define _LB_H_DET_TIMING
 
 namespace LinBox
@@ -131,16 +134,94 @@ namespace LinBox
 
 	};
 
+	/** \brief det(A) modulo primes, keeping the residues for a later CRA
+	 *
+	 * The residues are recorded under a lock, so that the iteration can be
+	 * run by a parallel ChineseRemainder.
+	 */
+	template <class Blackbox, class MyMethod>
+	struct IntegerModularDetRecorded {
+		const Blackbox                    &A;
+		const MyMethod                    &M;
+		std::map<Integer, Integer> residues; //!< det(A) mod p, for each prime p used
+		std::mutex                    lock;
+
+		IntegerModularDetRecorded(const Blackbox& b, const MyMethod& n) :
+			A(b), M(n)
+		{}
+
+		template<typename Field>
+		IterationResult operator()(typename Field::Element& d, const Field& F)
+		{
+			typedef typename Blackbox::template rebind<Field>::other FBlackbox;
+			FBlackbox Ap(A, F);
+			detInPlace( d, Ap, RingCategories::ModularTag(), M);
+
+			Integer p, r;
+			F.characteristic(p);
+			F.convert(r, d);
+			std::lock_guard<std::mutex> guard(lock);
+			residues[p] = r;
+			return IterationResult::CONTINUE;
+		}
+	};
+
+	/** \brief det(A)/beta modulo primes, for a divisor beta of det(A)
+	 *
+	 * The residues of det(A) already known for some primes are reused,
+	 * and the primes dividing beta are skipped.
+	 */
+	template <class Blackbox, class MyMethod>
+	struct IntegerModularDetCofactor {
+		const Blackbox                          &A;
+		const MyMethod                          &M;
+		const Integer                        &beta;
+		const std::map<Integer, Integer> &residues;
+
+		IntegerModularDetCofactor(const Blackbox& b, const MyMethod& n, const Integer& divisor,
+					  const std::map<Integer, Integer>& known) :
+			A(b), M(n), beta(divisor), residues(known)
+		{}
+
+		template<typename Field>
+		IterationResult operator()(typename Field::Element& d, const Field& F) const
+		{
+			typename Field::Element y;
+			F.init(y, beta);
+			if (F.isZero(y))
+				return IterationResult::SKIP;
+
+			Integer p;
+			F.characteristic(p);
+			auto it = residues.find(p);
+			if (it != residues.end()) {
+				F.init(d, it->second);
+			}
+			else {
+				typedef typename Blackbox::template rebind<Field>::other FBlackbox;
+				FBlackbox Ap(A, F);
+				detInPlace( d, Ap, RingCategories::ModularTag(), M);
+			}
+			F.divin(d, y);
+			return IterationResult::CONTINUE;
+		}
+	};
+
 	/** \brief Compute the determinant of A over the integers
 	 *
 	 * The determinant of a linear operator A, represented as a
 	 * black box, is computed over the integers.
 	 *
-	 * This variant is a hybrid between Last Invariant Factor and Chinese Remaindering
-	 * It performs several determinants mod primes
-	 * Then switches to the LIF method, producing a factor of det.
-	 * It then comes back to the CRA if necessary to compute
-	 * the remaining (usually small) factor of the determinant.
+	 * This variant is a hybrid between Last Invariant Factor and Chinese
+	 * Remaindering (Abbott, Bronstein, Mulders). Determinants modulo
+	 * LINBOX_DEFAULT_EARLY_TERMINATION_THRESHOLD + 1 primes (rounded up to
+	 * full rounds of threads) are computed first, which is enough for the
+	 * early termination when det(A) is small.
+	 * Otherwise a random system is solved by dense Dixon lifting, whose
+	 * denominator is a large divisor beta of det(A), and the CRA only
+	 * needs to recover the (usually small) cofactor det(A)/beta, starting
+	 * from the residues already computed. Both CRA phases run their
+	 * modular determinants in parallel when OpenMP is enabled.
 	 *
 	 * @param d Field element into which to store the result
 	 * @param A Black box of which to compute the determinant
@@ -154,284 +235,56 @@ namespace LinBox
 							 const RingCategories::IntegerTag          &tag,
 							 const MyMethod                            &M)
 	{
-		//commentator().setReportStream(std::cout);
 		typedef Givaro::ModularBalanced<double> mymodular;
 		typedef typename Blackbox::Field Integers;
-		typedef typename Integers::Element Integer_t;
 
 		commentator().start ("Integer Determinant - hybrid version ", "det");
-		size_t myfactor=5;
-		size_t early_counter=0;
-
-		//double a = 0.0;//0.28;//0.0013//if time(lif)/time(10lu) < a * log(lif) then calculate bonus
-
-		Integer_t lif = 1;
-		Integer_t bonus = 1;
-		Integer_t beta = 1;
-		d=1;
+		// the early termination needs threshold + 1 primes, in full rounds of NUM_THREADS
+		const int threshold = LINBOX_DEFAULT_EARLY_TERMINATION_THRESHOLD;
+		const int rounds = std::max(1, int(NUM_THREADS));
+		const int myfactor = ((threshold + rounds) / rounds) * rounds;
 
-		PrimeIterator<IteratorCategories::HeuristicTag> genprime(FieldTraits<mymodular>::bestBitSize(A.coldim()));
-		//cout << "prime size: " << p_size << "\n";
-		CRABuilderEarlySingle<mymodular> cra(LINBOX_DEFAULT_EARLY_TERMINATION_THRESHOLD);
-		IntegerModularDetReduced<Blackbox,MyMethod> iteration(A, M, beta,myfactor);
+		// the cofactor CRA runs through the same primes first, to reuse their residues
+		PrimeIterator<IteratorCategories::PoolTag> genprime(FieldTraits<mymodular>::bestBitSize(A.coldim()));
+		PrimeIterator<IteratorCategories::PoolTag> replay(genprime);
 
-#if 0
-		if (A.rowdim() < 200 ) {
-			cra(d,iteration,genprime);
-			commentator().stop ( "first step", NULL, "det");
-			commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-			<< "Iterations done " << iteration.iterations() << "\n";
-		}
-		else {}
-#endif
-		Integer_t res;
-
-#ifdef _LB_H_DET_TIMING
-		Timer BT;
-		double time1, time2;
-		BT.start();
-#endif
-		{
-			++genprime;
-			mymodular D(*genprime);
-			iteration.primes[early_counter] = *genprime;
-			mymodular::Element r;
-			D.assign(r,D.zero);
-			iteration(r, D);
-			cra.initialize( D, r);
-			++early_counter;
-		}
-
-		while ( early_counter < myfactor && !cra.terminated() ) {
-			++genprime;
-			while (cra.noncoprime(*genprime)) ++genprime;
-			mymodular D(*genprime);
-			iteration.primes[early_counter] = *genprime;
-			// prime(p, early_counter);
-			mymodular::Element r;
-			D.assign(r,D.zero);
-			iteration(r,D);
-			cra.progress( D, r);
-			++early_counter;
-		}
-
-#ifdef _LB_H_DET_TIMING
-		BT.stop();
-		time1 = BT.usertime()/myfactor;
-		if (time1 < 0) time1 = 0;
-#endif
-		cra.result(res);
-
-		if (early_counter < myfactor) {
+		Integer res;
+		IntegerModularDetRecorded<Blackbox, MyMethod> iteration(A, M);
+		ChineseRemainder< CRABuilderEarlySingle<mymodular> > cra(threshold);
+		if (cra(myfactor, res, iteration, genprime)) {
 			/* determinant found */
-			commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION) << myfactor << "\n";
-			commentator().stop ( "first step", NULL, "det");
+			commentator().stop ("first step", NULL, "det");
 			commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-			<< "Iterations done " << iteration.iterations()<< "\n";
-			return d=res;
-		}
-		commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION) << "no very early termination \n";
-		/* turn to LU when matrix size small - not to be used at the moment */
-#if 0
-		if (A.rowdim() < 50 ) {
-			while ( !cra.terminated() ) {
-				genprime.randomPrime(p);
-				mymodular D(p);
-				iteration.primes[early_counter] = p;
-				//		prime(p, early_counter);
-				mymodular::Element r;
-				D.assign(r,D.zero);
-				iteration(r, D);
-				cra.progress( D, r);
-				++early_counter;
-			}
-			commentator().stop ( "zero step", NULL, "det");
-			commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-			<< "Iterations done " << iteration.iterations() << "\n";
+			<< "Iterations done " << cra.iterCount() << "\n";
+			A.field().init(d, res);
 			return d;
 		}
+		commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION) << "no very early termination \n";
 
-		PrimeIterator<IteratorCategories::HeuristicTag> genprime1(FieldTraits<mymodular>::bestBitSize(A.coldim()));
-
-		Integers ZZ;
-		DixonSolver < Integers , mymodular, PrimeIterator<IteratorCategories::HeuristicTag>, Method::DenseElimination > RSolver(A. field(), genprime);
-#endif
-		DixonSolver < Integers , mymodular, PrimeIterator<IteratorCategories::HeuristicTag>, Method::DenseElimination > RSolver;
+		typedef DixonSolver < Integers, mymodular, PrimeIterator<IteratorCategories::HeuristicTag>, Method::DenseElimination > Solver;
+		Solver RSolver;
+		LastInvariantFactor < Integers, Solver > LIF(RSolver);
 
 		BlasVector<Integers> r_num1 (A.field(),A. coldim());
-
-		LastInvariantFactor < Integers ,DixonSolver < Integers, mymodular, PrimeIterator<IteratorCategories::HeuristicTag>, Method::DenseElimination > >  LIF(RSolver);
-#ifdef _LB_H_DET_TIMING
-		BT.start();
-#endif
+		Integer lif = 1;
 		if (LIF.lastInvariantFactor1(lif, r_num1, A)==0) {
-			//if (lif==0)
 			d = 0;
 			commentator().stop ("is 0", NULL, "det");
 			return d;
 		}
-#ifdef _LB_H_DET_TIMING
-		BT.stop();
-		time2 = BT.usertime();
-		if (time2 < 0) time2 =0;
-#endif
-
-		//commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-		//            << "5 LU time: " << time1 << " LIF time: " << time2 << ")\n";
 		commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION) << "lif calculated\n";
-#if 0
-		LIF.lastInvariantFactor_Bonus(lif, bonus, A);
-
-		if (lif==0) {
-			d = 0;
-			commentator().stop ("done", NULL, "det");
-			return d;
-		}
-
-		if (bonus == 1) {
-			d = lif;
-			commentator().stop ("done", NULL, "det");
-			return d;
-		}
-#endif
-
-		beta = lif*bonus;
-		iteration.Beta(beta);
-
-		CRABuilderEarlySingle<mymodular> cra2(LINBOX_DEFAULT_EARLY_TERMINATION_THRESHOLD);
-		Integer_t k = 1;
-
-		early_counter = 0;
-		while ( early_counter < myfactor && !cra2.terminated() ) {
-			mymodular D(iteration.primes[early_counter]);
-			mymodular::Element r;
-			D.assign(r,D.zero);
-			iteration(r,D);
-			cra2.progress( D, r );
-			++early_counter;
-		}
-
-		if (early_counter < myfactor) {
-			/* determinant found */
-			k = cra2.result(res);
-			commentator().stop ("second step ", NULL, "det");
-			commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-			<< "Iterations done " << iteration.iterations()<< "(" << iteration.iterations2() << ")\n";
-
-		}
-		else  if (0/* time2 < a*log2(lif)*time1/p_size*/) {
-			BlasVector<Integers> r_num2 (A.field(),A. coldim());
-			Integer_t lif2=1;
-			LIF.lastInvariantFactor1(lif2,r_num2,A);
-			LIF.bonus(bonus,lif, lif2, r_num1,r_num2);
-
-			//lif2 = lif;
-			if ((bonus > 1) || (lif2 != lif)) {
-				//cout << "lif: " <<lif <<",\n     "<< lif2<< "przed\n";
-				lif = lcm(lif, lif2);
-				//cout << "lif: " <<lif << "po";
-				beta=lif*bonus;
-				iteration.Beta(beta);
-				//iteration.Restart2() // included in Beta();
-				//iteration.Moduli(moduli);
-				//iteration.Primes(primes);
-				k=1;
-				CRABuilderEarlySingle<mymodular> cra3(LINBOX_DEFAULT_EARLY_TERMINATION_THRESHOLD);
 
-				early_counter = 0;
-				while ( (early_counter < myfactor) && (!cra3.terminated() )) {
-					mymodular D(iteration.primes[early_counter]);
-					mymodular::Element r;
-					D.assign(r,D.zero);
-					iteration(r,D);
-					cra3.progress( D, r);
-					++early_counter;
-					//iteration.Inc();
-				}
-
-				if (early_counter < myfactor) {
-					/* determinant found based on the initial LU */
-					cra3.result(k);
-					commentator().stop ("third step - recalc", NULL, "det");
-					commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-					<< "Iterations done " << iteration.iterations()<<"(" << iteration.iterations2() << ")\n";
-					//<< "bonus size " << log2(bonus) << "\n";
+		Integer k;
+		IntegerModularDetCofactor<Blackbox, MyMethod> cofactor(A, M, lif, iteration.residues);
+		ChineseRemainder< CRABuilderEarlySingle<mymodular> > cra2(threshold);
+		cra2(k, cofactor, replay);
 
-				}
-				else {
-					/* enter the cra loop */
-					//cra3(k,iteration, genprime);
-					while (!cra3.terminated()) {
-						++genprime;
-						while (cra3.noncoprime(*genprime)) ++genprime;
-						mymodular D(*genprime);
-						mymodular::Element r;
-						D.assign(r,D.zero);
-						iteration(r,D);
-						cra3.progress( D, r);
-					}
-					cra3.result(k);
-					commentator().stop ("third step, bonus > 1", NULL, "det");
-					commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-					<< "Iterations done " << iteration.iterations()<< "(" << iteration.iterations2() << ")\n";
-					//<< "bonus size " << log2(bonus) << "\n";
-				}
-			}
-			else {
-				//cra2(k,iteration, genprime);
-				while (!cra2.terminated()) {
-					++genprime;
-					while (cra2.noncoprime(*genprime)) ++genprime;
-					mymodular D(*genprime);
-					mymodular::Element r;
-					D.assign(r,D.zero);
-					iteration(r,D);
-					cra2.progress( D, r);
-				}
-				cra2.result(k);
-				commentator().stop ("third step, bonus = 1", NULL, "det");
-				commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-				<< "Iterations done " << iteration.iterations()<< "(" << iteration.iterations2() << ")\n";
-			}
-		}
-		else {
-			while (!cra2.terminated()) {
-				++genprime;
-				while (cra2.noncoprime(*genprime)) ++genprime;
-				mymodular D(*genprime);
-				mymodular::Element r;
-				D.assign(r,D.zero);
-				iteration(r,D);
-				cra2.progress( D, r);
-			}
-			cra2.result(k);
-			commentator().stop ("second step+", NULL, "det");
-			commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-			<< "Iterations done " << iteration.iterations()<< "(" << iteration.iterations2() << ")\n";
-
-			/* enter the cra loop */
-			//cra2(k,iteration, genprime);
-		}
-
-		//commentator().stop ("second step", NULL, "det");
-		//commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-		//        << "Iterations done " << iteration.iterations() << "("
-		//        << iteration.iterations2() << " )\n";
-		d = k*beta;
-
-		Integer_t tmp;
-
-#ifdef _LB_H_DET_TIMING
-		commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-		<< "1 LU time: " << time1 << " LIF time: " << time2 << ")\n";
-#endif
 		commentator().report(Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-		<< "det/lif " << k<< "\n";
-		//commentator().report(Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
-		//	<< "determinant size " << Integers::log2(tmp,abs(d))<< " lif size "<< Integers::log2(tmp,beta) << "\n";
+		<< "det/lif " << k << ", iterations done " << cra.iterCount() << " + " << cra2.iterCount() << "\n";
+		commentator().stop ("second step", NULL, "det");
 
+		A.field().init(d, k*lif);
 		return d ;
-
 	}
 
 #if 0
@@ -102,6 +102,7 @@ namespace LinBox
 		Integer_t                     _numbound;
 		Integer_t                     _denbound;
 		MatrixApplyDomain<Ring,IMatrix>    _MAD;
+		HadamardLogNorms              _matNorms;
 		//BlasApply<Ring>          _BA;
 
 
@@ -143,18 +144,44 @@ namespace LinBox
 			//std::cout<<"padic base= "<<_p<<std::endl;
 
 
+			_matNorms = HadamardLogNorms(A);
+			resetRightHandSide(b);
+
+			Integer Prime;
+			this->_intRing.convert(Prime,_p);
+			_MAD.setup( Prime );
+
+#ifdef DEBUG_LC
+			std::cout<<"lifting container initialized\n";
+#endif
+#ifdef RSTIMING
+			ttSetup.stop();
+			ttRingOther.clear();
+			ttRingApply.clear();
+#endif
+		}
+
+		/** Restarts the lifting on another right-hand side of the same system.
+		 *
+		 * The norms of the matrix and the setup of the residue update are
+		 * kept: only the bounds depending on b are recomputed.
+		 */
+		template <class Vector1>
+		void resetRightHandSide (const Vector1& b)
+		{
+			linbox_check(_matA.rowdim() == b.size());
+
 			// initialize res = b
-			// _b.resize(b.size());
 			typename Vector1::const_iterator     b_iter    = b.begin();
 			typename BlasVector<Ring>::iterator  res_iter  = _b.begin() ;
 			for (; b_iter != b.end(); ++res_iter, ++b_iter)
 				//this->_intRing.init(*res_iter, int64_t(*b_iter)); --> PG: this is bug the vector b is a multi-precision vector fixed-size cast is allowed here
                 this->_intRing.init(*res_iter, *b_iter);
 
-            Integer N, D, L, Prime;
+            Integer N, D, Prime;
             this->_intRing.convert(Prime,_p);
 
-            auto hb = RationalSolveHadamardBound(A, _b);
+            auto hb = RationalSolveHadamardBound(_matNorms, _b);
             N = Integer(1) << static_cast<uint64_t>(std::ceil(hb.numLogBound));
             D = Integer(1) << static_cast<uint64_t>(std::ceil(hb.denLogBound));
 
@@ -172,17 +199,6 @@ namespace LinBox
 #endif
 			this->_intRing.init(_numbound,N);
 			this->_intRing.init(_denbound,D);
-
-			_MAD.setup( Prime );
-
-#ifdef DEBUG_LC
-			std::cout<<"lifting container initialized\n";
-#endif
-#ifdef RSTIMING
-			ttSetup.stop();
-			ttRingOther.clear();
-			ttRingApply.clear();
-#endif
 		}
 
 		virtual IVector& nextdigit (IVector& , const IVector&) const = 0;
@@ -151,6 +151,26 @@ namespace LinBox
 			}
 		};
 
+		// image of the stored matrix, row by row, then a blocked transpose
+		template<class Field, class IMatrix>
+		class BlasMatrixMAP<Field, IMatrix, MatrixContainerCategory::TransposedBlasContainer> {
+		public:
+			template<class _Rep>
+			void operator() (BlasMatrix<Field,_Rep> &Ap, const IMatrix &A, MatrixContainerCategory::TransposedBlasContainer type)
+			{
+				BlasMatrix<Field,_Rep> Bp(Ap.field(), A.coldim(), A.rowdim());
+				mapStored(Bp, A.getMatrix());
+				Bp.transpose(Ap);
+			}
+
+		protected:
+			template<class _Rep, class Matrix>
+			static void mapStored (BlasMatrix<Field,_Rep> &Bp, const Matrix &M)
+			{
+				BlasMatrixMAP<Field, Matrix, MatrixContainerCategory::BlasContainer> ()(Bp, M, MatrixContainerCategory::BlasContainer());
+			}
+		};
+
 #ifdef __LINBOX_blas_matrix_multimod_H
 		template< class IMatrix>
 		class BlasMatrixMAP<MultiModDouble, IMatrix, MatrixContainerCategory::BlasContainer > {
@@ -0,0 +1,982 @@
+/* linbox/algorithms/mg-block-lanczos-gf2.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+
+ * Word-packed block Lanczos iteration over GF(2)
+ */
+
+#ifndef __LINBOX_mg_block_lanczos_gf2_H
+#define __LINBOX_mg_block_lanczos_gf2_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "linbox/field/gf2.h"
+#include "linbox/randiter/gf2.h"
+#include "linbox/blackbox/zo-gf2.h"
+#include "linbox/vector/blas-vector.h"
+#include "linbox/solutions/methods.h"
+#include "linbox/util/commentator.h"
+#include "linbox/util/debug.h"
+
+namespace LinBox
+{
+
+	/** \brief Block Lanczos iteration over GF(2) on packed 64-bit words
+	 *
+	 * Specialisation of @ref MGBlockLanczosSolver for \f$\mathbf{F}_2\f$. The
+	 * blocking factor is fixed to 64: an \f$n\times 64\f$ block is one
+	 * <code>uint64_t</code> per row, and a \f$64\times 64\f$ matrix is 64
+	 * words. Applying a @ref ZeroOne<GF2> to a block costs one XOR per
+	 * nonzero; any other blackbox is applied column by column. Inner products
+	 * \f$V^TW\f$ and products \f$VM\f$ go through per-byte tables, so their
+	 * cost is linear in \f$n\f$ with a small constant.
+	 *
+	 * Over GF(2) the iteration normally ends with a block \f$V_m\neq 0\f$
+	 * such that \f$V_m^TAV_m = 0\f$. As in (Montgomery 1995, Section 8) the
+	 * candidate solutions are then combined with the columns of \f$V_m\f$ by
+	 * a small elimination on their images under the original matrix, so that
+	 * the results are exact.
+	 *
+	 * The diagonal preconditioners are the identity over GF(2): every
+	 * preconditioner other than <code>Preconditioner::None</code> runs the
+	 * iteration on \f$A^TA\f$. With <code>Preconditioner::None</code> the
+	 * matrix must be symmetric.
+	 *
+	 * The \p Matrix parameter is unused and only kept so that the generic
+	 * spelling <code>MGBlockLanczosSolver<typename Blackbox::Field></code>
+	 * selects this class.
+	 */
+	template <class Matrix>
+	class MGBlockLanczosSolver<GF2, Matrix> {
+	public:
+
+		typedef GF2                     Field;
+		typedef GF2::Element            Element;
+		typedef uint64_t                Word;
+		typedef std::vector<Word>       Block;        // n x 64, one word per row
+		typedef std::array<Word, 64>    SmallMatrix;  // 64 x 64, one word per row
+
+		/** Constructor
+		 * @param F Field over which to operate
+		 * @param traits @ref SolverTraits  structure describing user
+		 *               options for the solver
+		 */
+		MGBlockLanczosSolver (const Field &F, const Method::BlockLanczos &traits) :
+			_traits (traits), _field (&F), _randiter (F), _vecS (0), _last (0)
+		{
+			init_temps ();
+		}
+
+		/** Constructor with a random iterator
+		 * @param F Field over which to operate
+		 * @param traits @ref SolverTraits  structure describing user
+		 *               options for the solver
+		 * @param r Random iterator to use for randomization
+		 */
+		MGBlockLanczosSolver (const Field &F, const Method::BlockLanczos &traits, typename Field::RandIter r) :
+			_traits (traits), _field (&F), _randiter (r), _vecS (0), _last (0)
+		{
+			init_temps ();
+		}
+
+		/** Solve the linear system Ax = b.
+		 *
+		 * If the system is nonsingular, this method computes the unique
+		 * solution to the system Ax = b. If the system is singular, it computes
+		 * a random solution.
+		 *
+		 * @param A Black box for the matrix A
+		 * @param x Vector in which to store solution
+		 * @param b Right-hand side of system
+		 * @return true on success and false on failure
+		 */
+		template <class Blackbox, class Vector>
+		bool solve (const Blackbox &A, Vector &x, const Vector &b);
+
+		/** Sample from the (right) nullspace of A
+		 *
+		 * Each trial yields up to 128 nullspace vectors; they are kept
+		 * linearly independent across trials, which are repeated until
+		 * the columns of \p x are filled, two consecutive trials bring
+		 * no new vector or <code>trialsBeforeFailure</code> is reached.
+		 *
+		 * @param A Black box for the matrix A
+		 * @param x Matrix into whose columns to store nullspace elements
+		 * @return Number of nullspace vectors found
+		 */
+		template <class Blackbox, class Matrix1>
+		unsigned int sampleNullspace (const Blackbox &A, Matrix1 &x);
+
+		/** Rank of A, as coldim minus the dimension of the sampled nullspace
+		 *
+		 * This is Monte Carlo: the nullspace is sampled until two
+		 * consecutive trials bring no new vector.
+		 *
+		 * @param A Black box for the matrix A
+		 * @return The rank of A
+		 * @throws SolveFailed if the sampling has not settled after
+		 * trialsBeforeFailure trials
+		 */
+		template <class Blackbox>
+		size_t rank (const Blackbox &A);
+
+	private:
+
+		// Run the block Lanczos iteration on A (or A^T A when symmetrize is
+		// set) with the right-hand sides in _b. The solution is accumulated
+		// in _x and the last block is left in _matV[_last]. Return false if
+		// the iteration ended on a nonzero A-self-orthogonal block, which is
+		// the usual outcome over GF(2).
+		template <class Blackbox>
+		bool iterate (const Blackbox &A, bool symmetrize);
+
+		// One nullspace trial: the columns of W flagged in pivots are
+		// linearly independent vectors of the nullspace of A. W is n x 128,
+		// stored as two interleaved words per row.
+		template <class Blackbox>
+		void sampleTrial (const Blackbox &A, Block &W, Word pivots[2]);
+
+		typedef std::vector<Block> Basis;
+
+		// Add the columns of W flagged in pivots to a nullspace basis in
+		// echelon form (basis[l] has a one at pivot[l] and zeros at the
+		// pivots of the earlier vectors), up to limit vectors. Return the
+		// number of vectors added
+		static size_t extendBasis (Basis &basis, std::vector<size_t> &pivot, const Block &W,
+					   size_t n, const Word pivots[2], size_t limit);
+
+		// Y = B X where B is A or A^T A
+		template <class Blackbox>
+		void applyOp (Block &Y, const Blackbox &A, const Block &X, bool symmetrize);
+
+		// Compute W_i^inv and S_i given V_i^T A V_i. The bits of S flag the
+		// columns of V_i used in W_i
+		size_t compute_Winv_S (SmallMatrix &Winv, Word &S, const SmallMatrix &T) const;
+
+		// x = x + V_i Winv_i S_i S_i^T V_i^T b
+		void updateSolution (const Block &V, const SmallMatrix &Winv, bool add);
+
+		void init_temps ();
+
+		bool useSymmetrize () const
+		{ return _traits.preconditioner != Preconditioner::None; }
+
+		inline const Field & field() const { return *_field; }
+
+		// Block kernels
+
+		// Y = A X, one XOR per nonzero of A
+		static void blockApply (Block &Y, const ZeroOne<GF2> &A, const Block &X);
+
+		// Y = A^T X, one XOR per nonzero of A
+		static void blockApplyTranspose (Block &Y, const ZeroOne<GF2> &A, const Block &X);
+
+		// Y = A X for any blackbox over GF(2), one apply per nonzero column of X
+		template <class Blackbox>
+		static void blockApply (Block &Y, const Blackbox &A, const Block &X);
+
+		template <class Blackbox>
+		static void blockApplyTranspose (Block &Y, const Blackbox &A, const Block &X);
+
+		// C = V^T W, with V and W of n rows
+		static void innerProduct (SmallMatrix &C, const Word *V, const Word *W, size_t n);
+
+		// Y = V M S S^T, or Y = Y + V M S S^T if add is set. Y may alias V
+		static void mulBlock (Word *Y, const Word *V, size_t n, const SmallMatrix &M, Word S, bool add);
+
+		// C = A B S S^T. C may alias A
+		static void mul (SmallMatrix &C, const SmallMatrix &A, const SmallMatrix &B, Word S = ~Word(0))
+		{ mulBlock (C.data (), A.data (), 64, B, S, false); }
+
+		// A = A + I_N
+		static void addIN (SmallMatrix &A)
+		{ for (size_t r = 0; r < 64; ++r) A[r] ^= Word(1) << r; }
+
+		static bool isZero (const Block &V)
+		{ return std::find_if (V.begin (), V.end (), [](Word w) { return w != 0; }) == V.end (); }
+
+		// Column elimination on the 128 columns of R (rows x 2 words),
+		// applying the same column operations to the rows of Z. Only the
+		// active columns take part; columns in keep are never used as
+		// pivots. On return active holds the columns of R that vanished and
+		// pivots the independent columns used as pivots.
+		static void eliminateColumns (Block &R, size_t rows, Block *Z, size_t zrows,
+					      Word active[2], Word pivots[2], const Word keep[2]);
+
+		// Private variables
+
+		const Method::BlockLanczos _traits;
+		const Field              *_field;
+		typename Field::RandIter  _randiter;
+
+		// Temporaries used in the computation
+
+		std::vector<Block> _matV;  // n x N
+		Block   _AV;               // n x N
+		Block   _x;                // n x <=N
+		Block   _b;                // n x <=N
+		Block   _tmpBlock;         // m x N
+
+		SmallMatrix _VTAV;
+		std::vector<SmallMatrix> _Winv;
+		SmallMatrix _AVTAVSST_VTAV;
+		SmallMatrix _matT;
+		SmallMatrix _DEF;
+		SmallMatrix _tmp;
+		SmallMatrix _tmp1;
+		Word        _vecS;
+
+		// Index in _matV of the block on which the iteration stopped
+		int _last;
+	};
+
+	template <class Matrix>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::init_temps ()
+	{
+		_matV.resize (3);
+		_Winv.resize (2);
+
+		if (_traits.blockingFactor != 64)
+			commentator().report (Commentator::LEVEL_UNIMPORTANT, INTERNAL_DESCRIPTION)
+			<< "Blocking factor over GF(2) is fixed to 64" << std::endl;
+	}
+
+	template <class Matrix>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::blockApply (Block &Y, const ZeroOne<GF2> &A, const Block &X)
+	{
+		typename ZeroOne<GF2>::const_iterator row = A.begin ();
+
+		for (size_t i = 0; row != A.end (); ++row, ++i) {
+			Word w = 0;
+
+			for (typename ZeroOne<GF2>::Row_t::const_iterator loc = row->begin (); loc != row->end (); ++loc)
+				w ^= X[*loc];
+
+			Y[i] = w;
+		}
+	}
+
+	template <class Matrix>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::blockApplyTranspose (Block &Y, const ZeroOne<GF2> &A, const Block &X)
+	{
+		std::fill (Y.begin (), Y.end (), Word (0));
+
+		typename ZeroOne<GF2>::const_iterator row = A.begin ();
+
+		for (size_t i = 0; row != A.end (); ++row, ++i) {
+			const Word w = X[i];
+
+			if (w == 0)
+				continue;
+
+			for (typename ZeroOne<GF2>::Row_t::const_iterator loc = row->begin (); loc != row->end (); ++loc)
+				Y[*loc] ^= w;
+		}
+	}
+
+	template <class Matrix>
+	template <class Blackbox>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::blockApply (Block &Y, const Blackbox &A, const Block &X)
+	{
+		const GF2 &F = A.field ();
+		BlasVector<GF2> u (F, A.coldim ()), v (F, A.rowdim ());
+
+		Word used = 0;
+		for (size_t i = 0; i < A.coldim (); ++i)
+			used |= X[i];
+
+		std::fill (Y.begin (), Y.end (), Word (0));
+
+		for (size_t c = 0; c < 64; ++c) {
+			const Word bit = Word (1) << c;
+
+			if (!(used & bit))
+				continue;
+
+			for (size_t i = 0; i < A.coldim (); ++i)
+				F.assign (u[i], (X[i] & bit) != 0);
+
+			A.apply (v, u);
+
+			for (size_t i = 0; i < A.rowdim (); ++i)
+				if (!F.isZero (v[i]))
+					Y[i] |= bit;
+		}
+	}
+
+	template <class Matrix>
+	template <class Blackbox>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::blockApplyTranspose (Block &Y, const Blackbox &A, const Block &X)
+	{
+		const GF2 &F = A.field ();
+		BlasVector<GF2> u (F, A.rowdim ()), v (F, A.coldim ());
+
+		Word used = 0;
+		for (size_t i = 0; i < A.rowdim (); ++i)
+			used |= X[i];
+
+		std::fill (Y.begin (), Y.end (), Word (0));
+
+		for (size_t c = 0; c < 64; ++c) {
+			const Word bit = Word (1) << c;
+
+			if (!(used & bit))
+				continue;
+
+			for (size_t i = 0; i < A.rowdim (); ++i)
+				F.assign (u[i], (X[i] & bit) != 0);
+
+			A.applyTranspose (v, u);
+
+			for (size_t i = 0; i < A.coldim (); ++i)
+				if (!F.isZero (v[i]))
+					Y[i] |= bit;
+		}
+	}
+
+	template <class Matrix>
+	template <class Blackbox>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::applyOp (Block &Y, const Blackbox &A, const Block &X, bool symmetrize)
+	{
+		if (symmetrize) {
+			blockApply (_tmpBlock, A, X);
+			blockApplyTranspose (Y, A, _tmpBlock);
+		}
+		else
+			blockApply (Y, A, X);
+	}
+
+	template <class Matrix>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::innerProduct (SmallMatrix &C, const Word *V, const Word *W, size_t n)
+	{
+		// Bucket the rows of W by each byte of the matching row of V, then
+		// row 8k+b of C is the sum of the buckets of byte k with bit b set
+		Word table[8][256];
+		std::fill (&table[0][0], &table[0][0] + 8 * 256, Word (0));
+
+		for (size_t i = 0; i < n; ++i) {
+			const Word v = V[i], w = W[i];
+
+			if (v == 0 || w == 0)
+				continue;
+
+			for (size_t k = 0; k < 8; ++k)
+				table[k][(v >> (8 * k)) & 0xff] ^= w;
+		}
+
+		for (size_t k = 0; k < 8; ++k)
+			for (size_t b = 0; b < 8; ++b) {
+				Word c = 0;
+
+				for (size_t t = 0; t < 256; ++t)
+					if (t & (size_t (1) << b))
+						c ^= table[k][t];
+
+				C[8 * k + b] = c;
+			}
+	}
+
+	template <class Matrix>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::mulBlock (Word *Y, const Word *V, size_t n, const SmallMatrix &M, Word S, bool add)
+	{
+		// table[k][t] is the sum of the rows 8k+b of M for the bits b of t
+		Word table[8][256];
+
+		for (size_t k = 0; k < 8; ++k) {
+			table[k][0] = 0;
+
+			for (size_t t = 1; t < 256; ++t) {
+				size_t b = 0;
+				while (!(t & (size_t (1) << b)))
+					++b;
+				table[k][t] = table[k][t & (t - 1)] ^ M[8 * k + b];
+			}
+		}
+
+		for (size_t i = 0; i < n; ++i) {
+			const Word v = V[i];
+			Word w = 0;
+
+			for (size_t k = 0; k < 8; ++k)
+				w ^= table[k][(v >> (8 * k)) & 0xff];
+
+			w &= S;
+			Y[i] = add ? (Y[i] ^ w) : w;
+		}
+	}
+
+	template <class Matrix>
+	inline size_t MGBlockLanczosSolver<GF2, Matrix>::compute_Winv_S (SmallMatrix &Winv, Word &S, const SmallMatrix &T) const
+	{
+		// Gauss-Jordan elimination on M = [T | I], one word per half-row
+		Word M[2][64];
+		size_t indices[64];
+		size_t Ni = 0, k = 0;
+
+		for (size_t r = 0; r < 64; ++r) {
+			M[0][r] = T[r];
+			M[1][r] = Word (1) << r;
+		}
+
+		// Columns not in S_i-1 first
+		for (size_t c = 0; c < 64; ++c)
+			if (!(S & (Word (1) << c)))
+				indices[k++] = c;
+		for (size_t c = 0; c < 64; ++c)
+			if (S & (Word (1) << c))
+				indices[k++] = c;
+
+		for (size_t row = 0; row < 64; ++row) {
+			const size_t j = indices[row];
+			const Word bit = Word (1) << j;
+
+			for (size_t half = 0; half < 2; ++half) {
+				// Find a suitable pivot row and exchange it with row j
+				size_t idx;
+
+				for (idx = row; idx < 64; ++idx)
+					if (M[half][indices[idx]] & bit)
+						break;
+
+				if (idx == 64) {
+					linbox_check (half == 0);
+					continue;
+				}
+
+				if (idx != row) {
+					std::swap (M[0][j], M[0][indices[idx]]);
+					std::swap (M[1][j], M[1][indices[idx]]);
+				}
+
+				// Eliminate the rest of the column
+				for (size_t q = 0; q < 64; ++q)
+					if (q != row && (M[half][indices[q]] & bit)) {
+						M[0][indices[q]] ^= M[0][j];
+						M[1][indices[q]] ^= M[1][j];
+					}
+
+				if (half == 0) {
+					// Use column j of V_i in W_i
+					S |= bit;
+					++Ni;
+				}
+				else {
+					// Skip column j
+					S &= ~bit;
+					M[0][j] = M[1][j] = 0;
+				}
+
+				break;
+			}
+		}
+
+		std::copy (M[1], M[1] + 64, Winv.begin ());
+
+		return Ni;
+	}
+
+	template <class Matrix>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::updateSolution (const Block &V, const SmallMatrix &Winv, bool add)
+	{
+		innerProduct (_tmp, V.data (), _b.data (), V.size ());
+
+		for (size_t r = 0; r < 64; ++r)
+			if (!(_vecS & (Word (1) << r)))
+				_tmp[r] = 0;
+
+		mul (_tmp1, Winv, _tmp);
+
+		for (size_t r = 0; r < 64; ++r)
+			if (!(_vecS & (Word (1) << r)))
+				_tmp1[r] = 0;
+
+		mulBlock (_x.data (), V.data (), V.size (), _tmp1, ~Word (0), add);
+	}
+
+	template <class Matrix>
+	template <class Blackbox>
+	inline bool MGBlockLanczosSolver<GF2, Matrix>::iterate (const Blackbox &A, bool symmetrize)
+	{
+		const size_t n = A.coldim ();
+
+		commentator().start ("Block Lanczos iteration over GF(2)", "MGBlockLanczosSolver::iterate", n);
+
+		size_t Ni;
+		size_t total_dim = 0;
+		bool ret = true;
+
+		// i is the index for temporaries where we need to go back to i - 1
+		// j is the index for temporaries where we need to go back to j - 2
+		int i = 0, j = 2, prev_j = 1, iter = 2;
+
+		for (size_t k = 0; k < 3; ++k)
+			_matV[k].resize (n);
+		_AV.resize (n);
+		_x.assign (n, Word (0));
+
+		// Get a random fat vector _matV[0]
+		for (size_t k = 0; k < n; ++k)
+			_matV[0][k] = MTrandomInt<64>() (_randiter.getMT ());
+
+		applyOp (_AV, A, _matV[0], symmetrize);
+
+		// Initialize S_-1 to IN
+		_vecS = ~Word (0);
+
+		// Iteration 1
+		innerProduct (_VTAV, _matV[0].data (), _AV.data (), n);
+		Ni = compute_Winv_S (_Winv[0], _vecS, _VTAV);
+
+		if (Ni == 0) {
+			_last = 0;
+			commentator().stop ("breakdown", NULL, "MGBlockLanczosSolver::iterate");
+			return false;
+		}
+
+		total_dim += Ni;
+
+		updateSolution (_matV[0], _Winv[0], false);
+
+		// V_1 = AV_0 S_0 S_0^T + V_0 D_1
+		for (size_t k = 0; k < n; ++k)
+			_matV[1][k] = _AV[k] & _vecS;
+
+		innerProduct (_AVTAVSST_VTAV, _AV.data (), _AV.data (), n);
+		for (size_t r = 0; r < 64; ++r)
+			_AVTAVSST_VTAV[r] = (_AVTAVSST_VTAV[r] & _vecS) ^ _VTAV[r];
+
+		mul (_DEF, _Winv[0], _AVTAVSST_VTAV);
+		addIN (_DEF);
+		mulBlock (_matV[1].data (), _matV[0].data (), n, _DEF, ~Word (0), true);
+
+		if (isZero (_matV[1])) {
+			_last = 1;
+			commentator().stop ("done", NULL, "MGBlockLanczosSolver::iterate");
+			return true;
+		}
+
+		// Iteration 2
+		applyOp (_AV, A, _matV[1], symmetrize);
+
+		innerProduct (_VTAV, _matV[1].data (), _AV.data (), n);
+		Ni = compute_Winv_S (_Winv[1], _vecS, _VTAV);
+
+		if (Ni == 0) {
+			_last = 1;
+			commentator().stop ("breakdown", NULL, "MGBlockLanczosSolver::iterate");
+			return false;
+		}
+
+		total_dim += Ni;
+
+		updateSolution (_matV[1], _Winv[1], true);
+
+		for (size_t k = 0; k < n; ++k)
+			_matV[2][k] = _AV[k] & _vecS;
+
+		innerProduct (_AVTAVSST_VTAV, _AV.data (), _AV.data (), n);
+		for (size_t r = 0; r < 64; ++r)
+			_AVTAVSST_VTAV[r] = (_AVTAVSST_VTAV[r] & _vecS) ^ _VTAV[r];
+
+		mul (_DEF, _Winv[1], _AVTAVSST_VTAV);
+		addIN (_DEF);
+		mulBlock (_matV[2].data (), _matV[1].data (), n, _DEF, ~Word (0), true);
+
+		mul (_DEF, _Winv[0], _VTAV, _vecS);
+		mulBlock (_matV[2].data (), _matV[0].data (), n, _DEF, ~Word (0), true);
+
+		// Now we're ready to begin the real iteration
+		while (!isZero (_matV[j])) {
+			int next_j = j + 1;
+			if (next_j > 2) next_j = 0;
+
+			applyOp (_AV, A, _matV[j], symmetrize);
+
+			// First compute F_i+1, where we use Winv_i-2; then Winv_i and
+			// Winv_i-2 can share storage, and we don't need the old _VTAV
+			// and _AVTAVSST_VTAV any more. After this, F_i+1 is stored in
+			// _DEF
+			mul (_matT, _VTAV, _Winv[1 - i]);
+			addIN (_matT);
+			mul (_DEF, _Winv[i], _matT);
+			mul (_DEF, _DEF, _AVTAVSST_VTAV);
+
+			// Now get the next VTAV, Winv, and S_i
+			innerProduct (_VTAV, _matV[j].data (), _AV.data (), n);
+			Ni = compute_Winv_S (_Winv[i], _vecS, _VTAV);
+
+			// V_i^T A V_i = 0 with V_i != 0: Montgomery's usual end over GF(2)
+			if (Ni == 0) {
+				ret = false;
+				break;
+			}
+
+			total_dim += Ni;
+
+			// Now that we have S_i, finish off with F_i+1
+			mulBlock (_matV[next_j].data (), _matV[next_j].data (), n, _DEF, _vecS, false);
+
+			// Update x
+			updateSolution (_matV[j], _Winv[i], true);
+
+			// Compute the next _AVTAVSST_VTAV
+			innerProduct (_AVTAVSST_VTAV, _AV.data (), _AV.data (), n);
+			for (size_t r = 0; r < 64; ++r)
+				_AVTAVSST_VTAV[r] = (_AVTAVSST_VTAV[r] & _vecS) ^ _VTAV[r];
+
+			// Compute D and update V_i+1
+			mul (_DEF, _Winv[i], _AVTAVSST_VTAV);
+			addIN (_DEF);
+			mulBlock (_matV[next_j].data (), _matV[j].data (), n, _DEF, ~Word (0), true);
+
+			// Compute E and update V_i+1
+			mul (_DEF, _Winv[1 - i], _VTAV, _vecS);
+			mulBlock (_matV[next_j].data (), _matV[prev_j].data (), n, _DEF, ~Word (0), true);
+
+			// Add AV_i S_i S_i^T
+			for (size_t k = 0; k < n; ++k)
+				_matV[next_j][k] ^= _AV[k] & _vecS;
+
+			i = 1 - i;
+			prev_j = j;
+			j = next_j;
+			++iter;
+
+			commentator().progress ((long) total_dim);
+
+			if (total_dim > n) {
+				commentator().report (Commentator::LEVEL_IMPORTANT, INTERNAL_ERROR)
+				<< "Maximum number of iterations passed without termination" << std::endl;
+				ret = false;
+				break;
+			}
+		}
+
+		_last = j;
+
+		commentator().report (Commentator::LEVEL_UNIMPORTANT, INTERNAL_DESCRIPTION)
+		<< "Iterations: " << iter << ", Krylov dimension: " << total_dim << std::endl;
+
+		commentator().stop (ret ? "done" : "breakdown", NULL, "MGBlockLanczosSolver::iterate");
+
+		return ret;
+	}
+
+	template <class Matrix>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::eliminateColumns (Block &R, size_t rows, Block *Z, size_t zrows,
+									 Word active[2], Word pivots[2], const Word keep[2])
+	{
+		pivots[0] = pivots[1] = 0;
+
+		// Columns that are still active are zero on the rows already seen,
+		// so the column operations never touch those rows again
+		for (size_t i = 0; i < rows && (active[0] | active[1]); ++i) {
+			Word r[2] = { R[2 * i] & active[0], R[2 * i + 1] & active[1] };
+
+			if (!(r[0] | r[1]))
+				continue;
+
+			const Word c[2] = { r[0] & ~keep[0], r[1] & ~keep[1] };
+
+			if (!(c[0] | c[1])) {
+				// Only kept columns are left: they cannot be cleared
+				active[0] &= ~r[0];
+				active[1] &= ~r[1];
+				continue;
+			}
+
+			const size_t h = c[0] ? 0 : 1;
+			const Word p = c[h] & (~c[h] + 1);
+
+			// Add column p to every other column present in row i
+			r[h] &= ~p;
+
+			for (size_t k = i; k < rows; ++k)
+				if (R[2 * k + h] & p) {
+					R[2 * k] ^= r[0];
+					R[2 * k + 1] ^= r[1];
+				}
+
+			if (Z != NULL)
+				for (size_t k = 0; k < zrows; ++k)
+					if ((*Z)[2 * k + h] & p) {
+						(*Z)[2 * k] ^= r[0];
+						(*Z)[2 * k + 1] ^= r[1];
+					}
+
+			active[h] &= ~p;
+			pivots[h] |= p;
+		}
+	}
+
+	template <class Matrix>
+	template <class Blackbox, class Vector>
+	inline bool MGBlockLanczosSolver<GF2, Matrix>::solve (const Blackbox &A, Vector &x, const Vector &b)
+	{
+		linbox_check ((x.size () == A.coldim ()) &&
+			      (b.size () == A.rowdim ()));
+
+		commentator().start ("Solving linear system (Montgomery's block Lanczos over GF(2))", "MGBlockLanczosSolver::solve");
+
+		const size_t m = A.rowdim (), n = A.coldim ();
+		const bool symmetrize = useSymmetrize ();
+		bool success = false;
+
+		linbox_check (symmetrize || m == n);
+
+		Block bm (m), Z (2 * n), R (2 * m);
+
+		for (size_t k = 0; k < m; ++k)
+			bm[k] = field().isZero (b[k]) ? 0 : 1;
+
+		_b.resize (n);
+		_tmpBlock.resize (m);
+
+		for (unsigned int i = 0; !success && i < _traits.trialsBeforeFailure; ++i) {
+			commentator().report (Commentator::LEVEL_UNIMPORTANT, INTERNAL_DESCRIPTION)
+			<< "In try: " << i << std::endl;
+
+			if (symmetrize)
+				blockApplyTranspose (_b, A, bm);
+			else
+				_b = bm;
+
+			iterate (A, symmetrize);
+
+			// Combine x with the columns of the last block so that A x = b
+			const Block &V = _matV[_last];
+
+			for (size_t k = 0; k < n; ++k) {
+				Z[2 * k] = _x[k] & 1;
+				Z[2 * k + 1] = V[k];
+			}
+
+			blockApply (_tmpBlock, A, _x);
+			for (size_t k = 0; k < m; ++k)
+				R[2 * k] = (_tmpBlock[k] ^ bm[k]) & 1;
+
+			blockApply (_tmpBlock, A, V);
+			for (size_t k = 0; k < m; ++k)
+				R[2 * k + 1] = _tmpBlock[k];
+
+			Word active[2] = { 1, ~Word (0) }, pivots[2];
+			const Word keep[2] = { 1, 0 };
+
+			eliminateColumns (R, m, &Z, n, active, pivots, keep);
+
+			success = (active[0] & 1) != 0;
+		}
+
+		if (success) {
+			for (size_t k = 0; k < n; ++k)
+				field().assign (x[k], (Z[2 * k] & 1) != 0);
+
+			if (_traits.checkResult) {
+				for (size_t k = 0; k < n; ++k)
+					_x[k] = Z[2 * k] & 1;
+
+				blockApply (_tmpBlock, A, _x);
+				success = std::equal (_tmpBlock.begin (), _tmpBlock.end (), bm.begin ());
+
+				commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
+				<< "Checking whether Ax=b ... " << (success ? "passed" : "FAILED") << std::endl;
+			}
+		}
+
+		commentator().stop (success ? "done" : "solve failed", NULL, "MGBlockLanczosSolver::solve");
+
+		return success;
+	}
+
+	template <class Matrix>
+	template <class Blackbox>
+	inline void MGBlockLanczosSolver<GF2, Matrix>::sampleTrial (const Blackbox &A, Block &W, Word pivots[2])
+	{
+		const size_t m = A.rowdim (), n = A.coldim ();
+		const bool symmetrize = useSymmetrize ();
+
+		linbox_check (symmetrize || m == n);
+
+		Block y (n), R (2 * m);
+
+		_b.resize (n);
+		_tmpBlock.resize (m);
+
+		// Fill y with random data and find a right-hand side for the
+		// linear system
+		for (size_t k = 0; k < n; ++k)
+			y[k] = MTrandomInt<64>() (_randiter.getMT ());
+
+		applyOp (_b, A, y, symmetrize);
+
+		iterate (A, symmetrize);
+
+		// Candidates are the columns of x - y and of the last block
+		const Block &V = _matV[_last];
+
+		for (size_t k = 0; k < n; ++k)
+			y[k] ^= _x[k];
+
+		W.resize (2 * n);
+		for (size_t k = 0; k < n; ++k) {
+			W[2 * k] = y[k];
+			W[2 * k + 1] = V[k];
+		}
+
+		blockApply (_tmpBlock, A, y);
+		for (size_t k = 0; k < m; ++k)
+			R[2 * k] = _tmpBlock[k];
+
+		blockApply (_tmpBlock, A, V);
+		for (size_t k = 0; k < m; ++k)
+			R[2 * k + 1] = _tmpBlock[k];
+
+		Word active[2] = { ~Word (0), ~Word (0) };
+		const Word keep[2] = { 0, 0 };
+
+		eliminateColumns (R, m, &W, n, active, pivots, keep);
+
+		// Keep an independent subset of the columns mapped to zero
+		eliminateColumns (W, n, NULL, 0, active, pivots, keep);
+	}
+
+	template <class Matrix>
+	inline size_t MGBlockLanczosSolver<GF2, Matrix>::extendBasis (Basis &basis, std::vector<size_t> &pivot, const Block &W,
+								     size_t n, const Word pivots[2], size_t limit)
+	{
+		const size_t words = (n + 63) / 64;
+		Block v (words);
+		size_t added = 0;
+
+		for (size_t h = 0; h < 2; ++h)
+			for (size_t c = 0; c < 64 && basis.size () < limit; ++c) {
+				const Word bit = Word (1) << c;
+
+				if (!(pivots[h] & bit))
+					continue;
+
+				std::fill (v.begin (), v.end (), Word (0));
+				for (size_t k = 0; k < n; ++k)
+					if (W[2 * k + h] & bit)
+						v[k / 64] |= Word (1) << (k % 64);
+
+				for (size_t l = 0; l < basis.size (); ++l)
+					if (v[pivot[l] / 64] & (Word (1) << (pivot[l] % 64)))
+						for (size_t w = 0; w < words; ++w)
+							v[w] ^= basis[l][w];
+
+				size_t w = 0;
+				while (w < words && v[w] == 0)
+					++w;
+
+				if (w == words)
+					continue;
+
+				size_t p = 64 * w;
+				while (!(v[w] & (Word (1) << (p % 64))))
+					++p;
+
+				basis.push_back (v);
+				pivot.push_back (p);
+				++added;
+			}
+
+		return added;
+	}
+
+	template <class Matrix>
+	template <class Blackbox, class Matrix1>
+	inline unsigned int MGBlockLanczosSolver<GF2, Matrix>::sampleNullspace (const Blackbox &A, Matrix1 &x)
+	{
+		linbox_check (x.rowdim () == A.coldim ());
+
+		commentator().start ("Sampling from nullspace (Montgomery's block Lanczos over GF(2))", "MGBlockLanczosSolver::sampleNullspace");
+
+		const size_t n = A.coldim ();
+		Basis basis;
+		std::vector<size_t> pivot;
+		Block W;
+		Word pivots[2];
+		unsigned int quiet = 0;
+
+		// Stop when x is full or two consecutive trials bring nothing new
+		for (unsigned int i = 0; basis.size () < x.coldim () && quiet < 2 && i < _traits.trialsBeforeFailure; ++i) {
+			commentator().report (Commentator::LEVEL_UNIMPORTANT, INTERNAL_DESCRIPTION)
+			<< "in try: " << i << std::endl;
+
+			sampleTrial (A, W, pivots);
+
+			quiet = extendBasis (basis, pivot, W, n, pivots, x.coldim ()) ? 0 : quiet + 1;
+		}
+
+		for (size_t l = 0; l < basis.size (); ++l)
+			for (size_t k = 0; k < n; ++k)
+				x.setEntry (k, l, Element ((basis[l][k / 64] >> (k % 64)) & 1));
+
+		commentator().stop ("done", NULL, "MGBlockLanczosSolver::sampleNullspace");
+
+		return (unsigned int) basis.size ();
+	}
+
+	template <class Matrix>
+	template <class Blackbox>
+	inline size_t MGBlockLanczosSolver<GF2, Matrix>::rank (const Blackbox &A)
+	{
+		commentator().start ("Rank (Montgomery's block Lanczos over GF(2))", "MGBlockLanczosSolver::rank");
+
+		const size_t n = A.coldim ();
+		Basis basis;
+		std::vector<size_t> pivot;
+		Block W;
+		Word pivots[2];
+		unsigned int quiet = 0;
+
+		for (unsigned int i = 0; quiet < 2 && i < _traits.trialsBeforeFailure; ++i) {
+			sampleTrial (A, W, pivots);
+
+			quiet = extendBasis (basis, pivot, W, n, pivots, n) ? 0 : quiet + 1;
+		}
+
+		if (quiet < 2) {
+			commentator().stop ("done", "Nullspace sampling did not settle", "MGBlockLanczosSolver::rank");
+			throw SolveFailed ("MGBlockLanczosSolver::rank: nullspace sampling did not settle within trialsBeforeFailure trials");
+		}
+
+		commentator().stop ("done", NULL, "MGBlockLanczosSolver::rank");
+
+		return n - basis.size ();
+	}
+
+} // namespace LinBox
+
+#endif // __LINBOX_mg_block_lanczos_gf2_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -292,6 +292,7 @@ namespace LinBox
 } // namespace LinBox
 
 #include "linbox/algorithms/mg-block-lanczos.inl"
+#include "linbox/algorithms/mg-block-lanczos-gf2.h"
 
 #endif // __LINBOX_mg_block_lanczos_H
 
@@ -0,0 +1,203 @@
+/* linbox/algorithms/multimod-wiedemann.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/multimod-wiedemann.h
+ * @ingroup algorithms
+ * @brief Wiedemann minimal polynomials modulo K primes in lockstep
+ */
+
+#ifndef __LINBOX_algorithms_multimod_wiedemann_H
+#define __LINBOX_algorithms_multimod_wiedemann_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "linbox/util/debug.h"
+#include "linbox/util/error.h"
+#include "linbox/solutions/constants.h"
+#include "linbox/randiter/mersenne-twister.h"
+#include "linbox/field/multimod-lanes.h"
+
+namespace LinBox
+{
+
+	/** \brief Minimal polynomials of a blackbox modulo K primes at once
+	 *
+	 * The blackbox is a reduction of one integer matrix modulo the K
+	 * primes of a @ref MultiModLanes, such as @ref MultiModCSR or
+	 * @ref MultiModELL. The Krylov sequence \f$u^T A^i v\f$ is computed
+	 * for all the primes with one product per step, and fed to K
+	 * Berlekamp/Massey iterations, one per lane. The iteration stops when
+	 * every lane has seen EARLY_TERM_THRESHOLD consecutive zero
+	 * discrepancies, or after \f$2n\f$ steps.
+	 *
+	 * As with @ref MasseyDomain, the result modulo each prime is the
+	 * minimal polynomial of the projected sequence, a factor of the
+	 * minimal polynomial of \f$A\f$ equal to it with high probability.
+	 */
+	template <class Blackbox>
+	class MultiModWiedemann {
+	public:
+
+		typedef typename Blackbox::Field           Field;
+		typedef typename Field::Element            Element;
+		typedef typename Field::Residue            Residue;
+		typedef std::vector<Residue>               Polynomial;
+
+		static const size_t lanes = Field::lanes;
+
+		MultiModWiedemann (const Blackbox &A, size_t ett = LINBOX_DEFAULT_EARLY_TERMINATION_THRESHOLD) :
+			_A (A), _ett (std::max (ett, size_t (1))), _steps (0)
+		{
+			if (A.rowdim () != A.coldim ())
+				throw LinBoxError ("MultiModWiedemann: the matrix must be square");
+		}
+
+		/** Minimal polynomials modulo each prime, lowest degree first and monic
+		 * @param P   lane l receives the polynomial modulo the prime of lane l
+		 * @param MT  source of the random projections
+		 */
+		std::array<Polynomial, lanes> &minpoly (std::array<Polynomial, lanes> &P, MersenneTwister &MT)
+		{
+			const Field &L = _A.field ();
+			const size_t n = _A.rowdim ();
+			const size_t end = 2 * n;
+
+			std::vector<Element> u (n), v (n), w (n);
+			for (size_t i = 0; i < n; ++i) {
+				L.random (MT, u[i]);
+				L.random (MT, v[i]);
+			}
+
+			std::array<Massey, lanes> M;
+			for (size_t l = 0; l < lanes; ++l)
+				M[l].init (L.prime (l), end);
+
+			_steps = 0;
+			Element s;
+			for (size_t N = 0; N < end; ++N) {
+				L.dot (s, u, v);
+
+				bool done = true;
+				for (size_t l = 0; l < lanes; ++l) {
+					M[l].step (L, l, s[l]);
+					done = done && M[l].zeros >= _ett;
+				}
+				if (done)
+					break;
+
+				_A.apply (w, v);
+				std::swap (v, w);
+				++_steps;
+			}
+
+			for (size_t l = 0; l < lanes; ++l)
+				M[l].minpoly (P[l]);
+			return P;
+		}
+
+		/// Number of products by the blackbox in the last call to @ref minpoly
+		size_t steps () const { return _steps; }
+
+	protected:
+
+		/// Berlekamp/Massey on the sequence of one lane
+		struct Massey {
+			uint64_t              p;
+			std::vector<Residue>  S, C, B;
+			size_t                L, m, zeros;
+			Residue               b;
+
+			void init (Residue q, size_t end)
+			{
+				p = q;
+				S.clear (); S.reserve (end);
+				C.assign (1, 1); C.reserve (end / 2 + 2);
+				B.assign (1, 1); B.reserve (end / 2 + 2);
+				L = 0; m = 1; zeros = 0; b = 1;
+			}
+
+			void step (const Field &F, size_t l, Residue s)
+			{
+				const size_t N = S.size ();
+				S.push_back (s);
+
+				uint64_t d = s;
+				for (size_t i = 1; i <= L && i < C.size (); ++i)
+					d = (d + uint64_t (C[i]) * S[N - i]) % p;
+
+				if (d == 0) {
+					++m;
+					++zeros;
+					return;
+				}
+				zeros = 0;
+
+				// C <- C - d/b x^m B
+				const Residue c = Residue ((p - d) * F.invLane (b, l) % p);
+				const std::vector<Residue> T (2 * L <= N ? C : std::vector<Residue> ());
+				if (C.size () < B.size () + m)
+					C.resize (B.size () + m, 0);
+				for (size_t i = 0; i < B.size (); ++i)
+					C[i + m] = Residue ((C[i + m] + uint64_t (c) * B[i]) % p);
+
+				if (2 * L <= N) {
+					L = N + 1 - L;
+					B = T;
+					b = Residue (d);
+					m = 1;
+				}
+				else
+					++m;
+			}
+
+			/// Reversal of the connection polynomial, of degree L
+			void minpoly (Polynomial &P) const
+			{
+				P.assign (L + 1, 0);
+				for (size_t i = 0; i <= L && i < C.size (); ++i)
+					P[L - i] = C[i];
+			}
+		};
+
+		const Blackbox  &_A;
+		size_t           _ett;
+		size_t           _steps;
+	};
+
+	template <class Blackbox> const size_t MultiModWiedemann<Blackbox>::lanes;
+
+} // LinBox
+
+#endif // __LINBOX_algorithms_multimod_wiedemann_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
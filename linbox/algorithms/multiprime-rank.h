@@ -0,0 +1,249 @@
+/* linbox/algorithms/multiprime-rank.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/multiprime-rank.h
+ * @ingroup algorithms
+ * @brief Integer rank from the ranks modulo several primes, computed concurrently
+ */
+
+#ifndef __LINBOX_algorithms_multiprime_rank_H
+#define __LINBOX_algorithms_multiprime_rank_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <fflas-ffpack/paladin/parallel.h>
+
+#include "linbox/integer.h"
+#include "linbox/solutions/constants.h"
+
+namespace LinBox
+{
+
+	/** \brief Rank of an integer matrix from its ranks modulo random primes
+	 *
+	 * The rank modulo a prime \f$p\f$ is at most the rank over the
+	 * integers, and equal to it unless \f$p\f$ divides every nonzero
+	 * minor of maximal size. The maximal rank seen is thus a proven lower
+	 * bound, and it is returned once \p agreement primes have given it.
+	 * A rank equal to \f$\min(m,n)\f$ is proven and stops at once.
+	 *
+	 * The primes are processed by rounds of NUM_THREADS tasks. A task that
+	 * starts after the stopping condition is met returns without
+	 * computing anything, so that the other ranks of the round are
+	 * cancelled as soon as they are not needed.
+	 *
+	 * The failure probability, that the rank returned is too small, is
+	 * bounded with \f$\log_2 H\f$, the bit size of a bound on the minors
+	 * (see HadamardMinorLogBound): a nonzero minor has at most
+	 * \f$\log_2 H/(b-1)\f$ prime divisors of \f$b\f$ bits, out of about
+	 * \f$2^{b-1}(b-2)/(b(b-1)\ln 2)\f$ primes of that size, and every prime
+	 * tried must be one of them. The estimate assumes the primes are
+	 * uniformly distributed and the rank modulo each prime exact; the
+	 * Monte Carlo blackbox methods add their own failure probability, but
+	 * they can only underestimate the rank as well.
+	 *
+	 * The Iteration is called as <code>Iteration(r, F)</code> and must set
+	 * \p r to the rank of the matrix over the field \p F.
+	 */
+	template <class Field>
+	class MultiPrimeRank {
+	public:
+
+		/**
+		 * @param agreement  number of primes giving the maximal rank before stopping
+		 * @param maxPrimes  number of primes after which the maximal rank is returned anyway
+		 */
+		MultiPrimeRank (size_t agreement = LINBOX_DEFAULT_RANK_AGREEMENT,
+				size_t maxPrimes = LINBOX_DEFAULT_TRIALS_BEFORE_FAILURE) :
+			_agreement (std::max (agreement, size_t (1))),
+			_maxPrimes (std::max (maxPrimes, _agreement)),
+			_fullRank (0), _minorLogBound (0.0)
+		{
+			reset (0, 0.0);
+		}
+
+		/** Rank of a matrix with \p fullRank = min(m, n)
+		 * @param[out] r          the rank
+		 * @param Iteration       rank modulo one prime
+		 * @param primeiter       source of the primes
+		 * @param fullRank        min(m, n)
+		 * @param minorLogBound   bit size of a bound on the minors
+		 */
+		template <class Function, class PrimeIterator>
+		size_t &operator () (size_t &r, Function &Iteration, PrimeIterator &primeiter,
+				     size_t fullRank, double minorLogBound)
+		{
+			reset (fullRank, minorLogBound);
+			run (Iteration, primeiter, _maxPrimes);
+			return r = _rank;
+		}
+
+		/** Check of the rank modulo \p extra more primes, taken from
+		 * another iterator, for instance on primes of another size
+		 * @return true if the check did not find a larger rank
+		 */
+		template <class Function, class PrimeIterator>
+		bool certify (size_t &r, Function &Iteration, PrimeIterator &primeiter, size_t extra = 1)
+		{
+			const size_t before = _rank;
+			const size_t agreement = _agreement;
+			_agreement = _count + extra;
+			_stop = (_rank == _fullRank);
+			run (Iteration, primeiter, _primes.size () + extra);
+			_agreement = agreement;
+			r = _rank;
+			return _rank == before;
+		}
+
+		/// Upper bound on the probability that the rank returned is too small
+		double failureProbability () const
+		{
+			return _rank == _fullRank ? 0.0 : std::exp2 (_logFailure);
+		}
+
+		/// Whether the rank is proven, i.e.\ equal to min(m, n)
+		bool certified () const { return _rank == _fullRank; }
+
+		/// Number of ranks computed
+		size_t primes () const { return _primes.size (); }
+
+		/// Number of primes that gave the maximal rank
+		size_t agreeing () const { return _count; }
+
+		/// Bit size bound on the number of primes of \p b bits dividing a nonzero minor,
+		/// over the number of primes of \p b bits
+		static double logDivisorDensity (double minorLogBound, size_t b)
+		{
+			if (minorLogBound <= 0.0)
+				return -std::numeric_limits<double>::infinity ();
+			if (b < 4)
+				return 0.0;
+			const double B = double (b);
+			const double logDivisors = std::log2 (minorLogBound / (B - 1));
+			const double logPrimes = (B - 1) - std::log2 (std::log (2.0)) + std::log2 ((B - 2) / (B * (B - 1)));
+			return std::min (0.0, logDivisors - logPrimes);
+		}
+
+	protected:
+
+		void reset (size_t fullRank, double minorLogBound)
+		{
+			_fullRank = fullRank;
+			_minorLogBound = minorLogBound;
+			_rank = 0;
+			_count = 0;
+			_logFailure = 0.0;
+			_primes.clear ();
+			_stop = (fullRank == 0);
+		}
+
+		/// Result of one task
+		void record (size_t r, const integer &p)
+		{
+			std::lock_guard<std::mutex> lock (_mutex);
+			_logFailure += logDivisorDensity (_minorLogBound, p.bitsize ());
+			if (r > _rank) {
+				_rank = r;
+				_count = 1;
+			}
+			else if (r == _rank)
+				++_count;
+			if (_count >= _agreement || _rank == _fullRank)
+				_stop = true;
+		}
+
+		template <class Function, class PrimeIterator>
+		void run (Function &Iteration, PrimeIterator &primeiter, size_t maxPrimes)
+		{
+			while (!_stop && _primes.size () < maxPrimes) {
+				const size_t NN = std::min (maxPrimes - _primes.size (),
+							    std::max<size_t> (NUM_THREADS, _agreement - _count));
+
+				std::vector<integer> round;
+				while (round.size () < NN) {
+					integer p = *primeiter;
+					++primeiter;
+					if (_primes.insert (p).second)
+						round.push_back (p);
+				}
+
+				std::vector<Field> domains;
+				domains.reserve (NN);
+				for (size_t i = 0; i < NN; ++i)
+					domains.emplace_back (round[i]);
+
+				std::vector<size_t> ranks (NN, 0);
+				std::vector<char> done (NN, 0);
+
+				SYNCH_GROUP(
+				for (size_t i = 0; i < NN; ++i) {
+					{ TASK(MODE(CONSTREFERENCE(domains, round, ranks, done)
+						    WRITE(ranks[i], done[i])),
+					{
+						if (!_stop) {
+							Iteration (ranks[i], domains[i]);
+							done[i] = 1;
+							record (ranks[i], round[i]);
+						}
+					})}
+				}
+				)
+
+				// primes of cancelled tasks are not counted
+				for (size_t i = 0; i < NN; ++i)
+					if (!done[i])
+						_primes.erase (round[i]);
+			}
+		}
+
+		size_t              _agreement;
+		size_t              _maxPrimes;
+		size_t              _fullRank;
+		double              _minorLogBound;
+
+		size_t              _rank;
+		size_t              _count;
+		double              _logFailure;
+		std::set<integer>   _primes;
+		std::atomic<bool>   _stop;
+		std::mutex          _mutex;
+	};
+
+} // LinBox
+
+#endif // __LINBOX_algorithms_multiprime_rank_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
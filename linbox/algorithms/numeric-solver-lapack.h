@@ -30,82 +30,272 @@
 #ifndef __LINBOX_numeric_solver_lapack_H
 #define __LINBOX_numeric_solver_lapack_H
 
+#include <algorithm>
+#include <cmath>
+#include <typeinfo>
+#include <vector>
+
+#include "linbox/config-blas.h"
+#include "linbox/util/debug.h"
+
 #if defined(__FFLASFFPACK_HAVE_LAPACK)
 
+#ifndef LINBOX_LPS_BLOCKSIZE
+/// Panel width of the blocked LU factorisation of LPS.
+#define LINBOX_LPS_BLOCKSIZE 64
+#endif
+
 namespace LinBox {
 
-	template <class Matrix>
-	struct LPS {
+	namespace Protected {
 
-		LPS() : _Ap(NULL), _IM(NULL), _m(0), _n(0) {}
-		~LPS() {
-			if(_IM) {
-				// std::cout << "delete" << std::endl;
-				delete[] _IM;
-			}
+		// BLAS kernels for the two precisions of the LU factors (row major, left side).
+		inline void lps_gemm(int m, int n, int k, double alpha, const double *A, int lda,
+				     const double *B, int ldb, double beta, double *C, int ldc)
+		{
+			cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+		}
+
+		inline void lps_gemm(int m, int n, int k, float alpha, const float *A, int lda,
+				     const float *B, int ldb, float beta, float *C, int ldc)
+		{
+			cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+		}
+
+		inline void lps_trsm(enum CBLAS_UPLO uplo, enum CBLAS_DIAG diag, int m, int n,
+				     const double *A, int lda, double *B, int ldb)
+		{
+			cblas_dtrsm(CblasRowMajor, CblasLeft, uplo, CblasNoTrans, diag, m, n, 1., A, lda, B, ldb);
+		}
+
+		inline void lps_trsm(enum CBLAS_UPLO uplo, enum CBLAS_DIAG diag, int m, int n,
+				     const float *A, int lda, float *B, int ldb)
+		{
+			cblas_strsm(CblasRowMajor, CblasLeft, uplo, CblasNoTrans, diag, m, n, 1.f, A, lda, B, ldb);
+		}
+
+		// error-free transformations: s+e == a+b and p+e == a*b exactly.
+		inline void lps_twosum(double &s, double &e, double a, double b)
+		{
+			s = a + b;
+			double z = s - a;
+			e = (a - (s - z)) + (b - z);
+		}
+
+		inline void lps_twoprod(double &p, double &e, double a, double b)
+		{
+			p = a * b;
+			e = std::fma(a, b, -p);
 		}
-		LPS(Matrix& A) { init(A); }
+
+	} // namespace Protected
+
+	/** Numeric solver for the numeric/symbolic overlap iteration of RationalSolverSN.
+	 *
+	 * init() stores an LU factorisation with partial pivoting \f$PA = LU\f$
+	 * (blocked, trailing updates by BLAS-3 gemm/trsm) rather than an explicit
+	 * inverse, so that solve() costs two triangular solves and is backward
+	 * stable.  Several right-hand sides can be solved at once with solveMultiple().
+	 *
+	 * Each solve can be followed by steps of iterative refinement
+	 * \f$x \leftarrow x + (LU)^{-1}P(b - Ax)\f$ where the residual uses the
+	 * double input matrix.  This recovers double accuracy from \c float factors
+	 * (\p Float = \c float: half the memory and about twice the factorisation
+	 * speed).  With an extended residual (compensated, double-double dot
+	 * products, rounded to double once) the refinement converges to the
+	 * solution correctly rounded to double, with a forward error of a few ulps
+	 * instead of \f$\mathrm{cond}(A)\f$ ulps: ill-conditioned systems get
+	 * more correct bits per step of the overlap iteration.  The iterate
+	 * itself stays in double, so no step gains more than double precision.
+	 *
+	 * @tparam Matrix dense matrix of doubles (e.g. <code>BlasMatrix<ParamFuzzy></code>).
+	 * @tparam Float  precision of the LU factors, \c double or \c float.
+	 */
+	template <class Matrix, class Float = double>
+	struct LPS {
+
+		/** @param refine number of refinement steps after each solve
+		 *                (default: 0 with double factors, 2 with float factors).
+		 *  @param extended compute the refinement residuals in double-double.
+		 */
+		LPS(int refine = -1, bool extended = false) :
+			_Ap(NULL), _m(0), _n(0),
+			_refine(refine < 0 ? (sizeof(Float) < sizeof(double) ? 2 : 0) : (size_t)refine),
+			_extended(extended)
+		{}
+		LPS(Matrix& A) :
+			_Ap(NULL), _m(0), _n(0), _refine(sizeof(Float) < sizeof(double) ? 2 : 0), _extended(false)
+		{ init(A); }
+
 		int init(Matrix & A); // set up for solving - expect multiple subsequent calls to solve() and apply().
 
 		template<class Vector> int solve(Vector& x, const Vector& b); // x such that Ax = b (approx)
 		template<class Vector> Vector& apply(Vector& y, const Vector& x); // y = Ax (approx)
 
+		/// X such that AX = B (approx), X and B are n x k row major.
+		int solve(double *X, const double *B, size_t k);
+		/// X such that AX = B (approx), for dense matrices of doubles.
+		template<class DMatrix> int solveMultiple(DMatrix& X, const DMatrix& B);
+
+		void setRefinement(size_t steps, bool extended = false)
+		{
+			_refine = steps;
+			_extended = extended;
+		}
+
 	protected:
+		int factor();
+		void luSolve(Float *X, size_t k) const;
+		void residual(double *R, const double *X, const double *B, size_t k) const;
+
 		Matrix* _Ap; // for right now, assume this points to the input, double matrix A.
-		double *_IM;
+		std::vector<Float> _LU; // L (unit, below the diagonal) and U of PA = LU
+		std::vector<int> _P;    // row i was exchanged with row _P[i] at step i
 
 		size_t _m, _n;
+		size_t _refine;
+		bool _extended;
 	};
 
-	template <class Matrix>
-	int LPS<Matrix>::init(Matrix& A)
+	template <class Matrix, class Float>
+	int LPS<Matrix, Float>::init(Matrix& A)
 	{
 		_Ap = &A; // would need memcpy if *_Ap to get mods.
 		_m = A.rowdim();
 		_n = A.coldim();
 
+		linbox_check(_n);
+		linbox_check(_m == _n);
+
 		//  kludgey pointer to beginning of double vals
-		void *thedata = &*(_Ap->Begin());
+		const double *thedata = &*(_Ap->Begin());
+		_LU.assign(thedata, thedata + _m * _n);
+		_P.resize(_n);
 
-		linbox_check(_n);
-		_IM = new double[_n * _n];
-		memcpy((void *)_IM, thedata, sizeof(double)*_m*_n);
-
-		// time to set up inverse of matrix
-		int lda = (int)_n;
-		int * P = new int[_n];
-		// std::cerr << "Bef getrf: M_0,0 " << *_IM << ", M_n-1,n-1 " << *(_IM+_n*_n-1) << std::endl;
-		int ierr = clapack_dgetrf (CblasRowMajor, (int)_n, (int)_n, _IM, lda, P);
-		// std::cerr << "Aft getrf: M_0,0 " << *_IM << ", M_n-1,n-1 " << *(_IM+_n*_n-1) << std::endl;
-		if (ierr != 0) {
-			// std::cerr << "In LPS::init Matrix is not full rank" << std::endl;
-			delete[] P ;
-			return -1;
+		return factor();
+	}
+
+	template <class Matrix, class Float>
+	int LPS<Matrix, Float>::factor()
+	{
+		const size_t n = _n;
+		Float *a = _LU.data();
+
+		for (size_t k = 0; k < n; k += LINBOX_LPS_BLOCKSIZE) {
+			const size_t kb = std::min((size_t)LINBOX_LPS_BLOCKSIZE, n - k);
+
+			// unblocked elimination in the panel of columns k..k+kb-1
+			for (size_t j = k; j < k + kb; ++j) {
+				size_t p = j;
+				Float amax = std::abs(a[j*n+j]);
+				for (size_t i = j+1; i < n; ++i)
+					if (std::abs(a[i*n+j]) > amax) {
+						amax = std::abs(a[i*n+j]);
+						p = i;
+					}
+				if (amax == Float(0)) {
+					// std::cerr << "In LPS::init Matrix is not full rank" << std::endl;
+					return -1;
+				}
+				_P[j] = (int)p;
+				if (p != j)
+					std::swap_ranges(a + j*n, a + (j+1)*n, a + p*n);
+
+				const Float piv = Float(1) / a[j*n+j];
+				for (size_t i = j+1; i < n; ++i) {
+					Float l = (a[i*n+j] *= piv);
+					for (size_t c = j+1; c < k + kb; ++c)
+						a[i*n+c] -= l * a[j*n+c];
+				}
+			}
+
+			// U12 = L11^{-1} A12 and A22 -= L21 U12
+			const size_t r = n - k - kb;
+			if (r) {
+				Protected::lps_trsm(CblasLower, CblasUnit, (int)kb, (int)r,
+						    a + k*n+k, (int)n, a + k*n+k+kb, (int)n);
+				Protected::lps_gemm((int)r, (int)r, (int)kb, Float(-1),
+						    a + (k+kb)*n+k, (int)n, a + k*n+k+kb, (int)n,
+						    Float(1), a + (k+kb)*n+k+kb, (int)n);
+			}
 		}
-		clapack_dgetri (CblasRowMajor, (int)_n, _IM, lda, P);
-		delete[] P ;
+		return 0;
+	}
 
+	template <class Matrix, class Float>
+	void LPS<Matrix, Float>::luSolve(Float *X, size_t k) const
+	{
+		for (size_t i = 0; i < _n; ++i)
+			if ((size_t)_P[i] != i)
+				std::swap_ranges(X + i*k, X + (i+1)*k, X + _P[i]*k);
+		Protected::lps_trsm(CblasLower, CblasUnit, (int)_n, (int)k, _LU.data(), (int)_n, X, (int)k);
+		Protected::lps_trsm(CblasUpper, CblasNonUnit, (int)_n, (int)k, _LU.data(), (int)_n, X, (int)k);
+	}
+
+	template <class Matrix, class Float>
+	void LPS<Matrix, Float>::residual(double *R, const double *X, const double *B, size_t k) const
+	{
+		const double *A = &*(_Ap->Begin());
+		if (!_extended) {
+			std::copy(B, B + _n*k, R);
+			cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, (int)_n, (int)k, (int)_n,
+				    -1., A, (int)_n, X, (int)k, 1., R, (int)k);
+			return;
+		}
+		// compensated dot products: as accurate as if computed in double-double
+		for (size_t i = 0; i < _n; ++i)
+			for (size_t c = 0; c < k; ++c) {
+				double s = B[i*k+c], e = 0., p, pe, se;
+				for (size_t j = 0; j < _n; ++j) {
+					Protected::lps_twoprod(p, pe, -A[i*_n+j], X[j*k+c]);
+					Protected::lps_twosum(s, se, s, p);
+					e += se + pe;
+				}
+				R[i*k+c] = s + e;
+			}
+	}
+
+	template <class Matrix, class Float>
+	int LPS<Matrix, Float>::solve(double *X, const double *B, size_t k)
+	{
+		const size_t nk = _n * k;
+		std::vector<Float> W(B, B + nk);
+		luSolve(W.data(), k);
+		std::copy(W.begin(), W.end(), X);
+
+		if (_refine) {
+			std::vector<double> R(nk);
+			for (size_t it = 0; it < _refine; ++it) {
+				residual(R.data(), X, B, k);
+				std::copy(R.begin(), R.end(), W.begin());
+				luSolve(W.data(), k);
+				for (size_t i = 0; i < nk; ++i)
+					X[i] += W[i];
+			}
+		}
 		return 0;
 	}
 
-	template <class Matrix>
+	template <class Matrix, class Float>
 	template<class Vector>
-	int LPS<Matrix>::solve(Vector& x, const Vector& b)
+	int LPS<Matrix, Float>::solve(Vector& x, const Vector& b)
 	{
 		linbox_check(typeid(typename Vector::value_type)==typeid(double));
 		// std::cout << "input :" << b << std::endl;
-		const double * bdata = &*(b.begin());
-		double * xdata = &*(x.begin());
-
-		cblas_dgemv(CblasRowMajor, CblasNoTrans, (int)_m, (int)_n, 1, _IM, (int)_n, bdata, 1, 0, xdata, 1);
-		// std::cout << "result to solve :" << x << std::endl;
+		return solve(&*(x.begin()), &*(b.begin()), 1);
+	}
 
-		return 0;
+	template <class Matrix, class Float>
+	template<class DMatrix>
+	int LPS<Matrix, Float>::solveMultiple(DMatrix& X, const DMatrix& B)
+	{
+		linbox_check(B.rowdim() == _n && X.rowdim() == _n && X.coldim() == B.coldim());
+		return solve(&*(X.Begin()), &*(B.Begin()), B.coldim());
 	}
 
-	template <class Matrix>
+	template <class Matrix, class Float>
 	template<class Vector>
-	Vector& LPS<Matrix>::apply(Vector& y, const Vector& x)
+	Vector& LPS<Matrix, Float>::apply(Vector& y, const Vector& x)
 	{
 		// std::cout << "input :" << x << std::endl;
 		const double * xdata = &*(x.begin());
@@ -123,7 +313,6 @@ namespace LinBox {
 #endif // __FFLASFFPACK_HAVE_LAPACK
 
 #endif // __LINBOX_numeric_solver_lapack_H
-
 // Local Variables:
 // mode: C++
 // tab-width: 4
@@ -5,74 +5,129 @@
 
 #include <givaro/extension.h>
 #include <linbox/algorithms/poly-interpolation.h>
+#include <linbox/algorithms/subproduct-tree.h>
 #include <linbox/solutions/det.h>
 
 namespace LinBox {
 /*  
-Matrix is a polynomial matrix.  
+Matrix is a polynomial matrix over F[x].
 result is set to its determinant and returned (a polynomial).
-d is the number of evaluation points.
+d is the number of evaluation points, it must exceed the degree of the determinant.
 
 The method is to compute dets at each evaluation point and interpolate.
  (note by bds)
+When d is a power of two dividing p-1 and FFT is available for F, the points are
+the d-th roots of unity and evaluation/interpolation are FFTs. Otherwise the points
+are 0,..,d-1 and a single subproduct tree is used for all the entries.
  */
-template <class Field>
+template <class Field, class PolyMatrix>
 typename Givaro::Poly1Dom<Field,Givaro::Dense>::Element&
 computePolyDet(typename Givaro::Poly1Dom<Field,Givaro::Dense>::Element& result,
-				DenseMatrix<Givaro::Poly1Dom<Field,Givaro::Dense> >& A, 
+               const Field& F,
+               PolyMatrix& A,
                int d)
 {
 	typedef Givaro::Poly1Dom<Field,Givaro::Dense> PolyDom;
 	typedef typename PolyDom::Element PolyElt;
 	typedef typename Field::Element FieldElt;
-	//typedef MatrixDomain<Field> FieldMatDom;
 	typedef DenseMatrix<Field> FieldMat;
 
 	int n=A.coldim(),m=A.rowdim();
 
-	PolyDom BR=A.field();
-	Field F(BR.subDomain()); // coeff field
-
 	std::vector<FieldMat> mats;
-	std::vector<FieldElt> pts(d);
-	FieldElt fieldElt;
-	F.assign(fieldElt,F.zero);
-	for (int i=0;i<d;++i) {
+	for (int i=0;i<d;++i)
 		mats.push_back(FieldMat(F,m,n));
-		F.init(pts[i],int64_t(i));
-	}
 
 	commentator().report(Commentator::LEVEL_IMPORTANT,PROGRESS_REPORT)
 		<< "Initialized mats" << std::endl;
 
+	std::vector<FieldElt> dets(d), coeffs;
+	bool useFFT = (d>1) && ((d&(d-1))==0) && DFTEvaluation<Field>::available(F,d);
 
-	PolyInterpolation<Field,PolyDom> PI(pts,F,BR);
-#pragma omp parallel for shared(mats,A,PI,BR,F)
-	for (int i=0;i<m;++i) {
-		for (int j=0;j<n;++j) {
-			PolyElt p;
-			A.getEntry(p,i,j);
-			std::vector<FieldElt> vals;
-			PI.evaluate(vals,p,BR,F);
-			for (int k=0;k<d;++k) {
-				mats[k].setEntry(i,j,vals[k]);
+	if (useFFT) {
+		DFTEvaluation<Field> DFT(F,d);
+#pragma omp parallel for shared(mats,DFT)
+		for (int i=0;i<m;++i) {
+			std::vector<FieldElt> vals(d);
+			for (int j=0;j<n;++j) {
+				PolyElt p;
+				A.getEntry(p,i,j);
+				// p mod x^d-1 has the same values at the d-th roots of unity
+				for (int k=0;k<d;++k)
+					F.assign(vals[k],F.zero);
+				for (size_t k=0;k<p.size();++k)
+					F.addin(vals[k%d],p[k]);
+				DFT.direct(&vals[0]);
+				for (int k=0;k<d;++k) {
+					mats[k].setEntry(i,j,vals[k]);
+				}
 			}
 		}
+
+		commentator().report(Commentator::LEVEL_IMPORTANT,PROGRESS_REPORT)
+			<< "Finished evaluations (FFT)" << std::endl;
+
+#pragma omp parallel for shared(dets,mats)
+		for (int k=0;k<d;++k) {
+			det(dets[k],mats[k],Method::Elimination());
+		}
+
+		DFT.inverse(&dets[0]);
+		coeffs.resize(d);
+		for (int k=0;k<d;++k)
+			F.mul(coeffs[k],dets[k],DFT.scaling());
 	}
+	else {
+		std::vector<FieldElt> pts(d);
+		for (int i=0;i<d;++i)
+			F.init(pts[i],int64_t(i));
+		SubproductTree<Field> PI(F,pts);
+#pragma omp parallel for shared(mats,PI)
+		for (int i=0;i<m;++i) {
+			std::vector<FieldElt> vals;
+			for (int j=0;j<n;++j) {
+				PolyElt p;
+				A.getEntry(p,i,j);
+				PI.evaluate(vals,p);
+				for (int k=0;k<d;++k) {
+					mats[k].setEntry(i,j,vals[k]);
+				}
+			}
+		}
 
-	commentator().report(Commentator::LEVEL_IMPORTANT,PROGRESS_REPORT)
-		<< "Finished evaluations" << std::endl;
+		commentator().report(Commentator::LEVEL_IMPORTANT,PROGRESS_REPORT)
+			<< "Finished evaluations" << std::endl;
 
-	std::vector<FieldElt> dets(d);
 #pragma omp parallel for shared(dets,mats)
-	for (int k=0;k<d;++k) {
-		det(dets[k],mats[k],Method::Elimination());
+		for (int k=0;k<d;++k) {
+			det(dets[k],mats[k],Method::Elimination());
+		}
+
+		PI.interpolate(coeffs,dets);
 	}
 
-	PI.interpolate(result,pts,dets,BR,F);
+	PolyDom BR(F);
+	BR.init(result,Givaro::Degree(d-1));
+	for (int k=0;k<d;++k)
+		F.assign(result[k],coeffs[k]);
+	BR.setdegree(result);
 	return result;
 }
 
+template <class Field>
+typename Givaro::Poly1Dom<Field,Givaro::Dense>::Element&
+computePolyDet(typename Givaro::Poly1Dom<Field,Givaro::Dense>::Element& result,
+				DenseMatrix<Givaro::Poly1Dom<Field,Givaro::Dense> >& A, 
+               int d)
+{
+	typedef Givaro::Poly1Dom<Field,Givaro::Dense> PolyDom;
+
+	PolyDom BR=A.field();
+	Field F(BR.subDomain()); // coeff field
+
+	return computePolyDet(result,F,A,d);
+}
+
 int roundUpPowerOfTwo(unsigned int n)
 {
 	if (n==0) {
@@ -135,6 +190,11 @@ computePolyDetExtension(typename Givaro::Poly1Dom<Field,Givaro::Dense>::Element&
 		newCard *= a;
 		++e;
 	}
+
+	// enough points in F itself: no extension, and FFT may apply
+	if (e==1) {
+		return computePolyDet(result,F,A,d);
+	}
 	
 	typedef Givaro::Extension<Field> ExtField;
 	typedef Givaro::Poly1Dom<ExtField,Givaro::Dense> ExtPolyDom;
@@ -78,6 +78,21 @@ namespace LinBox {
             return true;
         }
 
+        /* Return the largest k such that 2^k divides p-1, i.e., the largest k
+         * for which a primitive 2^k-root of unity exists in the field.
+         */
+        template <typename Field>
+        size_t
+        two_adic_valuation (const Field& fld)
+        {
+            size_t val2p = 0;
+            typename Field::Residu_t m = fld.characteristic() - 1;
+            if (m == 0)
+                return 0;
+            for ( ; (m & 1) == 0 ; m >>= 1, val2p++) ;
+            return val2p;
+        }
+
         /* Return a primitive 2^k-root of the multiplicative group of the field.
          */
         template <typename Field>
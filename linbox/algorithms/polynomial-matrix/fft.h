@@ -32,6 +32,8 @@
 #include "linbox/linbox-config.h"
 #include "linbox/util/error.h"
 
+#include <givaro/modular.h>
+
 #include "fflas-ffpack/fflas/fflas_simd.h"
 
 /* This file contains the specialization of FFT_base for Modular based on
@@ -44,6 +46,20 @@
 
 namespace LinBox {
 
+    /* is_fft_field<Field>::value is true if FFT<Field> can be instantiated
+     * with the default Simd for any prime p such that 2^k divides p-1. It is
+     * used by generic code (e.g. BlockHankel, computePolyDet) to choose an
+     * evaluation/interpolation at roots of unity when it is available.
+     */
+    template <typename Field>
+    struct is_fft_field : std::false_type {};
+
+    template <>
+    struct is_fft_field<Givaro::Modular<double> > : std::true_type {};
+
+    template <>
+    struct is_fft_field<Givaro::Modular<uint32_t, uint64_t> > : std::true_type {};
+
     /**************************************************************************/
     /**************************************************************************/
     /**************************************************************************/
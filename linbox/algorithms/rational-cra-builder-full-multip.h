@@ -26,6 +26,7 @@
 #define __LINBOX_rational_full_multip_cra_H
 
 #include "givaro/zring.h"
+#include "linbox/algorithms/half-gcd-rational-reconstruction.h"
 #include "linbox/algorithms/cra-builder-full-multip.h"
 
 namespace LinBox
@@ -69,7 +70,7 @@ namespace LinBox
 		Integer& iterativeratrecon(Integer& u1, Integer& new_den, const Integer& old_den, const Integer& m1, const Integer& s)
 		{
 			Integer a;
-			_ZZ.RationalReconstruction(a, new_den, u1*=old_den, m1, s);
+			rationalReconstruction(a, new_den, u1*=old_den, m1, s);
 			return u1=a;
 		}
 	};
@@ -33,18 +33,28 @@
 #ifndef __LINBOX_reconstruction_H
 #define __LINBOX_reconstruction_H
 
+#include <vector>
+
+#include <fflas-ffpack/paladin/parallel.h>
+
 #include "linbox/linbox-config.h"
 #include "linbox/util/debug.h"
 
 
 #include "linbox/algorithms/rational-reconstruction-base.h"
 #include "linbox/algorithms/classic-rational-reconstruction.h"
+#include "linbox/algorithms/half-gcd-rational-reconstruction.h"
 //#include "linbox/algorithms/fast-rational-reconstruction.h"
 
 //#define DEBUG_RR
 //#define DEBUG_RR_BOUNDACCURACY
 #define DEF_THRESH 50
 
+/// Consecutive components found integral, once scaled by the common denominator, before the remaining ones are reconstructed concurrently
+#ifndef LINBOX_RR_STABLE_DEN_COMPONENTS
+#define LINBOX_RR_STABLE_DEN_COMPONENTS 4
+#endif
+
 
 #if defined(__LINBOX_HAVE_FPLLL) || defined(__LINBOX_HAVE_NTL)
 #include "linbox/algorithms/lattice.h"
@@ -62,6 +72,42 @@ namespace LinBox
 		return ( (m.bitsize()+7 )/8) ;
 	}
 
+	namespace Protected {
+		/** Reconstruction of x.scale modulo m: n/d, with d = 1 when its
+		 * symmetric residue is already below N.
+		 * s is a scratch integer, kept by the caller to avoid reallocations.
+		 */
+		template <class Ring>
+		bool scaledRationalReconstruction (const Ring& R, Integer& n, Integer& d, const Integer& x, const Integer& scale,
+						   const Integer& m, const Integer& N, const Integer& D, Integer& s)
+		{
+			R.mul(s, x, scale);
+			R.modin(s, m);
+			if (s < 0) R.addin(s, m);
+			R.assign(d, R.one);
+			if (R.compare(s, N) < 0) {
+				R.assign(n, s);
+				return true;
+			}
+			R.sub(n, s, m);
+			if (-n < N) return true;
+			return rationalReconstruction(n, d, s, m, N, D);
+		}
+
+		/// Components k = first, first+NT, ... < last of approx, reconstructed by scaledRationalReconstruction
+		/// into num[0], num[NT], ... and den[0], den[NT], ...
+		template <class Ring, class Vector3>
+		bool scaledRationalReconstructions (const Ring& R, Integer* num, Integer* den, const Vector3& approx,
+						    size_t first, size_t last, size_t NT, const Integer& scale,
+						    const Integer& m, const Integer& N, const Integer& D, Integer& s)
+		{
+			for (size_t k = first; k < last; k += NT, num += NT, den += NT)
+				if (!scaledRationalReconstruction(R, *num, *den, approx[k], scale, m, N, D, s))
+					return false;
+			return true;
+		}
+	}
+
 
 
 
@@ -303,14 +349,14 @@ namespace LinBox
 					}
 
 					if (!_r. isZero (rem1)) {
-						int status = (int)Givaro::Rational::RationalReconstruction(tmp_num, tmp_den, c1, modulus, numbound, denbound);
+						int status = (int)rationalReconstruction(tmp_num, tmp_den, c1, modulus, numbound, denbound);
 						if(status) {
 							_r. assign (c1_den, tmp_den); _r. assign (c1_num, tmp_num);
 						}
 					}
 
 					if (!_r. isZero (rem2)) {
-						int  status =(int)Givaro::Rational::RationalReconstruction (tmp_num, tmp_den, c2, modulus, numbound, denbound);
+						int  status =(int)rationalReconstruction(tmp_num, tmp_den, c2, modulus, numbound, denbound);
 						if(status) {
 							_r. assign (c2_den, tmp_den); _r. assign (c2_num, tmp_num);
 						}
@@ -333,48 +379,17 @@ namespace LinBox
 			tRecon.start();
 #endif
 			std::cout << "Start rational reconstruction:\n";
-			typename Vector::iterator num_p; typename IVector::iterator res_p;
-			Integer tmp_res, neg_res, abs_neg, l, g;
-			_r. assign(den, _r.one);
 			int counter=0;
-			for (num_p = num. begin(), res_p = res. begin(); num_p != num. end(); ++ num_p, ++ res_p) {
-				_r. mul (tmp_res, *res_p, den);
-				_r. modin (tmp_res, modulus);
-				_r. sub (neg_res, tmp_res, modulus);
-				_r. abs (abs_neg, neg_res);
-
-				if (_r. compare(tmp_res, numbound) < 0)
-					_r. assign (*num_p, tmp_res);
-				else if (_r. compare(abs_neg, numbound) < 0)
-					_r. assign (*num_p, neg_res);
-				else {
-					int status= (int)Givaro::Rational::RationalReconstruction(tmp_num, tmp_den, *res_p, modulus, numbound, denbound);
-					if (!status) {
-						commentator().report()
-						<< "ERROR in reconstruction ? (1)\n" << std::endl;
+			if (!reconstructVector(num, den, res, modulus, numbound, denbound, counter)) {
+				commentator().report()
+				<< "ERROR in reconstruction ? (1)\n" << std::endl;
 #ifdef DEBUG_RR
-						std::cout<<" try to reconstruct :\n";
-						//	std::cout<<"approximation: "<<*iter_approx<<std::endl;
-						std::cout<<"modulus: "<<modulus<<std::endl;
-						std::cout<<"numbound: "<<numbound<<std::endl;
-						std::cout<<"denbound: "<<denbound<<std::endl;
+				std::cout<<" try to reconstruct :\n";
+				std::cout<<"modulus: "<<modulus<<std::endl;
+				std::cout<<"numbound: "<<numbound<<std::endl;
+				std::cout<<"denbound: "<<denbound<<std::endl;
 #endif
-						return false;
-					}
-					counter++;
-					_r. lcm (l, den, tmp_den);
-					_r. div (g, l, den);
-
-					if (!_r. isOne (g)) {
-						typename Vector::iterator num_p1;
-						for (num_p1 = num. begin(); num_p1 != num_p; ++ num_p1)
-							_r. mulin (*num_p1, g);
-					}
-
-					_r. div (g, l, tmp_den);
-					_r. mul(*num_p, g, tmp_num);
-					_r. assign (den, l);
-				}
+				return false;
 			}
 
 #ifdef RSTIMING
@@ -600,7 +615,7 @@ namespace LinBox
 						justConfirming = false;
 						// if no answer yet (or last answer became invalid)
 						// try to reconstruct a rational number
-						tmp = Givaro::Rational::RationalReconstruction(*num_p, tmp_den, *zz_p, modulus, numbound, denbound);
+						tmp = rationalReconstruction(*num_p, tmp_den, *zz_p, modulus, numbound, denbound);
 						// update 'accuracy' according to whether it worked or not
 						if (tmp) {
 							linbox_check (!_r.isZero(tmp_den));
@@ -642,7 +657,7 @@ namespace LinBox
 							else {
 								// previous result is fake, reconstruct new answer
 								Integer tmp_den;
-								tmp = Givaro::Rational::RationalReconstruction(*num_p, tmp_den, *zz_p, modulus, numbound, denbound);
+								tmp = rationalReconstruction(*num_p, tmp_den, *zz_p, modulus, numbound, denbound);
 								if (tmp) {
 									linbox_check (!_r.isZero(den));
 									if (! _r. areEqual (tmp_den, den)) {
@@ -830,67 +845,18 @@ namespace LinBox
 			Timer ratrecon;
 			ratrecon.start();
 #endif
-			Integer common_den, common_den_mod_prod, bound,two,tmp;
-			_r.assign(common_den,_r.one);
-			_r.assign(common_den_mod_prod,_r.one);
-			_r.init(two,int64_t(2));
-
-			Vector denominator(_r,num.size());
-
-                        int counter=0;
-			typename Vector::iterator   iter_approx = real_approximation.begin();
-			typename Vector1::iterator  iter_num    = num.begin();
-			typename Vector::iterator   iter_denom  = denominator.begin();
-
-			//numbound=denbound;
-			Integer neg_approx, abs_approx;
-			int idx_last_den=0;
-
-			for (size_t i=0; iter_approx != real_approximation.end(); ++iter_approx, ++ iter_num, ++iter_denom, ++i){
-				//_r.mulin( *iter_approx , common_den_mod_prod);
-				_r.mulin( *iter_approx , common_den);
-				_r.modin( *iter_approx , modulus);
-				_r. sub (neg_approx, *iter_approx, modulus);
-				_r. abs (abs_approx, neg_approx);
-
-				if ( _r.compare(*iter_approx, numbound) < 0){
-					_r.assign(*iter_num, *iter_approx);
-					_r.assign(*iter_denom, _r.one);
-				}
-				else if (_r.compare(abs_approx, numbound) <0){
-					_r.assign(*iter_num, neg_approx);
-					_r.assign(*iter_denom, _r.one);
-				}
-				else {
-					if  (!Givaro::Rational::RationalReconstruction(*iter_num, *iter_denom, *iter_approx, modulus, numbound, denbound))
-					{
+			int counter = 0;
+			if (!reconstructVector(num, den, real_approximation, modulus, numbound, denbound, counter))
+			{
 #ifdef DEBUG_RR
-						std::cout << "ERROR in reconstruction ? (3)\n" << std::endl;
-						std::cout<<" try to reconstruct :\n";
-						std::cout<<"approximation: "<<*iter_approx<<std::endl;
-						std::cout<<"modulus: "<<modulus<<std::endl;
-						std::cout<<"numbound: "<<numbound<<std::endl;
-						std::cout<<"denbound: "<<denbound<<std::endl;
-#endif
-						return false;
-					}
-
-					_r.mulin(common_den, *iter_denom);
-					idx_last_den=(int)i;
-					counter++;
-
-				}
-
-			}
-
-			_r.assign(tmp,_r.one);
-			for (int i= idx_last_den ; i>=0;--i){
-				_r.mulin(num[(size_t)i],tmp);
-				_r.mulin(tmp,denominator[(size_t)i]);
+				std::cout << "ERROR in reconstruction ? (3)\n" << std::endl;
+				std::cout<<"modulus: "<<modulus<<std::endl;
+				std::cout<<"numbound: "<<numbound<<std::endl;
+				std::cout<<"denbound: "<<denbound<<std::endl;
+#endif
+				return false;
 			}
 
-			den = common_den;
-
 #ifdef RSTIMING
 			ratrecon.stop();
 			//std::cout<<"partial rational reconstruction : "<<ratrecon.usertime()<<std::endl;
@@ -903,6 +869,102 @@ namespace LinBox
 
 		} // end of getRational3
 
+		/** Rational reconstruction of a vector with a common denominator.
+		 *
+		 * Each component of approx, times the common denominator of the
+		 * previous ones, is reduced modulo modulus and is only
+		 * reconstructed when its symmetric residue is not below numbound.
+		 * The common denominator is found on the first components; once
+		 * LINBOX_RR_STABLE_DEN_COMPONENTS consecutive components have
+		 * needed no reconstruction, the remaining ones are scaled and
+		 * reduced concurrently, by NUM_THREADS tasks each with its own
+		 * scratch integer. The few of them that still have a denominator
+		 * are merged afterwards, in order.
+		 *
+		 * @param[out] num  numerators, over the common denominator den,
+		 * stored contiguously
+		 * @param[out] counter  number of reconstructions
+		 * @return false if a component could not be reconstructed
+		 */
+		template<class Vector1, class Vector2>
+		bool reconstructVector(Vector1& num, Integer& den, const Vector2& approx, const Integer& modulus,
+				       const Integer& numbound, const Integer& denbound, int& counter) const
+		{
+			const size_t n = approx.size();
+			const Ring& R = _r;
+			std::vector<Integer> denominator(n);
+			Integer common_den, s;
+			R.assign(common_den, R.one);
+			counter = 0;
+
+			// common denominator, sequentially
+			size_t i = 0;
+			for (size_t stable = 0; i < n && stable < LINBOX_RR_STABLE_DEN_COMPONENTS; ++i) {
+				if (!Protected::scaledRationalReconstruction(R, num[i], denominator[i], approx[i], common_den,
+									     modulus, numbound, denbound, s))
+					return false;
+				if (R.isOne(denominator[i]))
+					++stable;
+				else {
+					stable = 0;
+					++counter;
+					R.mulin(common_den, denominator[i]);
+				}
+			}
+
+			// remaining components, concurrently
+			if (i < n) {
+				const size_t first = i, NT = std::min<size_t>(std::max<size_t>(1, NUM_THREADS), n - first);
+				std::vector<Integer> scratch(NT, s);
+				std::vector<char> failed(NT, 0);
+				SYNCH_GROUP(
+				for (size_t t = 0; t < NT; ++t) {
+					// task t writes the components first + t, first + t + NT, ...
+					Integer* Nt = &num[first + t];
+					Integer* Dt = denominator.data() + first + t;
+					Integer* S = scratch.data() + t;
+					char* F = failed.data() + t;
+					{ TASK(MODE(CONSTREFERENCE(R, approx, common_den, modulus, numbound, denbound)
+						    WRITE(Nt, Dt, S, F)),
+					       *F = !Protected::scaledRationalReconstructions(R, Nt, Dt, approx, first + t, n, NT, common_den,
+											       modulus, numbound, denbound, *S);)}
+				}
+				)
+				for (size_t t = 0; t < NT; ++t)
+					if (failed[t]) return false;
+
+				// they were scaled by common_den only: put in the denominators found since, as sequentially
+				Integer later, g;
+				R.assign(later, R.one);
+				for (; i < n; ++i) {
+					if (R.isOne(denominator[i])) {
+						if (!R.isOne(later)) R.mulin(num[i], later);
+						continue;
+					}
+					++counter;
+					if (!R.isOne(later)) {
+						R.gcd(g, later, denominator[i]);
+						R.divin(denominator[i], g);
+						R.div(s, later, g);
+						R.mulin(num[i], s);
+					}
+					R.mulin(later, denominator[i]);
+				}
+				R.mulin(common_den, later);
+			}
+
+			// numerators over the common denominator
+			Integer tmp;
+			R.assign(tmp, R.one);
+			for (size_t k = n; k-- > 0; ) {
+				if (R.isOne(tmp) && R.isOne(denominator[k])) continue;
+				R.mulin(num[k], tmp);
+				R.mulin(tmp, denominator[k]);
+			}
+			den = common_den;
+			return true;
+		}
+
 		/*!
 		 * early terminated analog of getRational3.
 		 */
@@ -1047,7 +1109,7 @@ namespace LinBox
 					_r. mulin (zz_p_den,den);
 					_r. modin (zz_p_den,modulus);
 
-					bool tmp = Givaro::Rational::RationalReconstruction(*num_p, tmp_den, zz_p_den, modulus, _lcontainer.numbound(), _lcontainer.denbound());
+					bool tmp = rationalReconstruction(*num_p, tmp_den, zz_p_den, modulus, _lcontainer.numbound(), _lcontainer.denbound());
 #ifdef RSTIMING
 					++counter;
 #endif
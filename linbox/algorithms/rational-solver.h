@@ -581,6 +581,7 @@ namespace LinBox
 	/*-------*/
 
 	#include "./dixon-solver/dixon-solver-dense.h"
+	#include "./dixon-solver/dixon-solver-session.h"
 
 namespace LinBox {
 	/*----------------*/
@@ -330,7 +330,7 @@ namespace LinBox
 
         template<class Vecteur>
         void PreserveUpperMatrixRow(Vecteur& ligne, Boolean_Trait<false>::BooleanType ) {
-            ligne = Vecteur(0);
+            SparseRowPool<Vecteur>::local().release(ligne);
         }
 
 
@@ -356,7 +356,9 @@ namespace LinBox
                         // -------------------------------------------
                         // Elimination
 					size_t npiv = (size_t) lignepivot.size();
-					Vecteur construit(nj + npiv);
+					SparseRowPool<Vecteur> &pool = SparseRowPool<Vecteur>::local();
+					Vecteur construit;
+					pool.acquire(construit, nj + npiv);
                         // construit : <-- ci
                         // courante  : <-- m
                         // pivot     : <-- l
@@ -406,7 +408,8 @@ namespace LinBox
 						*ci++ = lignecourante[(size_t)m++];
 
 					construit.erase(ci,construit.end());
-					lignecourante = construit;
+					lignecourante.swap(construit);
+					pool.release(construit);
                 }
 			}
 		}
@@ -445,22 +448,20 @@ namespace LinBox
                     // assignment of LigneA with the domain object
                 size_t jj;
                 for(jj=0; jj<Ni; ++jj) {
-                    Vecteur tmp = LigneA[(size_t)jj];
-                    Vecteur toto(tmp.size());
+                    Vecteur& ligne = LigneA[(size_t)jj];
                     size_t k=0,rs=0;
-                    for(; k<tmp.size(); ++k) {
-                        Modulo r = tmp[(size_t)k].second;
+                    for(; k<ligne.size(); ++k) {
+                        Modulo r = ligne[(size_t)k].second;
                         if ((r <0) || (r >= MOD)) r %= MOD ;
                         if (r <0) r += MOD ;
                         if (isNZero(r)) {
-                            ++col_density[ tmp[(size_t)k].first ];
-                            toto[rs] =tmp[(size_t)k];
-                            toto[rs].second = ( r );
+                            ++col_density[ ligne[(size_t)k].first ];
+                            if (rs != k) ligne[rs] = ligne[(size_t)k];
+                            ligne[rs].second = ( r );
                             ++rs;
                         }
                     }
-                    toto.resize(rs);
-                    LigneA[(size_t)jj] = toto;
+                    ligne.resize(rs);
                         //                 LigneA[(size_t)jj].reactualsize(Nj);
 
                 }
@@ -521,9 +522,7 @@ namespace LinBox
 #ifdef  LINBOX_pp_gauss_steps_OUT
                         std::cerr << "------------ permuting rows " << p << " and " << k << " ---" << std::endl;
 #endif
-                        Vecteur vtm = LigneA[(size_t)k];
-                        LigneA[(size_t)k] = LigneA[(size_t)p];
-                        LigneA[(size_t)p] = vtm;
+                        std::swap(LigneA[(size_t)k], LigneA[(size_t)p]);
                     }
                     if (c != -1) {
                         REQUIRE( indcol > 0);
@@ -584,6 +583,7 @@ namespace LinBox
 #ifdef LINBOX_PRANK_OUT
                 std::cerr << "Rank mod " << FMOD << " : " << indcol << std::endl;
 #endif
+                SparseRowPool<Vecteur>::local().compact();
                 commentator().stop ("done", 0, "PRGE");
 
             }
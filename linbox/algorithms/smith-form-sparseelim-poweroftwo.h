@@ -250,7 +250,7 @@ namespace LinBox
 
         template<class Vecteur>
         void PreserveUpperMatrixRow(Vecteur& ligne, Boolean_Trait<false>::BooleanType ) {
-            ligne = Vecteur(0);
+            SparseRowPool<Vecteur>::local().release(ligne);
         }
 
         template<class SpMat>
@@ -290,7 +290,9 @@ namespace LinBox
                         // -------------------------------------------
                         // Head non-zero ==> Elimination
                     size_t npiv = (size_t) lignepivot.size();
-                    Vecteur construit(nj + npiv);
+                    SparseRowPool<Vecteur> &pool = SparseRowPool<Vecteur>::local();
+                    Vecteur construit;
+                    pool.acquire(construit, nj + npiv);
                         // construit : <-- ci
                         // courante  : <-- m
                         // pivot     : <-- l
@@ -344,7 +346,8 @@ namespace LinBox
                         *ci++ = lignecourante[(size_t)m++];
 
                     construit.erase(ci,construit.end());
-                    lignecourante = construit;
+                    lignecourante.swap(construit);
+                    pool.release(construit);
                 }
             }
         }
@@ -382,15 +385,18 @@ namespace LinBox
                     // assignment of LigneA with the domain object
                     // and computation of the actual density
                 for(size_t jj=0; jj<Ni; ++jj) {
-                    Vecteur toto;
-                    for(auto const & iter : LigneA[(size_t)jj]) {
-                        UInt_t r = ((UInt_t)iter.second) & TWOKMONE;
+                    Vecteur& ligne = LigneA[(size_t)jj];
+                    size_t rs=0;
+                    for(size_t k=0; k<ligne.size(); ++k) {
+                        UInt_t r = ((UInt_t)ligne[k].second) & TWOKMONE;
                         if (isNZero(r)) {
-                            ++col_density[ iter.first ];
-                            toto.emplace_back(iter.first,r);
+                            ++col_density[ ligne[k].first ];
+                            ligne[rs].first = ligne[k].first;
+                            ligne[rs].second = r;
+                            ++rs;
                         }
                     }
-                    LigneA[(size_t)jj] = toto;
+                    ligne.resize(rs);
                 }
 
                 size_t last = Ni-1;
@@ -456,9 +462,7 @@ namespace LinBox
 #ifdef  LINBOX_pp_gauss_steps_OUT
                         std::cerr << "------------ permuting rows " << p << " and " << k << " ---" << std::endl;
 #endif
-                        Vecteur vtm = LigneA[(size_t)k];
-                        LigneA[(size_t)k] = LigneA[(size_t)p];
-                        LigneA[(size_t)p] = vtm;
+                        std::swap(LigneA[(size_t)k], LigneA[(size_t)p]);
                     }
                     if (c != -1) {
                             // Pivot has been found
@@ -526,6 +530,7 @@ namespace LinBox
 #ifdef LINBOX_PRANK_OUT
                 std::cerr << "Rank mod 2^" << EXPONENTMAX << " : " << indcol << std::endl;
 #endif
+                SparseRowPool<Vecteur>::local().compact();
                 commentator().stop ("done", 0, "PRGEPo2");
 
             }
@@ -0,0 +1,519 @@
+/* linbox/algorithms/subproduct-tree.h
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/subproduct-tree.h
+ * @ingroup algorithms
+ * @brief Fast multipoint evaluation and interpolation over a field
+ * (subproduct tree, or FFT at roots of unity).
+ */
+
+#ifndef __LINBOX_subproduct_tree_H
+#define __LINBOX_subproduct_tree_H
+
+#include <vector>
+#include <algorithm>
+
+#include "linbox/linbox-config.h"
+#include "linbox/util/debug.h"
+#include "linbox/util/error.h"
+#include "linbox/algorithms/polynomial-matrix/fft.h"
+
+// below this length polynomial products are done by the schoolbook method
+#ifndef LINBOX_SUBPRODUCT_KARATSUBA_THRESHOLD
+#define LINBOX_SUBPRODUCT_KARATSUBA_THRESHOLD 32
+#endif
+
+// below this degree remainders are done by plain long division
+#ifndef LINBOX_SUBPRODUCT_NEWTON_THRESHOLD
+#define LINBOX_SUBPRODUCT_NEWTON_THRESHOLD 64
+#endif
+
+namespace LinBox
+{
+
+	/** \brief Subproduct tree of a fixed set of evaluation points.
+	 *
+	 * The tree of the products \f$ \prod (x-a_i) \f$ over the points
+	 * \f$ a_0,\dots,a_{n-1} \f$ is computed once, together with the
+	 * truncated inverses needed by Newton division and the weights
+	 * \f$ 1/M'(a_i) \f$ of the Lagrange interpolation. Evaluation of a
+	 * polynomial at the \f$ n \f$ points and interpolation of \f$ n \f$
+	 * values then both cost \f$ O(M(n)\log n) \f$ field operations, with
+	 * \f$ M(n) \f$ the cost of Karatsuba multiplication
+	 * (see von zur Gathen & Gerhard, Modern Computer Algebra, ch. 10).
+	 *
+	 * Polynomials are dense vectors of coefficients, lowest degree first.
+	 * The tree is read only once built, so it can be shared by threads
+	 * evaluating or interpolating different polynomials.
+	 */
+	template<class _Field>
+	class SubproductTree {
+	public:
+		typedef _Field                          Field;
+		typedef typename Field::Element       Element;
+		typedef std::vector<Element>       Polynomial;
+
+		/** Build the tree.
+		 * @param F field
+		 * @param points pairwise distinct evaluation points
+		 */
+		SubproductTree (const Field &F, const std::vector<Element> &points) :
+			_field(&F), _points(points)
+		{
+			linbox_check(points.size() > 0);
+			buildTree();
+			buildInverses();
+			buildWeights();
+		}
+
+		const Field& field() const { return *_field; }
+
+		//! number of points
+		size_t size() const { return _points.size(); }
+
+		const std::vector<Element>& points() const { return _points; }
+
+		//! \f$ \prod (x-a_i) \f$
+		const Polynomial& root() const { return _tree.back()[0]; }
+
+		/** Evaluate P at all the points.
+		 * @param vals receives the \c size() values
+		 * @param P any random access container of coefficients
+		 */
+		template<class Poly>
+		std::vector<Element>& evaluate (std::vector<Element> &vals, const Poly &P) const
+		{
+			Polynomial A(P.size());
+			for (size_t i=0; i<P.size(); ++i)
+				field().assign(A[i], P[i]);
+			return evaluate(vals, A);
+		}
+
+		std::vector<Element>& evaluate (std::vector<Element> &vals, const Polynomial &P) const
+		{
+			vals.resize(size());
+			size_t top = _tree.size()-1;
+			std::vector<Polynomial> cur(1), next;
+			rem(cur[0], P, top, 0);
+
+			// remainder tree, from the root down to the leaves
+			for (size_t l=top; l-- > 0;){
+				next.resize(_tree[l].size());
+				for (size_t j=0; j<cur.size(); ++j){
+					if (2*j+1 < _tree[l].size()){
+						rem(next[2*j],   cur[j], l, 2*j);
+						rem(next[2*j+1], cur[j], l, 2*j+1);
+					}
+					else // promoted node
+						next[2*j].swap(cur[j]);
+				}
+				cur.swap(next);
+			}
+
+			for (size_t i=0; i<size(); ++i){
+				if (cur[i].size())
+					field().assign(vals[i], cur[i][0]);
+				else
+					field().assign(vals[i], field().zero);
+			}
+			return vals;
+		}
+
+		/** Interpolate.
+		 * @param P receives the unique polynomial of degree < \c size()
+		 *          taking the value \c vals[i] at the i-th point
+		 *          (P has exactly \c size() coefficients)
+		 * @param vals values at the points
+		 */
+		Polynomial& interpolate (Polynomial &P, const std::vector<Element> &vals) const
+		{
+			linbox_check(vals.size() == size());
+			std::vector<Polynomial> cur(size()), next;
+			for (size_t i=0; i<size(); ++i){
+				cur[i].resize(1);
+				field().mul(cur[i][0], vals[i], _weights[i]);
+			}
+
+			// linear combination of the subproducts, from the leaves up
+			Polynomial t;
+			for (size_t l=0; l+1 < _tree.size(); ++l){
+				next.resize(_tree[l+1].size());
+				for (size_t j=0; j<next.size(); ++j){
+					if (2*j+1 < cur.size()){
+						mul(next[j], cur[2*j], _tree[l][2*j+1]);
+						mul(t, cur[2*j+1], _tree[l][2*j]);
+						addin(next[j], t);
+					}
+					else
+						next[j].swap(cur[2*j]);
+				}
+				cur.swap(next);
+			}
+
+			P.swap(cur[0]);
+			P.resize(size(), field().zero);
+			return P;
+		}
+
+		/** c = a*b (Karatsuba above LINBOX_SUBPRODUCT_KARATSUBA_THRESHOLD).
+		 * Exposed since users of the tree usually need a few products of
+		 * polynomials of the same kind.
+		 */
+		Polynomial& mul (Polynomial &c, const Polynomial &a, const Polynomial &b) const
+		{
+			if (a.empty() || b.empty()) {
+				c.clear();
+				return c;
+			}
+			Polynomial r(a.size()+b.size()-1, field().zero);
+			mul(&r[0], &a[0], a.size(), &b[0], b.size());
+			c.swap(r);
+			return c;
+		}
+
+	protected:
+
+		const Field                                *_field;
+		std::vector<Element>                       _points;
+		// _tree[0] are the linear factors, _tree.back()[0] is the root
+		std::vector<std::vector<Polynomial> >        _tree;
+		// _inv[l][j] is rev(_tree[l][j])^-1 mod x^k for the largest
+		// quotient length k met at this node (empty if long division is used)
+		std::vector<std::vector<Polynomial> >         _inv;
+		// 1/M'(a_i)
+		std::vector<Element>                      _weights;
+
+		void buildTree()
+		{
+			size_t n = _points.size();
+			_tree.resize(1);
+			_tree[0].resize(n);
+			for (size_t i=0; i<n; ++i){
+				_tree[0][i].resize(2);
+				field().neg(_tree[0][i][0], _points[i]);
+				field().assign(_tree[0][i][1], field().one);
+			}
+			while (_tree.back().size() > 1){
+				const std::vector<Polynomial> &low = _tree.back();
+				std::vector<Polynomial> up((low.size()+1)>>1);
+				for (size_t j=0; j<low.size()/2; ++j)
+					mul(up[j], low[2*j], low[2*j+1]);
+				if (low.size() & 0x1)
+					up.back() = low.back();
+				_tree.push_back(up);
+			}
+		}
+
+		void buildInverses()
+		{
+			_inv.resize(_tree.size());
+			for (size_t l=0; l<_tree.size(); ++l)
+				_inv[l].resize(_tree[l].size());
+
+			// the root is used to reduce inputs of degree < 2 size()
+			size_t top = _tree.size()-1;
+			size_t n = size();
+			if (n >= LINBOX_SUBPRODUCT_NEWTON_THRESHOLD)
+				inverseReversed(_inv[top][0], _tree[top][0], n);
+
+			for (size_t l=0; l<top; ++l){
+				for (size_t j=0; 2*j+1 < _tree[l].size(); ++j){
+					// children 2j and 2j+1 are reduced from a remainder
+					// modulo their parent of degree D
+					size_t D = _tree[l+1][j].size()-1;
+					for (size_t c=2*j; c<=2*j+1; ++c){
+						size_t m = _tree[l][c].size()-1;
+						size_t k = D-m;
+						if (m >= LINBOX_SUBPRODUCT_NEWTON_THRESHOLD && k >= LINBOX_SUBPRODUCT_NEWTON_THRESHOLD)
+							inverseReversed(_inv[l][c], _tree[l][c], k);
+					}
+				}
+			}
+		}
+
+		void buildWeights()
+		{
+			// M'(a_i) obtained by multipoint evaluation of the derivative
+			const Polynomial &M = root();
+			Polynomial dM(M.size()-1);
+			Element c;
+			field().assign(c, field().zero);
+			for (size_t i=1; i<M.size(); ++i){
+				field().addin(c, field().one);
+				field().mul(dM[i-1], M[i], c);
+			}
+			evaluate(_weights, dM);
+			for (size_t i=0; i<_weights.size(); ++i){
+				if (field().isZero(_weights[i]))
+					throw LinboxError("SubproductTree: evaluation points are not distinct");
+				field().invin(_weights[i]);
+			}
+		}
+
+		// r = A mod _tree[l][j]
+		void rem (Polynomial &r, const Polynomial &A, size_t l, size_t j) const
+		{
+			const Polynomial &M = _tree[l][j];
+			const Polynomial &I = _inv[l][j];
+			size_t m = M.size()-1;
+			if (A.size() <= m) {
+				r = A;
+				return;
+			}
+			size_t k = A.size()-m;
+			if (I.size() >= k && k >= LINBOX_SUBPRODUCT_NEWTON_THRESHOLD)
+				remNewton(r, A, M, I, k);
+			else
+				remLong(r, A, M);
+		}
+
+		// long division by the monic M
+		void remLong (Polynomial &r, const Polynomial &A, const Polynomial &M) const
+		{
+			size_t m = M.size()-1;
+			Polynomial R(A);
+			for (size_t i=R.size(); i-- > m;){
+				if (field().isZero(R[i]))
+					continue;
+				Element q;
+				field().neg(q, R[i]);
+				for (size_t t=0; t<m; ++t)
+					field().axpyin(R[i-m+t], q, M[t]);
+			}
+			R.resize(m);
+			r.swap(R);
+		}
+
+		// Newton division: the k coefficients of the quotient are the
+		// reversal of rev(A)*I mod x^k
+		void remNewton (Polynomial &r, const Polynomial &A, const Polynomial &M,
+				const Polynomial &I, size_t k) const
+		{
+			size_t m = M.size()-1;
+			Polynomial revA(k);
+			for (size_t i=0; i<k; ++i)
+				field().assign(revA[i], A[A.size()-1-i]);
+			Polynomial Iq(I.begin(), I.begin()+k);
+			Polynomial q;
+			mul(q, revA, Iq);
+			q.resize(k);
+			std::reverse(q.begin(), q.end());
+
+			// only the m low coefficients of q*M are needed
+			Polynomial ql(q.begin(), q.begin()+std::min(k,m));
+			Polynomial Ml(M.begin(), M.begin()+m);
+			Polynomial qM;
+			mul(qM, ql, Ml);
+			Polynomial R(A.begin(), A.begin()+m);
+			for (size_t i=0; i<m && i<qM.size(); ++i)
+				field().subin(R[i], qM[i]);
+			r.swap(R);
+		}
+
+		// g = rev(M)^-1 mod x^k by Newton iteration (M is monic)
+		void inverseReversed (Polynomial &g, const Polynomial &M, size_t k) const
+		{
+			size_t m = M.size()-1;
+			Polynomial f(std::min(k, m+1));
+			for (size_t i=0; i<f.size(); ++i)
+				field().assign(f[i], M[m-i]);
+
+			g.assign(1, field().one);
+			Polynomial e, t;
+			for (size_t prec=1; prec < k;){
+				size_t prec2 = std::min(2*prec, k);
+				Polynomial ft(f.begin(), f.begin()+std::min(prec2, f.size()));
+				mul(e, ft, g);
+				e.resize(prec2, field().zero);
+				// e = f*g - 1 is zero below prec
+				field().subin(e[0], field().one);
+				Polynomial eh(e.begin()+prec, e.end());
+				mul(t, g, eh);
+				g.resize(prec2, field().zero);
+				for (size_t i=prec; i<prec2; ++i)
+					field().subin(g[i], t[i-prec]);
+				prec = prec2;
+			}
+		}
+
+		void addin (Polynomial &a, const Polynomial &b) const
+		{
+			if (a.size() < b.size())
+				a.resize(b.size(), field().zero);
+			for (size_t i=0; i<b.size(); ++i)
+				field().addin(a[i], b[i]);
+		}
+
+		// c[0..na+nb-2] = a*b, c does not alias a nor b
+		void mul (Element *c, const Element *a, size_t na, const Element *b, size_t nb) const
+		{
+			if (na < nb){
+				std::swap(a,b);
+				std::swap(na,nb);
+			}
+			for (size_t i=0; i<na+nb-1; ++i)
+				field().assign(c[i], field().zero);
+
+			if (nb < LINBOX_SUBPRODUCT_KARATSUBA_THRESHOLD){
+				for (size_t i=0; i<na; ++i)
+					for (size_t j=0; j<nb; ++j)
+						field().axpyin(c[i+j], a[i], b[j]);
+				return;
+			}
+
+			// slice the longest operand in chunks of the size of the other
+			Polynomial t(2*nb-1);
+			for (size_t i=0; i<na; i+=nb){
+				size_t len = std::min(nb, na-i);
+				if (len == nb)
+					karatsuba(&t[0], a+i, b, nb);
+				else
+					mul(&t[0], b, nb, a+i, len);
+				for (size_t s=0; s<len+nb-1; ++s)
+					field().addin(c[i+s], t[s]);
+			}
+		}
+
+		// c[0..2n-2] = a*b with a and b of length n
+		void karatsuba (Element *c, const Element *a, const Element *b, size_t n) const
+		{
+			if (n < 2 || n < LINBOX_SUBPRODUCT_KARATSUBA_THRESHOLD){
+				for (size_t i=0; i<2*n-1; ++i)
+					field().assign(c[i], field().zero);
+				for (size_t i=0; i<n; ++i)
+					for (size_t j=0; j<n; ++j)
+						field().axpyin(c[i+j], a[i], b[j]);
+				return;
+			}
+			size_t h = n>>1, hh = n-h;
+			Polynomial z0(2*h-1), z1(2*hh-1), z2(2*hh-1), sa(hh), sb(hh);
+			karatsuba(&z0[0], a, b, h);
+			karatsuba(&z2[0], a+h, b+h, hh);
+			for (size_t i=0; i<hh; ++i){
+				field().assign(sa[i], a[h+i]);
+				field().assign(sb[i], b[h+i]);
+			}
+			for (size_t i=0; i<h; ++i){
+				field().addin(sa[i], a[i]);
+				field().addin(sb[i], b[i]);
+			}
+			karatsuba(&z1[0], &sa[0], &sb[0], hh);
+			for (size_t i=0; i<z0.size(); ++i)
+				field().subin(z1[i], z0[i]);
+			for (size_t i=0; i<z2.size(); ++i)
+				field().subin(z1[i], z2[i]);
+
+			for (size_t i=0; i<2*n-1; ++i)
+				field().assign(c[i], field().zero);
+			for (size_t i=0; i<z0.size(); ++i)
+				field().addin(c[i], z0[i]);
+			for (size_t i=0; i<z1.size(); ++i)
+				field().addin(c[h+i], z1[i]);
+			for (size_t i=0; i<z2.size(); ++i)
+				field().addin(c[2*h+i], z2[i]);
+		}
+	};
+
+	/** \brief Evaluation/interpolation at the 2^k-th roots of unity.
+	 *
+	 * Companion of SubproductTree when the field has a primitive 2^k-th root
+	 * of unity with 2^k >= the number of points: evaluation and interpolation
+	 * are then direct and inverse FFT (see FFT in polynomial-matrix/fft.h).
+	 * The generic version only exists so that callers can test available()
+	 * for any field.
+	 */
+	template<class Field, bool = is_fft_field<Field>::value>
+	class DFTEvaluation {
+	public:
+		typedef typename Field::Element Element;
+
+		static bool available (const Field &, size_t) { return false; }
+
+		DFTEvaluation (const Field &, size_t)
+		{
+			throw LinboxError("DFTEvaluation: no FFT for this field");
+		}
+
+		size_t size() const { return 0; }
+		void direct (Element *) const {}
+		void inverse (Element *) const {}
+		const Element& scaling() const { return _dummy; }
+	private:
+		Element _dummy;
+	};
+
+	template<class Field>
+	class DFTEvaluation<Field, true> {
+	public:
+		typedef typename Field::Element Element;
+
+		//! true if the field has a primitive 2^k-th root of unity, 2^k >= numpoints
+		static bool available (const Field &F, size_t numpoints)
+		{
+			return logSize(numpoints) <= FFT_utils::two_adic_valuation(F);
+		}
+
+		DFTEvaluation (const Field &F, size_t numpoints) :
+			_lpts(logSize(numpoints)), _pts(size_t(1)<<_lpts),
+			_direct(F, _lpts), _inverse(F, _lpts, _direct.invroot())
+		{
+			F.init(_inv_pts, (uint64_t)_pts);
+			F.invin(_inv_pts);
+		}
+
+		size_t size() const { return _pts; }
+
+		//! in place transform of size() coefficients, output in bitreversed order
+		void direct (Element *coeffs) const { _direct.FFT_direct(coeffs); }
+
+		//! inverse of direct() up to the factor scaling()
+		void inverse (Element *coeffs) const { _inverse.FFT_inverse(coeffs); }
+
+		//! 1/size()
+		const Element& scaling() const { return _inv_pts; }
+
+	private:
+		static size_t logSize (size_t numpoints)
+		{
+			size_t l=1;
+			while ((size_t(1)<<l) < numpoints) ++l;
+			return l;
+		}
+
+		size_t         _lpts;
+		size_t          _pts;
+		FFT<Field>   _direct;
+		FFT<Field>  _inverse;
+		Element     _inv_pts;
+	};
+
+} // end of namespace LinBox
+
+#endif //__LINBOX_subproduct_tree_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
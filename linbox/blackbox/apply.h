@@ -39,11 +39,16 @@
 // #error "you need to include \"multimod-field.h\" before \"blas-domain.h\""
 // #endif
 #include "linbox/field/multimod-field.h"
+#include "linbox/field/field-traits.h"
 #include "linbox/field/hom.h"
+#include "linbox/ring/modular.h"
 #include "linbox/randiter/multimod-randomprime.h"
+#include "linbox/randiter/prime-pool.h"
 #include "linbox/matrix/sparse-matrix.h"
 #include "linbox/matrix/dense-matrix.h"
 #include "linbox/algorithms/lifting-container.h"
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include "linbox/vector/blas-vector.h"
 
@@ -61,6 +66,11 @@
 //#define CHECK_APPLY
 #define TIMING_APPLY
 
+//! Cost of an Integer multiply-add, per 64-bit word, in BLAS multiply-adds (cost model of BlasMatrixApplyDomain::setup)
+#ifndef LINBOX_APPLY_INTEGER_COST
+#define LINBOX_APPLY_INTEGER_COST 64.0
+#endif
+
 namespace LinBox
 {
 
@@ -320,13 +330,24 @@ namespace LinBox
 
 
 
-	// \brief optimizations for applying an integer matrix to a bounded integer vector
+	/** \brief optimizations for applying an integer matrix to a bounded integer vector
+	 *
+	 * The vectors are p-adic digits, for the prime p given to setup(),
+	 * which picks the cheapest of:
+	 * - Classic: Integer product;
+	 * - MatrixQadic: the matrix cut in 16-bit chunks, one BLAS product per chunk;
+	 * - VectorQadic: the vector cut in 16-bit chunks, one BLAS product per chunk;
+	 * - CRT: residues modulo small primes, completed by the residue modulo p;
+	 * - RNS: the matrix kept modulo primes of the shared prime pool, one
+	 *   FFLAS product per prime and a Garner recombination done in
+	 *   floating point, row by row in vector loops.
+	 */
 	template <class Domain, class IMatrix>
 	class BlasMatrixApplyDomain {
 
-		enum ApplyChoice {Classic, MatrixQadic, VectorQadic, CRT};
-
 	public:
+		enum ApplyChoice {Classic, MatrixQadic, VectorQadic, CRT, RNS};
+
 		typedef typename Domain::Element   Element;
 		typedef BlasVector<Domain>         Vector;
 		typedef IMatrix                      Matrix;
@@ -352,7 +373,20 @@ namespace LinBox
 			//std::cout<<"time convert result = "<<_convert_result<<std::endl;
 		}
 
+		/// Prepares the products by vectors of p-adic digits, with the cheapest strategy for this matrix and p = prime
 		ApplyChoice  setup(LinBox::integer prime)
+		{
+			return setup(prime, Classic, false);
+		}
+
+		/// Same as setup(prime), with the strategy choice whenever it applies to this matrix and prime
+		ApplyChoice  setup(LinBox::integer prime, ApplyChoice choice)
+		{
+			return setup(prime, choice, true);
+		}
+
+	protected:
+		ApplyChoice  setup(LinBox::integer prime, ApplyChoice choice, bool forced)
 		{ //setup
 
 			_domain.init(_prime,prime);
@@ -387,37 +421,49 @@ namespace LinBox
 			LinBox::integer maxChunkVal = 1;
 			maxChunkVal <<= 53;
 			maxChunkVal /= (prime-1) * uint64_t(_n);
-			chunk_size = maxChunkVal.bitsize();
-			use_chunks = (chunk_size >= 16);
-			//std::cout<<"max bit= "<<maxBitSize<<" "<<maxValue.size_in_base(4)*2<<"\n";std::cout<<"max value= "<<maxValue<<"\n";
-			if (use_chunks){//std::cout<<"Matrix Qadic\n";
-				_switcher= MatrixQadic;
+			const bool mqadic = (maxChunkVal.bitsize() >= 16);
 
-			}
+			// Check Qadic vector representation possibility
+			maxChunkVal = 1;
+			maxChunkVal <<= 53;
+			maxChunkVal /= 2*std::max(maxValue, integer(1)) * uint64_t(_n);
+			const bool vqadic = (maxChunkVal.bitsize() >= 16);
+
+			// |A.x| <= maxValue n (p-1), determined by residues modulo a product larger than twice that
+			const integer rns_bound = 2*maxValue*uint64_t(_n)*(prime-1) + 1;
+			_rnsBits = std::min<size_t>(26, FieldTraits<Givaro::ModularBalanced<double> >::bestBitSize(_n));
+			const size_t rns_size = rnsLength(_rnsBits, rns_bound);
+
+			// cost model: operations of one applyV, a BLAS multiply-add counting for one
+			const double mn = double(_m)*double(_n), big = LINBOX_APPLY_INTEGER_COST;
+			const double words = double((maxBitSize + prime.bitsize()) / 64 + 1);
+			const double mq_chunks = (maxValue*prime*uint64_t(_n) < integer("9007199254740992")) ? 1.0 : double((maxBitSize + 16) / 16);
+			const double vq_chunks = double((prime.bitsize() + 15) / 16);
+			const double crt_size = std::ceil(double(integer(2*maxValue*uint64_t(_n)+1).bitsize()) / (26.5 - 0.5*std::log2(double(_n))));
+			const double k = double(rns_size);
+
+			double cost[5];
+			bool valid[5];
+			cost[Classic]     = mn*big*words;
+			valid[Classic]    = true;
+			cost[MatrixQadic] = mn*mq_chunks + double(_m)*mq_chunks*big;
+			valid[MatrixQadic]= mqadic;
+			cost[VectorQadic] = mn*vq_chunks + double(_m)*vq_chunks*big;
+			valid[VectorQadic]= vqadic;
+			cost[CRT]         = mn*crt_size + double(_n)*crt_size*big + double(_m)*crt_size*crt_size*big;
+			valid[CRT]        = (prime.bitsize() > 32);
+			cost[RNS]         = mn*k + 4*double(_n)*k + 2*double(_m)*k*k + double(_m)*k*big;
+			valid[RNS]        = (prime.bitsize() <= 52); // digits as doubles
+
+			if (forced && valid[choice])
+				_switcher = choice;
 			else {
-				// Check Qadic vector representation possibility
-				maxChunkVal = 1;
-				maxChunkVal <<= 53;
-				maxChunkVal /= 2*maxValue * uint64_t(_n);
-				chunk_size = maxChunkVal.bitsize();
-				use_chunks = (chunk_size >= 16);
-
-				if (use_chunks){//std::cout<<"Vector Qadic\n";
-					_switcher= VectorQadic;
-
-					//std::cout<<"possible chunk size: "<<chunk_size<<std::endl;
-				}
-				else {
-					if (prime.bitsize()> 32){//std::cout<<"CRT\n";
-						_switcher= CRT;
-
-					}
-					else {//std::cout<<"Classic\n";
-						_switcher= Classic;
-
-					}
-				}
+				_switcher = Classic;
+				for (int c = MatrixQadic; c <= RNS; ++c)
+					if (valid[c] && cost[c] < cost[_switcher])
+						_switcher = ApplyChoice(c);
 			}
+			use_chunks = (_switcher == MatrixQadic || _switcher == VectorQadic);
 
 			// set maximum size of chunk to 16
 			chunk_size = 16;
@@ -491,6 +537,35 @@ namespace LinBox
 			case Classic:
 				break;
 
+			case RNS:
+				{
+					PrimePool& pool = PrimePool::shared();
+					_rnsModuli.resize(rns_size);
+					_rnsGarner.resize(rns_size);
+					_rnsRadix.resize(rns_size*rns_size);
+					_rnsFields.clear();
+					for (size_t i = 0; i < rns_size; ++i) {
+						_rnsModuli[i] = pool.prime(_rnsBits, i).p;
+						_rnsFields.emplace_back(double(_rnsModuli[i]));
+						_rnsGarner[i] = double(pool.crtInverse(_rnsBits, i));
+					}
+					for (size_t i = 0; i < rns_size; ++i)
+						for (size_t j = 0; j < rns_size; ++j)
+							_rnsFields[i].init(_rnsRadix[i*rns_size+j], double(_rnsModuli[j]));
+
+					// the matrix modulo each prime, balanced
+					_rnsMat.resize(rns_size*_m*_n);
+					typename Matrix::ConstIterator it2 = _matM.Begin();
+					for (size_t l = 0; l < _m*_n; ++l, ++it2) {
+						_domain.convert(tmp, *it2);
+						for (size_t i = 0; i < rns_size; ++i)
+							_rnsFields[i].init(_rnsMat[i*_m*_n+l], tmp);
+					}
+					_rnsVec.resize(rns_size*_n);
+					_rnsRes.resize(rns_size*_m);
+				}
+				break;
+
 			case CRT:
 				if (use_neg){
 					maxValue= maxValue<<1;
@@ -535,6 +610,7 @@ namespace LinBox
 			return _switcher;
 		}
 
+	public:
 
 		//#define DEBUG_CHUNK_APPLY
 		Vector& applyV(Vector& y, Vector& x, Vector &b) const
@@ -781,6 +857,46 @@ namespace LinBox
 				}
 				break;
 
+			case RNS:
+				{
+#ifdef TIMING_APPLY
+					Timer chrono;
+					chrono.clear();
+					chrono.start();
+#endif
+					const size_t k = _rnsFields.size();
+					// the digits modulo each prime
+					for (size_t j = 0; j < _n; ++j) {
+						double xj;
+						_domain.convert(xj, x[j]);
+						for (size_t i = 0; i < k; ++i)
+							_rnsFields[i].init(_rnsVec[i*_n+j], xj);
+					}
+#ifdef TIMING_APPLY
+					chrono.stop();
+					_convert_data+=chrono;
+					chrono.clear();
+					chrono.start();
+#endif
+					for (size_t i = 0; i < k; ++i)
+						FFLAS::fgemv(_rnsFields[i], FFLAS::FflasNoTrans, _m, _n,
+							     _rnsFields[i].one, _rnsMat.data()+i*_m*_n, _n,
+							     _rnsVec.data()+i*_n, 1,
+							     _rnsFields[i].zero, _rnsRes.data()+i*_m, 1);
+#ifdef TIMING_APPLY
+					chrono.stop();
+					_apply+=chrono;
+					chrono.clear();
+					chrono.start();
+#endif
+					rnsRecombine(y.begin(), _rnsRes.data(), _m);
+#ifdef TIMING_APPLY
+					chrono.stop();
+					_convert_result+=chrono;
+#endif
+				}
+				break;
+
 			case CRT:
 
 				{
@@ -921,7 +1037,26 @@ namespace LinBox
 			linbox_check( _m == Y.rowdim());
 			linbox_check( Y.coldim() == X.coldim());
 
-			if (!use_chunks){
+			if (_switcher == RNS) {
+				// the recombination writes the rows of Y one after the other
+				linbox_check( Y.getStride() == Y.coldim());
+				// as applyV, the entries of X are p-adic digits
+				const size_t k = _rnsFields.size(), _k = X.coldim();
+				std::vector<double> rX(k*_n*_k), rY(k*_m*_k);
+				for (size_t i = 0; i < _n; ++i)
+					for (size_t j = 0; j < _k; ++j) {
+						double xij;
+						_domain.convert(xij, X.getEntry(i,j));
+						for (size_t l = 0; l < k; ++l)
+							_rnsFields[l].init(rX[l*_n*_k+i*_k+j], xij);
+					}
+				for (size_t l = 0; l < k; ++l)
+					FFLAS::fgemm(_rnsFields[l], FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, _m, _k, _n,
+						     _rnsFields[l].one, _rnsMat.data()+l*_m*_n, _n, rX.data()+l*_n*_k, _k,
+						     _rnsFields[l].zero, rY.data()+l*_m*_k, _k);
+				rnsRecombine(Y.getPointer(), rY.data(), _m*_k);
+			}
+			else if (!use_chunks){
 				_MD.mul (Y, _matM, X);
 			}
 			else{
@@ -1035,6 +1170,63 @@ namespace LinBox
 
 
 	protected:
+
+		/// Number of primes of the pool, of \p bits bits, whose product exceeds \p bound
+		static size_t rnsLength(size_t bits, const integer& bound)
+		{
+			integer Q(1);
+			size_t k = 0;
+			for (; Q <= bound; ++k)
+				Q *= integer(PrimePool::shared().prime(bits, k).p);
+			return k;
+		}
+
+		/** Values of len products from their balanced residues R[i*len+r]
+		 * modulo the pool primes, overwritten by the mixed radix digits.
+		 *
+		 * The digits are found prime after prime for all the entries at
+		 * once, by Garner's algorithm in floating point: the partial sums
+		 * stay below \f$2^{53}\f$ as the primes have at most 26 bits.
+		 */
+		template <class OutIterator>
+		void rnsRecombine(OutIterator out, double* R, size_t len) const
+		{
+			const size_t k = _rnsFields.size();
+			std::vector<double> acc(len);
+			for (size_t i = 1; i < k; ++i) {
+				const double q = double(_rnsModuli[i]), invq = 1.0/q, hq = q/2, c = _rnsGarner[i];
+				// acc = v_0 + q_0 (v_1 + ... + q_{i-2} v_{i-1}) mod q_i, Horner from v_{i-1}
+				std::copy(R+(i-1)*len, R+i*len, acc.begin());
+				for (size_t j = i-1; j-- > 0; ) {
+					const double radix = _rnsRadix[i*k+j];
+					const double* Vj = R+j*len;
+					for (size_t r = 0; r < len; ++r) {
+						const double a = acc[r]*radix + Vj[r];
+						acc[r] = a - q*std::floor(a*invq + 0.5);
+					}
+				}
+				// v_i = (r_i - acc) / (q_0 ... q_{i-1}) mod q_i
+				double* Ri = R+i*len;
+				for (size_t r = 0; r < len; ++r) {
+					double a = std::fmod(std::fmod(Ri[r] - acc[r], q)*c, q);
+					if (a > hq) a -= q;
+					else if (a < -hq) a += q;
+					Ri[r] = a;
+				}
+			}
+
+			// balanced digits: the value is in ]-Q/2, Q/2[
+			integer res;
+			for (size_t r = 0; r < len; ++r, ++out) {
+				res = int64_t(R[(k-1)*len+r]);
+				for (size_t i = k-1; i-- > 0; ) {
+					res *= uint64_t(_rnsModuli[i]);
+					res += int64_t(R[i*len+r]);
+				}
+				_domain.init(*out, res);
+			}
+		}
+
 		Domain                             _domain;
 		const IMatrix                     &_matM;
 		MatrixDomain<Domain>              _MD;
@@ -1052,6 +1244,15 @@ namespace LinBox
 		ApplyChoice     _switcher;
 		MultiModDouble      *_rns;
 		Element            _prime, _q, _inv_q, _pq, _h_pq;
+
+		// RNS strategy: the matrix modulo primes of the shared pool
+		size_t                                   _rnsBits;
+		std::vector<Givaro::ModularBalanced<double> > _rnsFields;
+		std::vector<uint64_t>                    _rnsModuli;
+		std::vector<double>                      _rnsGarner;  //!< inverse of q_0...q_{i-1} modulo q_i
+		std::vector<double>                      _rnsRadix;   //!< q_j modulo q_i, at i*k+j
+		std::vector<double>                      _rnsMat;
+		mutable std::vector<double>              _rnsVec, _rnsRes;
 		mutable Timer              _apply, _convert_data, _convert_result;
 
 
@@ -69,7 +69,9 @@ namespace LinBox
 		// Constructor from a stl vector of BlasMatrix representing
 		// all different elements in the Hankel representation
 		// vector is of odd size and represent the 1st column and last row append together
-		BlockHankelInverse(const Field &F, const std::vector<BlasMatrix<Field> > &P) :
+		// e is the evaluation scheme of the four BlockHankel factors (see BlockHankelTag)
+		BlockHankelInverse(const Field &F, const std::vector<BlasMatrix<Field> > &P,
+				   BlockHankelTag::evaluation e = BlockHankelTag::automatic) :
 			_field(&F), _VD(F), _BMD(F)
 		{
 			//write_maple("UAV",P);
@@ -208,7 +210,7 @@ namespace LinBox
 			rev_poly.erase(rev_poly.begin());
 
 
-			_H1 = new BlockHankel<Field>  (field(), rev_poly, BlockHankelTag::up); // V
+			_H1 = new BlockHankel<Field>  (field(), rev_poly, BlockHankelTag::up, e); // V
 
 			rev_poly.resize(SRP2.size());
 			const BlasMatrix<Field> Zero(field(),block,block);
@@ -219,12 +221,12 @@ namespace LinBox
 
 
 
-			_H2 = new BlockHankel<Field>  (field(), rev_poly, BlockHankelTag::up); // Q
+			_H2 = new BlockHankel<Field>  (field(), rev_poly, BlockHankelTag::up, e); // Q
 
-			_T1 = new BlockHankel<Field>  (field(), SLP1, BlockHankelTag::up); // Qstar
+			_T1 = new BlockHankel<Field>  (field(), SLP1, BlockHankelTag::up, e); // Qstar
 
 			SLP2.erase(SLP2.begin());
-			_T2 = new BlockHankel<Field>  (field(), SLP2, BlockHankelTag::up); // Vstar
+			_T2 = new BlockHankel<Field>  (field(), SLP2, BlockHankelTag::up, e); // Vstar
 
 		}
 
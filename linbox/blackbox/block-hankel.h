@@ -26,13 +26,21 @@
 #define __LINBOX_bb_block_hankel_H
 
 #include <vector>
+#include <memory>
 #include "linbox/matrix/dense-matrix.h"
 #include "linbox/vector/vector-domain.h"
 #include "linbox/matrix/matrix-domain.h"
 #include "linbox/util/debug.h"
+#include "linbox/algorithms/subproduct-tree.h"
 
 //#define BHANKEL_TIMER
 
+// number of evaluation points from which the Vandermonde matrices
+// (quadratic memory, cubic precomputation) are replaced by a subproduct tree
+#ifndef LINBOX_BLOCK_HANKEL_SUBPRODUCT_THRESHOLD
+#define LINBOX_BLOCK_HANKEL_SUBPRODUCT_THRESHOLD 256
+#endif
+
 
 namespace LinBox
 {
@@ -40,6 +48,14 @@ namespace LinBox
 	class BlockHankelTag {
 	public:
 		typedef enum{low,up,plain} shape;
+		/** How the vector polynomial is evaluated and interpolated in apply():
+		 * - vandermonde: products by (inverse) Vandermonde matrices at 0,1,..,
+		 * - subproducttree: fast multipoint evaluation at 0,1,.. (large degrees),
+		 * - dft: FFT at the 2^k-th roots of unity (needs 2^k | p-1),
+		 * - automatic: dft if possible, subproducttree above
+		 *   LINBOX_BLOCK_HANKEL_SUBPRODUCT_THRESHOLD points, vandermonde otherwise.
+		 */
+		typedef enum{automatic,vandermonde,subproducttree,dft} evaluation;
 	};
 
 
@@ -221,10 +237,15 @@ namespace LinBox
 		// all different elements in the Hankel representation
 		// order of element will depend on first column and/or  last row
 		// (plain->[column|row];  up -> [column]; low -> [row];)
-		BlockHankel (Field &F, const std::vector<BlasMatrix<Field> > &H, BlockHankelTag::shape s= BlockHankelTag::plain) :
+		// The matrix polynomial is evaluated once here according to e
+		// (see BlockHankelTag::evaluation), apply() only evaluates and
+		// interpolates the vector.
+		BlockHankel (const Field &F, const std::vector<BlasMatrix<Field> > &H,
+			     BlockHankelTag::shape s= BlockHankelTag::plain,
+			     BlockHankelTag::evaluation e= BlockHankelTag::automatic) :
 			_field(&F), _BMD(F)
 		{
-			linbox_check( H.begin()->rowdim() != H.begin()->coldim());
+			linbox_check( H.begin()->rowdim() == H.begin()->coldim());
 
 
 			switch (s) {
@@ -238,7 +259,6 @@ namespace LinBox
 					_row = _rowblock*_block;
 					_col = _row;
 					_shape = s;
-					BlockHankelEvaluation( field(), _matpoly, H, _deg+_colblock-1);
 				}
 				break;
 			case BlockHankelTag::up :
@@ -250,7 +270,6 @@ namespace LinBox
 					_row   = _rowblock*_block;
 					_col   = _row;
 					_shape = s;
-					BlockHankelEvaluation( field(), _matpoly, H, _deg+_colblock-1);
 				}
 				break;
 			case BlockHankelTag::low :
@@ -262,25 +281,130 @@ namespace LinBox
 					_row   = _rowblock*_block;
 					_col   = _row;
 					_shape = s;
-					BlockHankelEvaluation( field(), _matpoly, H, _deg+_colblock-1);
 				}
 				break;
 			}
 			_numpoints = _deg+_colblock-1;
+			// get the result according to the right part of the polynomial
+			_shift=_colblock-1;
+			if ( _shape == BlockHankelTag::up)
+				_shift=0;
+
+			if (e == BlockHankelTag::automatic) {
+				if (DFTEvaluation<Field>::available(F, _numpoints))
+					e = BlockHankelTag::dft;
+				else if (_numpoints >= LINBOX_BLOCK_HANKEL_SUBPRODUCT_THRESHOLD)
+					e = BlockHankelTag::subproducttree;
+				else
+					e = BlockHankelTag::vandermonde;
+			}
+			_evaluation = e;
+
+			switch (_evaluation) {
+			case BlockHankelTag::dft :
+				initDFT(H);
+				break;
+			case BlockHankelTag::subproducttree :
+				checkPoints();
+				initSubproductTree(H);
+				break;
+			default :
+				checkPoints();
+				BlockHankelEvaluation( field(), _matpoly, H, _numpoints);
+				initVandermonde();
+				break;
+			}
+
+			_Tapply.clear();
+			_Teval.clear();
+			_Tinterp.clear();
+		}
+
+		// Copy construtor
+		// the precomputed evaluation data (tree, transforms and
+		// Vandermonde matrices) is shared and never modified
+		BlockHankel (const BlockHankel<Field> &H) :
+			_field(H._field), _matpoly (H._matpoly), _vecpoly(H._vecpoly), _resvecpoly(H._resvecpoly),
+			_veclagrange(H._veclagrange), _vander(H._vander), _partial_vander(H._partial_vander),
+			_inv_vander(H._inv_vander), _partial_inv_vander(H._partial_inv_vander),
+			_y(H._y), _x(H._x), _tree(H._tree), _dft(H._dft), _dftvec(H._dftvec), _BMD(*H._field),
+			_deg(H._deg), _row(H._row), _col(H._col), _rowblock(H._rowblock), _colblock(H._colblock),
+			_block(H._block), _numpoints(H._numpoints), _shift(H._shift),
+			_shape(H._shape), _evaluation(H._evaluation)
+		{}
+
+		// get the column dimension
+		size_t coldim() const {return _col;}
+
+		// get the row dimension
+		size_t rowdim() const {return _row;}
+
+		const Field& field() const { return *_field;}
+
+		// get the block dimension
+		size_t blockdim() const {return _block;}
+
+		// how apply() evaluates and interpolates
+		BlockHankelTag::evaluation evaluation() const { return _evaluation;}
+
+
+		// apply the blackbox to a vector
+		template<class Vector1, class Vector2>
+		Vector1& apply(Vector1 &x, const Vector2 &y) const
+		{
+			linbox_check(this->_col == y.size());
+			linbox_check(this->_row == x.size());
+			switch (_evaluation) {
+			case BlockHankelTag::dft :
+				return applyDFT(x, y);
+			case BlockHankelTag::subproducttree :
+				return applySubproductTree(x, y);
+			default :
+				return applyVandermonde(x, y);
+			}
+		}
+
+
+		~BlockHankel() {}
+
+		// apply the transposed of the blackbox to a vector
+		template<class Vector1, class Vector2>
+		Vector1& applyTranspose(Vector1 &x, const Vector2 &y) const
+		{
+			return apply(x,y);
+		}
+
+	protected:
+
+		void checkPoints() const
+		{
 			integer prime;
-			F.characteristic(prime);
+			field().characteristic(prime);
 			if (integer(_numpoints) > prime){
 				std::cout<<"LinBox ERROR: prime ("<<prime<<") is too small for number of block ("<< _numpoints <<") in block Hankel blackbox\n";
 				throw LinboxError("LinBox ERROR: prime too small in block Hankel blackbox\n");
 			}
+		}
+
+		// the product at the points of the (mirrored) matrix polynomial
+		// and of the vector polynomial given by y
+		void pointwiseApply() const
+		{
+			for (size_t i=0;i<_vecpoly.size();++i)
+				_BMD.mul(_resvecpoly[i], _matpoly[i], _vecpoly[i]);
+		}
 
+		void initVandermonde()
+		{
+			const Field &F = field();
 			_vecpoly.resize(_numpoints, std::vector<Element>(_block));
+			_resvecpoly.resize(_numpoints, std::vector<Element>(_block));
 			_veclagrange.resize(_numpoints);
 			BHVectorLagrangeCoeff(field(), _veclagrange, _numpoints);
 
 
-			_vander     = BlasMatrix<Field> (_field,_numpoints,_numpoints);
-			_inv_vander = BlasMatrix<Field> (_field,_numpoints,_numpoints);
+			_vander     = BlasMatrix<Field> (F,_numpoints,_numpoints);
+			_inv_vander = BlasMatrix<Field> (F,_numpoints,_numpoints);
 
 			std::vector<Element> points(_numpoints);
 			for (size_t i=0;i<_numpoints;++i){
@@ -300,54 +424,65 @@ namespace LinBox
 
 			//! @warning memory wasted
 			_partial_vander= BlasMatrix<Field> (_vander, 0, 0, _numpoints, _colblock);
-			size_t shift=_colblock-1;
-			if ( _shape == BlockHankelTag::up)
-				shift=0;
-
-			_partial_inv_vander= BlasMatrix<Field> (_inv_vander, shift, 0, _colblock, _numpoints);
+			_partial_inv_vander= BlasMatrix<Field> (_inv_vander, _shift, 0, _colblock, _numpoints);
 
-			_x = BlasMatrix<Field> (_field,_numpoints, _block);
-			_y = BlasMatrix<Field> (_field,_colblock, _block);
-
-
-			_Tapply.clear();
-			_Teval.clear();
-			_Tinterp.clear();
+			_x = BlasMatrix<Field> (F,_numpoints, _block);
+			_y = BlasMatrix<Field> (F,_colblock, _block);
 		}
 
-		// Copy construtor
-		BlockHankel (const BlockHankel<Field> &H) :
-			_field(H._field()), _matpoly (H._matpoly), _deg(H._deg),
-			_row(H._row), _col(H._col), _rowblock(H._rowblock), _colblock(H._colblock), _block(H._block), _shape(H._shape)
-			// dummy defaults
-			,_vander(BlasMatrix<Field>(*_field))
-			,_partial_vander(BlasMatrix<Field>(*_field))
-			,_inv_vander(BlasMatrix<Field>(*_field))
-			,_partial_inv_vander(BlasMatrix<Field>(*_field))
-			,_y(BlasMatrix<Field>(*_field))
-			,_x(BlasMatrix<Field>(*_field))
-			,_numpoints(0)
-		{}
-
-		// get the column dimension
-		size_t coldim() const {return _col;}
-
-		// get the row dimension
-		size_t rowdim() const {return _row;}
+		// the matrix polynomial is evaluated at 0,1,..,_numpoints-1 entrywise
+		// with the subproduct tree, as in BlockHankelEvaluation
+		void initSubproductTree(const std::vector<BlasMatrix<Field> > &H)
+		{
+			std::vector<Element> points(_numpoints);
+			for (size_t i=0;i<_numpoints;++i)
+				field().init(points[i],(uint64_t)i);
+			_tree = std::make_shared<SubproductTree<Field> >(field(), points);
+
+			_matpoly.resize(_numpoints, BlasMatrix<Field>(field(), _block, _block));
+			std::vector<Element> P(_deg), vals;
+			for (size_t i=0;i<_block;++i)
+				for (size_t j=0;j<_block;++j){
+					// P is done as a mirror
+					for (size_t k=0;k<_deg;++k)
+						field().assign(P[k], H[_deg-1-k].getEntry(i,j));
+					_tree->evaluate(vals, P);
+					for (size_t k=0;k<_numpoints;++k)
+						_matpoly[k].setEntry(i,j, vals[k]);
+				}
 
-		const Field& field() const { return *_field;}
+			_vecpoly.resize(_numpoints, std::vector<Element>(_block));
+			_resvecpoly.resize(_numpoints, std::vector<Element>(_block));
+		}
 
-		// get the block dimension
-		size_t blockdim() const {return _block;}
+		// the matrix polynomial is stored as its DFT: one matrix per root of unity
+		void initDFT(const std::vector<BlasMatrix<Field> > &H)
+		{
+			_dft = std::make_shared<DFTEvaluation<Field> >(field(), _numpoints);
+			size_t pts = _dft->size();
+
+			_matpoly.resize(pts, BlasMatrix<Field>(field(), _block, _block));
+			std::vector<Element> P(pts);
+			for (size_t i=0;i<_block;++i)
+				for (size_t j=0;j<_block;++j){
+					// P is done as a mirror
+					for (size_t k=0;k<_deg;++k)
+						field().assign(P[k], H[_deg-1-k].getEntry(i,j));
+					for (size_t k=_deg;k<pts;++k)
+						field().assign(P[k], field().zero);
+					_dft->direct(&P[0]);
+					for (size_t k=0;k<pts;++k)
+						_matpoly[k].setEntry(i,j, P[k]);
+				}
 
+			_vecpoly.resize(pts, std::vector<Element>(_block));
+			_resvecpoly.resize(pts, std::vector<Element>(_block));
+			_dftvec = BlasMatrix<Field> (field(), _block, pts);
+		}
 
-		// apply the blackbox to a vector
 		template<class Vector1, class Vector2>
-		Vector1& apply(Vector1 &x, const Vector2 &y) const
+		Vector1& applyVandermonde(Vector1 &x, const Vector2 &y) const
 		{
-			linbox_check(this->_coldim == y.size());
-			linbox_check(this->_rowdim == x.size());
-			BlasMatrixDomain<Field> BMD(field());
 #ifdef BHANKEL_TIMER
 			_chrono.clear();
 			_chrono.start();
@@ -371,10 +506,8 @@ namespace LinBox
 			_chrono.clear();
 			_chrono.start();
 #endif
-			std::vector<std::vector<Element> > x_vecpoly(_vecpoly.size(), std::vector<Element>(_block));
 			// perform the apply componentwise
-			for (size_t i=0;i<_vecpoly.size();++i)
-				BMD.mul(x_vecpoly[i], _matpoly[i], _vecpoly[i]);
+			pointwiseApply();
 
 #ifdef BHANKEL_TIMER
 			_chrono.stop();
@@ -383,17 +516,12 @@ namespace LinBox
 			_chrono.start();
 #endif
 #if 0
-			// get the result according to the right part of the polynomial
-			size_t shift=_colblock-1;
-			if ( _shape == BlockHankelTag::up)
-				shift=0;
-
 			// interpolation to get the result vector
-			BHVectorInterpolation(field(), x, x_vecpoly, _veclagrange, shift);
+			BHVectorInterpolation(field(), x, _resvecpoly, _veclagrange, _shift);
 #endif
 			for (size_t i=0;i<_numpoints;++i)
 				for (size_t j=0;j<_block;++j)
-					_x.setEntry(i,j, x_vecpoly[i][j]);
+					_x.setEntry(i,j, _resvecpoly[i][j]);
 
 			_BMD.mul(_y, _partial_inv_vander, _x);
 
@@ -409,20 +537,101 @@ namespace LinBox
 			return x;
 		}
 
+		template<class Vector1, class Vector2>
+		Vector1& applySubproductTree(Vector1 &x, const Vector2 &y) const
+		{
+#ifdef BHANKEL_TIMER
+			_chrono.clear();
+			_chrono.start();
+#endif
+			std::vector<Element> P(_colblock), vals;
+			for (size_t j=0;j<_block;++j){
+				for (size_t i=0;i<_colblock;++i)
+					field().assign(P[i], y[i*_block+j]);
+				_tree->evaluate(vals, P);
+				for (size_t i=0;i<_numpoints;++i)
+					field().assign(_vecpoly[i][j], vals[i]);
+			}
+#ifdef BHANKEL_TIMER
+			_chrono.stop();
+			_Teval+=_chrono;
+			_chrono.clear();
+			_chrono.start();
+#endif
+			pointwiseApply();
+#ifdef BHANKEL_TIMER
+			_chrono.stop();
+			_Tapply+=_chrono;
+			_chrono.clear();
+			_chrono.start();
+#endif
+			vals.resize(_numpoints);
+			for (size_t j=0;j<_block;++j){
+				for (size_t i=0;i<_numpoints;++i)
+					field().assign(vals[i], _resvecpoly[i][j]);
+				_tree->interpolate(P, vals);
+				for (size_t i=0;i<_colblock;++i)
+					field().assign( x[x.size() - (i+1)*_block +j], P[_shift+i]);
+			}
+#ifdef BHANKEL_TIMER
+			_chrono.stop();
+			_Tinterp +=_chrono;
+#endif
+			return x;
+		}
 
-		~BlockHankel() {}
-
-		// apply the transposed of the blackbox to a vector
 		template<class Vector1, class Vector2>
-		Vector1& applyTranspose(Vector1 &x, const Vector2 &y) const
+		Vector1& applyDFT(Vector1 &x, const Vector2 &y) const
 		{
-			return apply(x,y);
+#ifdef BHANKEL_TIMER
+			_chrono.clear();
+			_chrono.start();
+#endif
+			size_t pts = _dft->size();
+			for (size_t j=0;j<_block;++j){
+				Element *row = &_dftvec.refEntry(j,0);
+				for (size_t i=0;i<_colblock;++i)
+					field().assign(row[i], y[i*_block+j]);
+				for (size_t i=_colblock;i<pts;++i)
+					field().assign(row[i], field().zero);
+				_dft->direct(row);
+				for (size_t i=0;i<pts;++i)
+					field().assign(_vecpoly[i][j], row[i]);
+			}
+#ifdef BHANKEL_TIMER
+			_chrono.stop();
+			_Teval+=_chrono;
+			_chrono.clear();
+			_chrono.start();
+#endif
+			pointwiseApply();
+#ifdef BHANKEL_TIMER
+			_chrono.stop();
+			_Tapply+=_chrono;
+			_chrono.clear();
+			_chrono.start();
+#endif
+			// the product has degree < _numpoints <= pts: no wrap around
+			for (size_t j=0;j<_block;++j){
+				Element *row = &_dftvec.refEntry(j,0);
+				for (size_t i=0;i<pts;++i)
+					field().assign(row[i], _resvecpoly[i][j]);
+				_dft->inverse(row);
+				for (size_t i=0;i<_colblock;++i)
+					field().mul( x[x.size() - (i+1)*_block +j], row[_shift+i], _dft->scaling());
+			}
+#ifdef BHANKEL_TIMER
+			_chrono.stop();
+			_Tinterp +=_chrono;
+#endif
+			return x;
 		}
 
 	private:
 		const Field  *_field;
 		std::vector<BlasMatrix<Field> >                _matpoly;
 		mutable std::vector<std::vector<Element> >       _vecpoly;
+		mutable std::vector<std::vector<Element> >    _resvecpoly;
 		std::vector<std::vector<Element> >           _veclagrange;
 		BlasMatrix<Field>                               _vander;
 		BlasMatrix<Field>                       _partial_vander;
@@ -430,6 +639,9 @@ namespace LinBox
 		BlasMatrix<Field>                   _partial_inv_vander;
 		mutable BlasMatrix<Field>                            _y;
 		mutable BlasMatrix<Field>                            _x;
+		std::shared_ptr<SubproductTree<Field> >           _tree;
+		std::shared_ptr<DFTEvaluation<Field> >            _dft;
+		mutable BlasMatrix<Field>                       _dftvec;
 		BlasMatrixDomain<Field>                              _BMD;
 		size_t _deg;
 		size_t _row;
@@ -438,7 +650,9 @@ namespace LinBox
 		size_t _colblock;
 		size_t _block;
 		size_t _numpoints;
+		size_t _shift;
 		BlockHankelTag::shape _shape;
+		BlockHankelTag::evaluation _evaluation;
 		mutable Timer _Tapply, _Teval, _Tinterp, _chrono;
 	};
 
@@ -45,8 +45,10 @@ namespace LinBox
 
 		BlockToeplitz(){}
 
-		BlockToeplitz (const Field &F, const std::vector<BlasMatrix<Element> > &P, BlockHankelTag::shape s=BloackHankelTag::plain) :
-			BlockHankel(F, P, s) {}
+		BlockToeplitz (const Field &F, const std::vector<BlasMatrix<Field> > &P,
+			       BlockHankelTag::shape s=BlockHankelTag::plain,
+			       BlockHankelTag::evaluation e=BlockHankelTag::automatic) :
+			BlockHankel<Field>(F, P, s, e) {}
 
 
 
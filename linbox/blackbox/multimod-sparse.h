@@ -0,0 +1,239 @@
+/* linbox/blackbox/multimod-sparse.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file blackbox/multimod-sparse.h
+ * @ingroup blackbox
+ * @brief Sparse integer matrices reduced modulo K primes at once
+ */
+
+#ifndef __LINBOX_blackbox_multimod_sparse_H
+#define __LINBOX_blackbox_multimod_sparse_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "linbox/integer.h"
+#include "linbox/util/debug.h"
+#include "linbox/field/multimod-lanes.h"
+
+namespace LinBox
+{
+
+	/** \brief CSR matrix whose entries are elements of @ref MultiModLanes
+	 *
+	 * The structure is stored once and each nonzero carries its K
+	 * residues contiguously, so that one product \f$Ax\f$ computes the
+	 * images of an integer matrix modulo K primes for the cost of one pass
+	 * over the indices. Each row is accumulated in 64-bit lanes and
+	 * reduced once per @ref MultiModLanes::delay() terms.
+	 */
+	template <size_t K>
+	class MultiModCSR {
+	public:
+
+		typedef MultiModLanes<K>                 Field;
+		typedef typename Field::Element          Element;
+		typedef typename Field::Accumulator      Accumulator;
+		typedef std::vector<Element>             Vector;
+
+		/// Reduction of a sparse matrix over the integers, or over any
+		/// ring whose elements convert to integers
+		template <class SparseMatrix>
+		MultiModCSR (const Field &L, const SparseMatrix &A) :
+			_field (&L), _rowdim (A.rowdim ()), _coldim (A.coldim ()), _start (A.rowdim () + 1, 0)
+		{
+			for (auto it = A.IndexedBegin (); it != A.IndexedEnd (); ++it)
+				++_start[it.rowIndex () + 1];
+			for (size_t i = 0; i < _rowdim; ++i)
+				_start[i + 1] += _start[i];
+
+			_col.resize (_start[_rowdim]);
+			_coef.resize (_start[_rowdim]);
+
+			std::vector<size_t> next (_start.begin (), _start.end () - 1);
+			integer v;
+			for (auto it = A.IndexedBegin (); it != A.IndexedEnd (); ++it) {
+				const size_t k = next[it.rowIndex ()]++;
+				_col[k] = uint32_t (it.colIndex ());
+				L.init (_coef[k], A.field ().convert (v, it.value ()));
+			}
+		}
+
+		const Field &field () const { return *_field; }
+		size_t rowdim () const { return _rowdim; }
+		size_t coldim () const { return _coldim; }
+		size_t size () const { return _col.size (); }
+
+		/// y <- A x, modulo each prime
+		Vector &apply (Vector &y, const Vector &x) const
+		{
+			linbox_check (x.size () == _coldim && y.size () == _rowdim);
+			const size_t delay = _field->delay ();
+			Accumulator acc;
+
+			for (size_t i = 0; i < _rowdim; ++i) {
+				_field->clear (acc);
+				size_t n = 0;
+				for (size_t k = _start[i]; k < _start[i + 1]; ++k) {
+					if (++n > delay) {
+						_field->fold (acc);
+						n = 1;
+					}
+					_field->mulacc (acc, _coef[k], x[_col[k]]);
+				}
+				_field->reduce (y[i], acc);
+			}
+			return y;
+		}
+
+		/// y <- A^T x, modulo each prime
+		Vector &applyTranspose (Vector &y, const Vector &x) const
+		{
+			linbox_check (x.size () == _rowdim && y.size () == _coldim);
+			for (size_t j = 0; j < _coldim; ++j)
+				_field->init (y[j]);
+
+			for (size_t i = 0; i < _rowdim; ++i)
+				for (size_t k = _start[i]; k < _start[i + 1]; ++k)
+					_field->axpyin (y[_col[k]], _coef[k], x[i]);
+			return y;
+		}
+
+	protected:
+
+		const Field             *_field;
+		size_t                   _rowdim;
+		size_t                   _coldim;
+		std::vector<size_t>      _start;
+		std::vector<uint32_t>    _col;
+		std::vector<Element>     _coef;
+	};
+
+	/** \brief ELLPACK matrix whose entries are elements of @ref MultiModLanes
+	 *
+	 * Every row is padded to the length of the longest one with zero
+	 * coefficients pointing at column 0, so that the inner loop of
+	 * @ref apply has a fixed trip count. This suits matrices with
+	 * rows of nearly constant weight; on matrices with a few dense rows
+	 * the padding makes @ref MultiModCSR the better choice.
+	 */
+	template <size_t K>
+	class MultiModELL {
+	public:
+
+		typedef MultiModLanes<K>                 Field;
+		typedef typename Field::Element          Element;
+		typedef typename Field::Accumulator      Accumulator;
+		typedef std::vector<Element>             Vector;
+
+		template <class SparseMatrix>
+		MultiModELL (const Field &L, const SparseMatrix &A) :
+			_field (&L), _rowdim (A.rowdim ()), _coldim (A.coldim ()), _width (0)
+		{
+			std::vector<size_t> len (_rowdim, 0);
+			for (auto it = A.IndexedBegin (); it != A.IndexedEnd (); ++it)
+				++len[it.rowIndex ()];
+			for (size_t i = 0; i < _rowdim; ++i)
+				_width = std::max (_width, len[i]);
+
+			Element z;
+			L.init (z);
+			_col.assign (_rowdim * _width, 0);
+			_coef.assign (_rowdim * _width, z);
+
+			std::fill (len.begin (), len.end (), 0);
+			integer v;
+			for (auto it = A.IndexedBegin (); it != A.IndexedEnd (); ++it) {
+				const size_t i = it.rowIndex ();
+				const size_t k = i * _width + len[i]++;
+				_col[k] = uint32_t (it.colIndex ());
+				L.init (_coef[k], A.field ().convert (v, it.value ()));
+			}
+		}
+
+		const Field &field () const { return *_field; }
+		size_t rowdim () const { return _rowdim; }
+		size_t coldim () const { return _coldim; }
+		/// Number of stored entries per row, padding included
+		size_t width () const { return _width; }
+
+		/// y <- A x, modulo each prime
+		Vector &apply (Vector &y, const Vector &x) const
+		{
+			linbox_check (x.size () == _coldim && y.size () == _rowdim);
+			const size_t delay = _field->delay ();
+			Accumulator acc;
+
+			for (size_t i = 0; i < _rowdim; ++i) {
+				const uint32_t *col = _col.data () + i * _width;
+				const Element *coef = _coef.data () + i * _width;
+				_field->clear (acc);
+				for (size_t b = 0; b < _width; b += delay) {
+					const size_t e = std::min (_width, b + delay);
+					if (b > 0)
+						_field->fold (acc);
+					for (size_t k = b; k < e; ++k)
+						_field->mulacc (acc, coef[k], x[col[k]]);
+				}
+				_field->reduce (y[i], acc);
+			}
+			return y;
+		}
+
+		/// y <- A^T x, modulo each prime
+		Vector &applyTranspose (Vector &y, const Vector &x) const
+		{
+			linbox_check (x.size () == _rowdim && y.size () == _coldim);
+			for (size_t j = 0; j < _coldim; ++j)
+				_field->init (y[j]);
+
+			for (size_t i = 0; i < _rowdim; ++i)
+				for (size_t k = i * _width; k < (i + 1) * _width; ++k)
+					_field->axpyin (y[_col[k]], _coef[k], x[i]);
+			return y;
+		}
+
+	protected:
+
+		const Field             *_field;
+		size_t                   _rowdim;
+		size_t                   _coldim;
+		size_t                   _width;
+		std::vector<uint32_t>    _col;
+		std::vector<Element>     _coef;
+	};
+
+} // LinBox
+
+#endif // __LINBOX_blackbox_multimod_sparse_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
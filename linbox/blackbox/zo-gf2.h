@@ -35,6 +35,8 @@
 #include "linbox/vector/stream.h"
 #include "linbox/matrix/sparse-matrix.h"
 #include "linbox/vector/light_container.h"
+#include "linbox/matrix/bit-block.h"
+#include "linbox/vector/bit-vector.h"
 
 namespace LinBox
 {
@@ -112,6 +114,26 @@ namespace LinBox
 		template<class OutVector, class InVector>
 		OutVector& applyTranspose(OutVector& y, const InVector& x) const; // y = A^T x
 
+		/** Apply on bit vectors, y = A x.
+		 *  The row parities are read from x by word gathers and y is
+		 *  written a whole word, 64 rows, at a time.
+		 */
+		BitVector& apply(BitVector& y, const BitVector& x) const;
+
+		/// Apply on bit vectors, y = A^T x, by word flips
+		BitVector& applyTranspose(BitVector& y, const BitVector& x) const;
+
+		/** Block apply on word-packed blocks, Y = A X.
+		 *  Each nonzero of A adds one row of X into Y, that is 64W
+		 *  vectors at once.
+		 */
+		template<size_t W>
+		BitBlock<W>& applyLeft(BitBlock<W>& Y, const BitBlock<W>& X) const;
+
+		/// Block apply on word-packed blocks, Y = A^T X
+		template<size_t W>
+		BitBlock<W>& applyTransposeLeft(BitBlock<W>& Y, const BitBlock<W>& X) const;
+
 		/** Read the matrix from a stream in ANY format
 		 *  entries are read as "long int" and set to 1 if they are odd,
 		 *  0 otherwise
@@ -92,6 +92,73 @@ namespace LinBox
 		return y;
 	}
 
+	inline BitVector & ZeroOne<GF2>::apply(BitVector & y, const BitVector & x) const
+	{
+		linbox_check(y.size() == rowdim() && x.size() == coldim());
+		const unsigned long * xw = BitWords::data(x);
+		unsigned long * yw = BitWords::data(y);
+		Self_t::const_iterator row = this->begin();
+		for(size_t w = 0; row != this->end(); ++w) {
+			unsigned long word = 0UL;
+			for(size_t b = 0; b < __LINBOX_BITSOF_LONG && row != this->end(); ++b, ++row) {
+				// the parity of the row accumulates in the low bit
+				unsigned long t = 0UL;
+				for(Row_t::const_iterator loc = row->begin(); loc != row->end(); ++loc)
+					t ^= xw[*loc >> __LINBOX_LOGOF_SIZE] >> (*loc & __LINBOX_POS_ALL_ONES);
+				word |= (t & 1UL) << b;
+			}
+			yw[w] = word;
+		}
+		return y;
+	}
+
+	inline BitVector & ZeroOne<GF2>::applyTranspose(BitVector & y, const BitVector & x) const
+	{
+		linbox_check(y.size() == coldim() && x.size() == rowdim());
+		std::fill(y.wordBegin(), y.wordEnd(), 0UL);
+		const unsigned long * xw = BitWords::data(x);
+		unsigned long * yw = BitWords::data(y);
+		Self_t::const_iterator row = this->begin();
+		for(size_t i = 0; row != this->end(); ++row, ++i) {
+			if (!BitWords::bit(xw, i))
+				continue;
+			for(Row_t::const_iterator loc = row->begin(); loc != row->end(); ++loc)
+				BitWords::flip(yw, *loc);
+		}
+		return y;
+	}
+
+	template<size_t W>
+	inline BitBlock<W> & ZeroOne<GF2>::applyLeft(BitBlock<W> & Y, const BitBlock<W> & X) const
+	{
+		typename BitBlock<W>::Row * y = Y.rows();
+		const typename BitBlock<W>::Row * x = X.rows();
+		Self_t::const_iterator row = this->begin();
+		for( ; row != this->end(); ++row, ++y) {
+			typename BitBlock<W>::Row tmp = BitBlock<W>::zeroRow();
+			for(Row_t::const_iterator loc = row->begin(); loc != row->end(); ++loc)
+				BitBlock<W>::addin(tmp, x[*loc]);
+			*y = tmp;
+		}
+		return Y;
+	}
+
+	template<size_t W>
+	inline BitBlock<W> & ZeroOne<GF2>::applyTransposeLeft(BitBlock<W> & Y, const BitBlock<W> & X) const
+	{
+		Y.clear();
+		typename BitBlock<W>::Row * y = Y.rows();
+		const typename BitBlock<W>::Row * x = X.rows();
+		Self_t::const_iterator row = this->begin();
+		for( ; row != this->end(); ++row, ++x) {
+			if (BitBlock<W>::isZero(*x))
+				continue;
+			for(Row_t::const_iterator loc = row->begin(); loc != row->end(); ++loc)
+				BitBlock<W>::addin(y[*loc], *x);
+		}
+		return Y;
+	}
+
 
 	inline const ZeroOne<GF2>::Element& ZeroOne<GF2>::setEntry(size_t i, size_t j, const Element& v) {
 		Row_t& rowi = this->operator[](i);
@@ -0,0 +1,305 @@
+/* linbox/field/multimod-lanes.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file field/multimod-lanes.h
+ * @ingroup field
+ * @brief Residues modulo K word-size primes, stored contiguously
+ */
+
+#ifndef __LINBOX_field_multimod_lanes_H
+#define __LINBOX_field_multimod_lanes_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "linbox/integer.h"
+#include "linbox/util/debug.h"
+#include "linbox/util/error.h"
+#include "linbox/randiter/mersenne-twister.h"
+
+namespace LinBox
+{
+
+	/** \brief Arithmetic modulo K primes at once, one lane per prime
+	 *
+	 * Unlike @ref MultiModDouble, which keeps one vector of residues per
+	 * element, an element here is an array of K residues stored
+	 * contiguously, so that a vector of n elements is n*K consecutive
+	 * 32-bit words. A loop over the lanes of an element has a fixed trip
+	 * count and no data-dependent branch, so that the compiler can turn
+	 * it into packed 32x32->64 bit multiplications.
+	 *
+	 * @ref mul and @ref axpyin reduce a product with a floating point
+	 * quotient and a conditional correction (@ref reduceProduct) instead
+	 * of an integer division, which has no packed form.
+	 *
+	 * The primes must be smaller than \f$2^{31}\f$. Sums of products are
+	 * accumulated in 64 bits and reduced every @ref delay() terms: for
+	 * primes of 26 bits this is several thousand terms, so that a sparse
+	 * row or a dot product is usually reduced once. These 64-bit
+	 * accumulators are beyond the floating point quotient and are reduced
+	 * with an integer division.
+	 */
+	template <size_t K>
+	class MultiModLanes {
+	public:
+
+		typedef uint32_t                   Residue;
+		typedef std::array<Residue, K>     Element;
+		typedef std::array<uint64_t, K>    Accumulator;
+
+		static const size_t lanes = K;
+
+		/// The K primes; they are not checked for primality
+		template <class Primes>
+		MultiModLanes (const Primes &primes) :
+			_delay (~size_t (0))
+		{
+			if (primes.size () != K)
+				throw LinBoxError ("MultiModLanes: the number of primes must be the number of lanes");
+			size_t l = 0;
+			for (auto it = primes.begin (); it != primes.end (); ++it, ++l) {
+				const integer p (*it);
+				if (p < 2 || p >= integer (uint64_t (1) << 31))
+					throw LinBoxError ("MultiModLanes: the primes must be smaller than 2^31");
+				_p[l] = Residue (uint64_t (p));
+				_inv[l] = 1.0 / double (_p[l]);
+
+				const uint64_t q = uint64_t (_p[l] - 1) * uint64_t (_p[l] - 1);
+				if (q > 0)
+					_delay = std::min (_delay, size_t ((~uint64_t (0) - _p[l]) / q));
+			}
+		}
+
+		/// Prime of lane l
+		Residue prime (size_t l) const { return _p[l]; }
+
+		/// Number of products of residues that fit in an @ref Accumulator
+		size_t delay () const { return _delay; }
+
+		Element &init (Element &x) const
+		{
+			x.fill (0);
+			return x;
+		}
+
+		/// Residues of an integer
+		Element &init (Element &x, const integer &a) const
+		{
+			for (size_t l = 0; l < K; ++l) {
+				integer r = a % integer (_p[l]);
+				if (r < 0)
+					r += integer (_p[l]);
+				x[l] = Residue (uint64_t (r));
+			}
+			return x;
+		}
+
+		/// Residues of a lane-wise array of integers
+		Element &init (Element &x, const std::array<uint64_t, K> &a) const
+		{
+			for (size_t l = 0; l < K; ++l)
+				x[l] = Residue (a[l] % _p[l]);
+			return x;
+		}
+
+		Element &random (MersenneTwister &MT, Element &x) const
+		{
+			for (size_t l = 0; l < K; ++l)
+				x[l] = MT.randomIntRange (0, _p[l]);
+			return x;
+		}
+
+		bool isZero (const Element &x) const
+		{
+			Residue z = 0;
+			for (size_t l = 0; l < K; ++l)
+				z |= x[l];
+			return z == 0;
+		}
+
+		bool areEqual (const Element &x, const Element &y) const
+		{
+			return x == y;
+		}
+
+		Element &add (Element &x, const Element &y, const Element &z) const
+		{
+			for (size_t l = 0; l < K; ++l) {
+				const Residue s = y[l] + z[l];
+				x[l] = s >= _p[l] ? s - _p[l] : s;
+			}
+			return x;
+		}
+
+		Element &sub (Element &x, const Element &y, const Element &z) const
+		{
+			for (size_t l = 0; l < K; ++l)
+				x[l] = y[l] >= z[l] ? y[l] - z[l] : y[l] + (_p[l] - z[l]);
+			return x;
+		}
+
+		Element &neg (Element &x, const Element &y) const
+		{
+			for (size_t l = 0; l < K; ++l)
+				x[l] = y[l] == 0 ? 0 : _p[l] - y[l];
+			return x;
+		}
+
+		Element &mul (Element &x, const Element &y, const Element &z) const
+		{
+			for (size_t l = 0; l < K; ++l)
+				x[l] = reduceProduct (uint64_t (y[l]) * z[l], l);
+			return x;
+		}
+
+		/// r <- r + a x
+		Element &axpyin (Element &r, const Element &a, const Element &x) const
+		{
+			for (size_t l = 0; l < K; ++l)
+				r[l] = reduceProduct (uint64_t (a[l]) * x[l] + r[l], l);
+			return r;
+		}
+
+		/** t mod p for the prime p of lane l and \f$t < p^2\f$.
+		 * The quotient t/p < p is computed in double precision to within
+		 * one, then the remainder is brought back into [0, p).
+		 */
+		Residue reduceProduct (uint64_t t, size_t l) const
+		{
+			const uint64_t q = uint64_t (int32_t (double (t) * _inv[l]));
+			int64_t r = int64_t (t - q * _p[l]);
+			r += (r < 0) ? int64_t (_p[l]) : 0;
+			r -= (r >= int64_t (_p[l])) ? int64_t (_p[l]) : 0;
+			return Residue (r);
+		}
+
+		/// Lane-wise inverse; a zero lane is left zero
+		Element &inv (Element &x, const Element &y) const
+		{
+			for (size_t l = 0; l < K; ++l)
+				x[l] = invLane (y[l], l);
+			return x;
+		}
+
+		/// Inverse of a residue modulo the prime of lane l, 0 for 0
+		Residue invLane (Residue a, size_t l) const
+		{
+			int64_t r0 = _p[l], r1 = a, u0 = 0, u1 = 1;
+			while (r1 != 0) {
+				const int64_t q = r0 / r1, r = r0 - q * r1, u = u0 - q * u1;
+				r0 = r1; r1 = r;
+				u0 = u1; u1 = u;
+			}
+			if (r0 != 1)
+				return 0;
+			return Residue (u0 < 0 ? u0 + int64_t (_p[l]) : u0);
+		}
+
+		/// @name Delayed reduction
+		//@{
+		void clear (Accumulator &acc) const
+		{
+			acc.fill (0);
+		}
+
+		/// acc <- acc + a x, without reduction
+		void mulacc (Accumulator &acc, const Element &a, const Element &x) const
+		{
+			for (size_t l = 0; l < K; ++l)
+				acc[l] += uint64_t (a[l]) * x[l];
+		}
+
+		/// acc <- acc mod p, lane-wise
+		void fold (Accumulator &acc) const
+		{
+			for (size_t l = 0; l < K; ++l)
+				acc[l] %= _p[l];
+		}
+
+		Element &reduce (Element &x, const Accumulator &acc) const
+		{
+			for (size_t l = 0; l < K; ++l)
+				x[l] = Residue (acc[l] % _p[l]);
+			return x;
+		}
+		//@}
+
+		/// Lane-wise dot product of two vectors of elements
+		Element &dot (Element &d, const std::vector<Element> &x, const std::vector<Element> &y) const
+		{
+			linbox_check (x.size () == y.size ());
+			Accumulator acc;
+			clear (acc);
+			size_t n = 0;
+			for (size_t i = 0; i < x.size (); ++i) {
+				if (++n > _delay) {
+					fold (acc);
+					n = 1;
+				}
+				mulacc (acc, x[i], y[i]);
+			}
+			return reduce (d, acc);
+		}
+
+		std::ostream &write (std::ostream &os) const
+		{
+			os << "MultiModLanes<" << K << "> modulo";
+			for (size_t l = 0; l < K; ++l)
+				os << ' ' << _p[l];
+			return os;
+		}
+
+		std::ostream &write (std::ostream &os, const Element &x) const
+		{
+			os << '[';
+			for (size_t l = 0; l < K; ++l)
+				os << (l ? " " : "") << x[l];
+			return os << ']';
+		}
+
+	protected:
+
+		Element               _p;
+		std::array<double, K> _inv;
+		size_t                _delay;
+	};
+
+	template <size_t K> const size_t MultiModLanes<K>::lanes;
+
+} // LinBox
+
+#endif // __LINBOX_field_multimod_lanes_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
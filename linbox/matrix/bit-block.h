@@ -0,0 +1,334 @@
+/* linbox/matrix/bit-block.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file matrix/bit-block.h
+ * @ingroup matrix
+ * @brief Word-packed blocks of vectors over GF(2)
+ */
+
+#ifndef __LINBOX_matrix_bit_block_H
+#define __LINBOX_matrix_bit_block_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "linbox/randiter/gf2.h"
+#include "linbox/randiter/mersenne-twister.h"
+
+namespace LinBox
+{
+
+	/** \brief An \f$n\times 64W\f$ matrix over GF(2), packed by rows
+	 *
+	 * Row \f$i\f$ is <code>W</code> consecutive 64-bit words and bit
+	 * \f$c\f$ of word \f$w\f$ is column \f$64w+c\f$. Such a block holds
+	 * \f$64W\f$ vectors of length \f$n\f$ side by side, so that adding row
+	 * \f$j\f$ of a block into row \f$i\f$ of another updates all of them at
+	 * once. Rows have a fixed width known at compile time: with
+	 * <code>W</code> = 2 or 4 a row is exactly one SSE2 or AVX2 register and
+	 * the row loops below are vectorised by the compiler.
+	 */
+	template <size_t W>
+	class BitBlock {
+	public:
+		typedef uint64_t               Word;
+		typedef std::array<Word, W>    Row;
+
+		static const size_t words = W;     ///< words per row
+		static const size_t width = 64 * W; ///< number of columns
+
+		BitBlock (size_t n = 0) :
+			_rows (n, zeroRow ())
+		{}
+
+		size_t rowdim () const { return _rows.size (); }
+		size_t coldim () const { return width; }
+
+		void resize (size_t n) { _rows.resize (n, zeroRow ()); }
+		void clear () { std::fill (_rows.begin (), _rows.end (), zeroRow ()); }
+
+		Row &operator[] (size_t i) { return _rows[i]; }
+		const Row &operator[] (size_t i) const { return _rows[i]; }
+
+		Row *rows () { return _rows.data (); }
+		const Row *rows () const { return _rows.data (); }
+
+		bool getEntry (size_t i, size_t j) const
+		{
+			return (_rows[i][j / 64] >> (j % 64)) & 1;
+		}
+
+		void setEntry (size_t i, size_t j, bool a)
+		{
+			const Word bit = Word (1) << (j % 64);
+
+			if (a)
+				_rows[i][j / 64] |= bit;
+			else
+				_rows[i][j / 64] &= ~bit;
+		}
+
+		bool isZero () const
+		{
+			for (size_t i = 0; i < _rows.size (); ++i)
+				if (!isZero (_rows[i]))
+					return false;
+			return true;
+		}
+
+		/// All zero row
+		static Row zeroRow ()
+		{
+			Row r;
+			r.fill (Word (0));
+			return r;
+		}
+
+		/// a <- a + b
+		static void addin (Row &a, const Row &b)
+		{
+			for (size_t w = 0; w < W; ++w)
+				a[w] ^= b[w];
+		}
+
+		static bool isZero (const Row &a)
+		{
+			Word t = 0;
+			for (size_t w = 0; w < W; ++w)
+				t |= a[w];
+			return t == 0;
+		}
+
+		/// Index of the lowest nonzero bit of a nonzero row
+		static size_t lowestBit (const Row &a)
+		{
+			size_t w = 0;
+			while (a[w] == 0)
+				++w;
+
+			Word x = a[w];
+			size_t c = 0;
+			while (!(x & 1)) {
+				x >>= 1;
+				++c;
+			}
+			return 64 * w + c;
+		}
+
+	protected:
+
+		std::vector<Row> _rows;
+	};
+
+	template <size_t W> const size_t BitBlock<W>::words;
+	template <size_t W> const size_t BitBlock<W>::width;
+
+	/** \brief Kernels on @ref BitBlock
+	 *
+	 * Products with a small \f$64W\times 64W\f$ matrix and transposed
+	 * products \f$U^TX\f$ use one table of \f$2^8\f$ rows per byte of a
+	 * row, so that the work per row of the tall operand is \f$8W\f$ table
+	 * lookups instead of \f$64W\f$ conditional additions.
+	 */
+	template <size_t W>
+	class BitBlockDomain {
+	public:
+		typedef BitBlock<W>             Block;
+		typedef typename Block::Word    Word;
+		typedef typename Block::Row     Row;
+
+		/// Byte tables of a small matrix M: T[8k+b] (b = 0..255) is the sum
+		/// of the rows 8k+i of M such that bit i of b is set
+		static void tables (std::vector<Row> &T, const Block &M)
+		{
+			T.resize (8 * W * 256);
+
+			for (size_t k = 0; k < 8 * W; ++k) {
+				Row *t = &T[256 * k];
+
+				t[0] = Block::zeroRow ();
+				for (size_t i = 0; i < 8; ++i) {
+					const size_t h = size_t (1) << i;
+					const Row &r = M[8 * k + i];
+
+					for (size_t b = 0; b < h; ++b) {
+						t[h + b] = t[b];
+						Block::addin (t[h + b], r);
+					}
+				}
+			}
+		}
+
+		/// C <- A M (or C <- C + A M if \p accumulate) on \p n rows, using
+		/// the tables of M. C may be A.
+		static void mul (Row *C, const Row *A, size_t n, const std::vector<Row> &T, bool accumulate = false)
+		{
+			for (size_t i = 0; i < n; ++i) {
+				Row r = accumulate ? C[i] : Block::zeroRow ();
+				const Row a = A[i];
+
+				for (size_t w = 0; w < W; ++w) {
+					Word x = a[w];
+
+					for (size_t k = 8 * w; x != 0; ++k, x >>= 8)
+						Block::addin (r, T[256 * k + (x & 0xff)]);
+				}
+
+				C[i] = r;
+			}
+		}
+
+		/// C <- A M, with M a \f$64W\times 64W\f$ matrix
+		static Block &mul (Block &C, const Block &A, const Block &M)
+		{
+			std::vector<Row> T;
+			tables (T, M);
+			C.resize (A.rowdim ());
+			mul (C.rows (), A.rows (), A.rowdim (), T);
+			return C;
+		}
+
+		/// C <- C + A M, with M a \f$64W\times 64W\f$ matrix
+		static Block &axpyin (Block &C, const Block &A, const Block &M)
+		{
+			std::vector<Row> T;
+			tables (T, M);
+			mul (C.rows (), A.rows (), A.rowdim (), T, true);
+			return C;
+		}
+
+		/// C <- U^T X, a \f$64W\times 64W\f$ matrix
+		static Block &mulTranspose (Block &C, const Block &U, const Block &X)
+		{
+			std::vector<Row> T (8 * W * 256, Block::zeroRow ());
+
+			// Bucket the rows of X by the bytes of the matching row of U
+			for (size_t i = 0; i < U.rowdim (); ++i) {
+				const Row &u = U[i];
+
+				for (size_t w = 0; w < W; ++w) {
+					Word x = u[w];
+
+					for (size_t k = 8 * w; x != 0; ++k, x >>= 8)
+						if (x & 0xff)
+							Block::addin (T[256 * k + (x & 0xff)], X[i]);
+				}
+			}
+
+			// Row 8k+i of C is the sum of the buckets whose byte has bit i
+			C.resize (Block::width);
+			for (size_t k = 0; k < 8 * W; ++k)
+				for (size_t i = 0; i < 8; ++i) {
+					Row r = Block::zeroRow ();
+
+					for (size_t b = size_t (1) << i; b < 256; b = (b + 1) | (size_t (1) << i))
+						Block::addin (r, T[256 * k + b]);
+
+					C[8 * k + i] = r;
+				}
+
+			return C;
+		}
+
+		static Block &random (Block &A, MersenneTwister &MT)
+		{
+			for (size_t i = 0; i < A.rowdim (); ++i)
+				for (size_t w = 0; w < W; ++w)
+					A[i][w] = MTrandomInt<64>() (MT);
+			return A;
+		}
+
+		/** Column elimination on R, mirrored on Z.
+		 *
+		 * Adds active columns of R to one another until the active
+		 * columns that are not pivots are zero; the same column
+		 * operations are applied to Z when it is not null. Kept columns
+		 * are never added to another column; a kept column that cannot be
+		 * cleared is made inactive.
+		 *
+		 * @param R matrix whose columns are eliminated
+		 * @param Z matrix receiving the same column operations, or NULL
+		 * @param active in: columns to consider; out: columns of R that are zero
+		 * @param pivots out: columns used as pivots
+		 * @param keep columns that must not be used as pivots
+		 */
+		static void eliminateColumns (Block &R, Block *Z, Row &active, Row &pivots, const Row &keep)
+		{
+			pivots = Block::zeroRow ();
+
+			// Columns that are still active are zero on the rows already
+			// seen, so the column operations never touch those rows again
+			for (size_t i = 0; i < R.rowdim () && !Block::isZero (active); ++i) {
+				Row r, c;
+				for (size_t w = 0; w < W; ++w) {
+					r[w] = R[i][w] & active[w];
+					c[w] = r[w] & ~keep[w];
+				}
+
+				if (Block::isZero (r))
+					continue;
+
+				if (Block::isZero (c)) {
+					// Only kept columns are left: they cannot be cleared
+					for (size_t w = 0; w < W; ++w)
+						active[w] &= ~r[w];
+					continue;
+				}
+
+				const size_t j = Block::lowestBit (c);
+				const size_t h = j / 64;
+				const Word p = Word (1) << (j % 64);
+
+				// Add column j to every other column present in row i
+				r[h] &= ~p;
+
+				for (size_t k = i; k < R.rowdim (); ++k)
+					if (R[k][h] & p)
+						Block::addin (R[k], r);
+
+				if (Z != NULL)
+					for (size_t k = 0; k < Z->rowdim (); ++k)
+						if ((*Z)[k][h] & p)
+							Block::addin ((*Z)[k], r);
+
+				active[h] &= ~p;
+				pivots[h] |= p;
+			}
+		}
+	};
+
+} // namespace LinBox
+
+#endif // __LINBOX_matrix_bit_block_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -113,6 +113,30 @@ namespace LinBox { /*  MatrixContainerTrait */
 		typedef MatrixContainerCategory::BlasContainer Type;
 	};
 
+	template <class Field, class Rep>
+	class MatrixContainerTrait<TransposedBlasMatrix<BlasMatrix<Field,Rep> > > {
+	public:
+		typedef MatrixContainerCategory::TransposedBlasContainer Type;
+	};
+
+	template <class Field, class Rep>
+	class MatrixContainerTrait<TransposedBlasMatrix<const BlasMatrix<Field,Rep> > > {
+	public:
+		typedef MatrixContainerCategory::TransposedBlasContainer Type;
+	};
+
+	template <class _Matrix>
+	class MatrixContainerTrait<TransposedBlasMatrix<BlasSubmatrix<_Matrix> > > {
+	public:
+		typedef MatrixContainerCategory::TransposedBlasContainer Type;
+	};
+
+	template <class _Matrix>
+	class MatrixContainerTrait<TransposedBlasMatrix<const BlasSubmatrix<_Matrix> > > {
+	public:
+		typedef MatrixContainerCategory::TransposedBlasContainer Type;
+	};
+
 } // LinBox
 
 namespace LinBox { /*  MatrixTraits */
@@ -101,6 +101,8 @@ namespace LinBox
         template <class Matrix>
         void createBlasMatrix (const Matrix& A,const size_t i0,const size_t j0,const size_t m, const size_t n, MatrixContainerCategory::BlasContainer);
         template <class Matrix>
+        void createBlasMatrix (const Matrix& A,const size_t i0,const size_t j0,const size_t m, const size_t n, MatrixContainerCategory::TransposedBlasContainer);
+        template <class Matrix>
         void createBlasMatrix (const Matrix& A,const size_t i0,const size_t j0,const size_t m, const size_t n, MatrixContainerCategory::Blackbox);
 
 
@@ -444,6 +446,18 @@ namespace LinBox
             constSubMatrixType A(*this,0,0,rowdim(),coldim()); return A.applyTranspose(y,x);
         }
 
+        /** Copy of the transpose of the matrix, by cache-oblivious blocks (see transposeBlas).
+         * @param AT a dense matrix of dimensions coldim() x rowdim()
+         */
+        template <class Matrix>
+        Matrix& transpose (Matrix& AT) const
+        {
+            constSubMatrixType A(*this,0,0,rowdim(),coldim()); return A.transpose(AT);
+        }
+
+        /// In place transpose; the dimensions are swapped
+        Self_t& transpose () ;
+
         subMatrixType& applyRight(subMatrixType& Y, const subMatrixType& X)
         {
             subMatrixType A(*this); return A.applyRight(Y,X);
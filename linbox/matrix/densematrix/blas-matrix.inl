@@ -95,6 +95,18 @@ namespace LinBox
         FFLAS::fassign(field(), m, n, A.getPointer(), A.getStride(), getPointer(), getStride());
 	}
 
+    // A is a view on the transpose of a BLAS matrix M: rows i0.. of A are columns i0.. of M
+    template<class _Field, class _Storage>
+	template <class _Matrix>
+	void BlasMatrix< _Field, _Storage >::createBlasMatrix (const _Matrix& A,
+                                                           const size_t i0,const size_t j0,
+                                                           const size_t m, const size_t n,
+                                                           MatrixContainerCategory::TransposedBlasContainer)
+	{
+        linbox_check( areFieldEqual(A.field(),field() ) );
+        transposeBlas(field(), n, m, A.getPointer()+j0*A.getStride()+i0, A.getStride(), getPointer(), getStride());
+	}
+
 	template<class _Field, class _Storage>
 	template <class Matrix>
 	void BlasMatrix< _Field, _Storage >::createBlasMatrix (const Matrix& A,
@@ -154,6 +166,21 @@ namespace LinBox
 
 
 
+    template < class _Field, class _Storage >
+	BlasMatrix< _Field, _Storage >& BlasMatrix< _Field, _Storage >::transpose ()
+	{
+        if (_row == _col)
+            transposeBlasInPlace(field(), _row, getPointer(), getStride());
+        else {
+            Storage T(field(), _row*_col);
+            transposeBlas(field(), _row, _col, getPointer(), getStride(), T.getPointer(), _row);
+            _rep = T;
+            std::swap(_row, _col);
+        }
+        return *this;
+	}
+
+
     //////////////////
     // CONSTRUCTORS //
     //////////////////
@@ -36,6 +36,7 @@
 #include "fflas-ffpack/fflas-ffpack.h"
 #include "linbox/field/rebind.h"
 #include "linbox/matrix/densematrix/blas-matrix-iterator.h"
+#include "linbox/matrix/densematrix/blas-transpose.h"
 
 namespace LinBox
 {
@@ -312,6 +313,17 @@ namespace LinBox
             return y;
         }
 
+        /** Copy of the transpose of the submatrix, by cache-oblivious blocks (see transposeBlas).
+         * @param AT a dense matrix of dimensions coldim() x rowdim(), not overlapping this one
+         */
+        template <class Matrix>
+        Matrix& transpose (Matrix& AT) const
+        {
+            linbox_check( AT.rowdim() == _col && AT.coldim() == _row );
+            transposeBlas(_field, _row, _col, _ptr, _stride, AT.getPointer(), AT.getStride());
+            return AT;
+        }
+
 
 
         void zero() {
@@ -0,0 +1,203 @@
+/* linbox/matrix/densematrix/blas-transpose.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file matrix/densematrix/blas-transpose.h
+ * @ingroup densematrix
+ * @brief Cache-oblivious transpose of row-major dense matrices
+ */
+
+#ifndef __LINBOX_matrix_densematrix_blas_transpose_H
+#define __LINBOX_matrix_densematrix_blas_transpose_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include <fflas-ffpack/paladin/parallel.h>
+
+//! Side of the square tiles transposed element by element
+#ifndef LINBOX_TRANSPOSE_BLOCK
+#define LINBOX_TRANSPOSE_BLOCK 32
+#endif
+
+//! Number of entries under which a transpose is not split into tasks
+#ifndef LINBOX_TRANSPOSE_PARALLEL_THRESHOLD
+#define LINBOX_TRANSPOSE_PARALLEL_THRESHOLD (size_t(1) << 16)
+#endif
+
+namespace LinBox
+{
+	namespace Protected
+	{
+
+		/// B <- A^T, A of size m x n, halving the largest dimension
+		template <class Field, class ConstPtr, class Ptr>
+		void transposeRec (const Field &F, size_t m, size_t n,
+				   ConstPtr A, size_t lda, Ptr B, size_t ldb)
+		{
+			while (m > LINBOX_TRANSPOSE_BLOCK || n > LINBOX_TRANSPOSE_BLOCK) {
+				if (m >= n) {
+					const size_t m1 = m / 2;
+					transposeRec (F, m1, n, A, lda, B, ldb);
+					A += m1 * lda; B += m1; m -= m1;
+				}
+				else {
+					const size_t n1 = n / 2;
+					transposeRec (F, m, n1, A, lda, B, ldb);
+					A += n1; B += n1 * ldb; n -= n1;
+				}
+			}
+			// writes are contiguous, reads stay within one tile
+			for (size_t j = 0; j < n; ++j)
+				for (size_t i = 0; i < m; ++i)
+					F.assign (B[j * ldb + i], A[i * lda + j]);
+		}
+
+		/// Swaps X and Y^T, X of size m x n and Y of size n x m
+		template <class Ptr>
+		void swapTransposeRec (size_t m, size_t n, Ptr X, size_t ldx, Ptr Y, size_t ldy)
+		{
+			while (m > LINBOX_TRANSPOSE_BLOCK || n > LINBOX_TRANSPOSE_BLOCK) {
+				if (m >= n) {
+					const size_t m1 = m / 2;
+					swapTransposeRec (m1, n, X, ldx, Y, ldy);
+					X += m1 * ldx; Y += m1; m -= m1;
+				}
+				else {
+					const size_t n1 = n / 2;
+					swapTransposeRec (m, n1, X, ldx, Y, ldy);
+					X += n1; Y += n1 * ldy; n -= n1;
+				}
+			}
+			using std::swap;
+			for (size_t i = 0; i < m; ++i)
+				for (size_t j = 0; j < n; ++j)
+					swap (X[i * ldx + j], Y[j * ldy + i]);
+		}
+
+		/// A <- A^T, A of size n x n
+		template <class Ptr>
+		void transposeInPlaceRec (size_t n, Ptr A, size_t lda)
+		{
+			if (n <= LINBOX_TRANSPOSE_BLOCK) {
+				using std::swap;
+				for (size_t i = 0; i < n; ++i)
+					for (size_t j = i + 1; j < n; ++j)
+						swap (A[i * lda + j], A[j * lda + i]);
+				return;
+			}
+			const size_t n1 = n / 2;
+			transposeInPlaceRec (n1, A, lda);
+			transposeInPlaceRec (n - n1, A + n1 * (lda + 1), lda);
+			swapTransposeRec (n1, n - n1, A + n1, lda, A + n1 * lda, lda);
+		}
+
+		/// Number of strips a transpose of \p entries entries is split into
+		inline size_t transposeStrips (size_t entries, size_t dim)
+		{
+			if (entries < LINBOX_TRANSPOSE_PARALLEL_THRESHOLD)
+				return 1;
+			return std::max<size_t> (1, std::min<size_t> (NUM_THREADS, dim / LINBOX_TRANSPOSE_BLOCK));
+		}
+
+	} // Protected
+
+	/** \brief B <- A^T for row-major dense matrices
+	 *
+	 * A is \f$m \times n\f$ with stride \p lda and B is \f$n \times m\f$
+	 * with stride \p ldb; they must not overlap. The largest dimension is
+	 * halved until the tiles have sides at most LINBOX_TRANSPOSE_BLOCK,
+	 * so that both the rows read and the rows written stay in cache
+	 * whatever its size. Large matrices are cut along their largest
+	 * dimension into strips transposed by parallel tasks.
+	 *
+	 * Elements are copied with \p F.assign, so any element type works,
+	 * including multiprecision integers.
+	 */
+	template <class Field>
+	void transposeBlas (const Field &F, size_t m, size_t n,
+			    typename Field::ConstElement_ptr A, size_t lda,
+			    typename Field::Element_ptr B, size_t ldb)
+	{
+		const bool rows = (m >= n);
+		const size_t dim = rows ? m : n;
+		const size_t NN = Protected::transposeStrips (m * n, dim);
+		if (NN == 1) {
+			Protected::transposeRec (F, m, n, A, lda, B, ldb);
+			return;
+		}
+
+		SYNCH_GROUP(
+		for (size_t t = 0; t < NN; ++t) {
+			const size_t first = dim * t / NN, last = dim * (t + 1) / NN;
+			typename Field::ConstElement_ptr At = rows ? A + first * lda : A + first;
+			typename Field::Element_ptr      Bt = rows ? B + first : B + first * ldb;
+			const size_t mt = rows ? last - first : m;
+			const size_t nt = rows ? n : last - first;
+			{ TASK(MODE(CONSTREFERENCE(F) READ(At) WRITE(Bt)),
+			       Protected::transposeRec (F, mt, nt, At, lda, Bt, ldb);)}
+		}
+		)
+	}
+
+	/** \brief A <- A^T for a square row-major dense matrix of size \p n
+	 *
+	 * The diagonal blocks are transposed recursively and the
+	 * off-diagonal ones swapped, by strips in parallel for large matrices.
+	 */
+	template <class Field>
+	void transposeBlasInPlace (const Field &F, size_t n, typename Field::Element_ptr A, size_t lda)
+	{
+		const size_t n1 = n / 2;
+		const size_t NN = Protected::transposeStrips (n * n, n1);
+		if (NN == 1) {
+			Protected::transposeInPlaceRec (n, A, lda);
+			return;
+		}
+
+		// [A11 A12; A21 A22]: A11 and A22 in place, A12 <-> A21^T by strips of rows of A12
+		SYNCH_GROUP(
+		{ TASK(MODE(READWRITE(A)), Protected::transposeInPlaceRec (n1, A, lda);)}
+		{ TASK(MODE(READWRITE(A)), Protected::transposeInPlaceRec (n - n1, A + n1 * (lda + 1), lda);)}
+		for (size_t t = 0; t < NN; ++t) {
+			const size_t first = n1 * t / NN, last = n1 * (t + 1) / NN;
+			typename Field::Element_ptr X = A + first * lda + n1;
+			typename Field::Element_ptr Y = A + n1 * lda + first;
+			{ TASK(MODE(READWRITE(X, Y)),
+			       Protected::swapTransposeRec (last - first, n - n1, X, lda, Y, lda);)}
+		}
+		)
+	}
+
+} // LinBox
+
+#endif // __LINBOX_matrix_densematrix_blas_transpose_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -61,10 +61,10 @@ namespace LinBox
         ConstElement_ptr getConstPointer() const { return TransposeMatrix<Matrix>::_Mat.getConstPointer();}
 
         template <class Vector1, class Vector2>
-        Vector1&  apply (Vector1& y, const Vector2& x) const { return TransposeMatrix<Matrix>::_Mat.applyTranpose(y,x);}
+        Vector1&  apply (Vector1& y, const Vector2& x) const { return TransposeMatrix<Matrix>::_Mat.applyTranspose(y,x);}
 
         template <class Vector1, class Vector2>
-        Vector1&  applyTranpose (Vector1& y, const Vector2& x) const { return TransposeMatrix<Matrix>::_Mat.apply(y,x);}
+        Vector1&  applyTranspose (Vector1& y, const Vector2& x) const { return TransposeMatrix<Matrix>::_Mat.apply(y,x);}
 
         void random() { TransposeMatrix<Matrix>::_Mat.random();}
         template<typename RandIter>
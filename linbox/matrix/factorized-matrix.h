@@ -36,6 +36,7 @@
 #include "linbox/matrix/densematrix/blas-matrix.h"
 
 #include "linbox/matrix/permutation-matrix.h"
+#include "linbox/matrix/matrixdomain/blas-parallel.h"
 
 namespace LinBox
 {
@@ -83,15 +84,20 @@ namespace LinBox
 		bool                  _alloc;
 		bool                  _plloc;
 
+		//! PLUQ factorization of _factLU, with the parallel PLUQ if \p numThreads > 1 or 0 (all threads)
+		void factorize (size_t numThreads) ;
+
 	public:
 
-		//! Contruction of PLUQ factorization of A (making a copy of A)
+		/** Contruction of PLUQ factorization of A (making a copy of A)
+		 * @param numThreads number of threads of the factorization, see BlasMatrixDomain::setNumThreads
+		 */
 		template<class _Rep>
-		PLUQMatrix (const BlasMatrix<Field,_Rep>& A) ;
+		PLUQMatrix (const BlasMatrix<Field,_Rep>& A, size_t numThreads = 1) ;
 
 		//! Contruction of PLUQ factorization of A (in-place in A) 
 		template<class _Rep>
-		PLUQMatrix (BlasMatrix<Field,_Rep>& A) ;
+		PLUQMatrix (BlasMatrix<Field,_Rep>& A, size_t numThreads = 1) ;
 
 
 		/*! Contruction of PLUQ factorization of A (making a copy of A).
@@ -99,7 +105,7 @@ namespace LinBox
 		 */
 		template<class _Rep>
 		PLUQMatrix (const BlasMatrix<Field,_Rep>& A,
-			    BlasPermutation<size_t> & P, BlasPermutation<size_t> & Q) ;
+			    BlasPermutation<size_t> & P, BlasPermutation<size_t> & Q, size_t numThreads = 1) ;
 
 		/*! Contruction of PLUQ factorization of A (in-place in A).
 		 * P and Q are arguments !
@@ -107,7 +113,7 @@ namespace LinBox
 		 */
 		template<class _Rep>
 		PLUQMatrix (BlasMatrix<Field,_Rep>& A,
-			    BlasPermutation<size_t> & P, BlasPermutation<size_t> & Q) ;
+			    BlasPermutation<size_t> & P, BlasPermutation<size_t> & Q, size_t numThreads = 1) ;
 
 		//! destructor.
 		~PLUQMatrix () ;
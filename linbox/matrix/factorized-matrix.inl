@@ -1045,48 +1045,32 @@ namespace LinBox
 {
 	template <class Field>
 	template <class _Rep>
-	PLUQMatrix<Field>::PLUQMatrix (const BlasMatrix<Field,_Rep>& A) :
+	PLUQMatrix<Field>::PLUQMatrix (const BlasMatrix<Field,_Rep>& A, size_t numThreads) :
 		_field(A.field()), _factLU(*(new BlasMatrix<Field,_Rep> (A))) ,
 		_permP(*(new BlasPermutation<size_t>(A.rowdim()))),
 		_permQ(*(new BlasPermutation<size_t>(A.coldim()))),
 		_m(A.rowdim()), _n(A.coldim()),
 		_alloc(true),_plloc(true)
 	{
-		if (!A.coldim() || !A.rowdim()) {
-			// throw LinBoxError("PLUQ does not accept empty matrices");
-			_rank = 0 ;
-		}
-		else {
-			_rank= FFPACK::PLUQ (_field, FFLAS::FflasNonUnit, _m, _n,
-						 _factLU.getPointer(),_factLU.getStride(),
-						 _permP.getPointer(), _permQ.getPointer());
-		}
+		factorize(numThreads);
 	}
 
 	template <class Field>
 	template <class _Rep>
-	PLUQMatrix<Field>::PLUQMatrix (BlasMatrix<Field,_Rep>& A) :
+	PLUQMatrix<Field>::PLUQMatrix (BlasMatrix<Field,_Rep>& A, size_t numThreads) :
 		_field(A.field()), _factLU(static_cast<BlasMatrix<Field,_Rep>&> (A)) ,
 		_permP(*(new BlasPermutation<size_t>(A.rowdim()))),
 		_permQ(*(new BlasPermutation<size_t>(A.coldim()))),
 		_m(A.rowdim()), _n(A.coldim()),
 		_alloc(false),_plloc(true)
 	{
-		if (!A.coldim() || !A.rowdim()) {
-			// throw LinBoxError("PLUQ does not accept empty matrices");
-			_rank = 0 ;
-		}
-		else {
-			_rank= FFPACK::PLUQ( _field,FFLAS::FflasNonUnit, _m, _n,
-						 _factLU.getPointer(),_factLU.getStride(),
-						 _permP.getPointer(), _permQ.getPointer());
-		}
+		factorize(numThreads);
 	}
 
 	template <class Field>
 	template <class _Rep>
 	PLUQMatrix<Field>::PLUQMatrix (const BlasMatrix<Field,_Rep>& A,
-				       BlasPermutation<size_t> & P, BlasPermutation<size_t> & Q) :
+				       BlasPermutation<size_t> & P, BlasPermutation<size_t> & Q, size_t numThreads) :
 		_field(A.field()), _factLU(*(new BlasMatrix<Field,_Rep> (A))) ,
 		_permP(P), _permQ(Q),
 		_m(A.rowdim()), _n(A.coldim()),
@@ -1096,16 +1080,13 @@ namespace LinBox
 		linbox_check(_permQ.getOrder()==A.coldim());
 		linbox_check(_permP.getOrder()==A.rowdim());
 
-
-		_rank= FFPACK::PLUQ( _field,FFLAS::FflasNonUnit, _m, _n,
-					 _factLU.getPointer(),_factLU.getStride(),
-					 _permP.getPointer(), _permQ.getPointer());
+		factorize(numThreads);
 	}
 
 	template <class Field>
 	template <class _Rep>
 	PLUQMatrix<Field>::PLUQMatrix (BlasMatrix<Field,_Rep>& A,
-				       BlasPermutation<size_t> & P, BlasPermutation<size_t> & Q) :
+				       BlasPermutation<size_t> & P, BlasPermutation<size_t> & Q, size_t numThreads) :
 		_field(A.field()), _factLU(static_cast<BlasMatrix<Field,_Rep>&> (A)) ,
 		_permP(P), _permQ(Q),
 		_m(A.rowdim()), _n(A.coldim()),
@@ -1114,9 +1095,30 @@ namespace LinBox
         _permQ.resize(A.coldim());
         _permP.resize(A.rowdim());
 
-		_rank= FFPACK::PLUQ<Field>( _field,FFLAS::FflasNonUnit, _m, _n,
-                                                _factLU.getPointer(),_factLU.getStride(),
-                                                _permP.getPointer(), _permQ.getPointer());
+		factorize(numThreads);
+	}
+
+	template <class Field>
+	void PLUQMatrix<Field>::factorize (size_t numThreads)
+	{
+		numThreads = blasThreads (numThreads);
+		if (!_m || !_n) {
+			// throw LinBoxError("PLUQ does not accept empty matrices");
+			_rank = 0 ;
+		}
+		else if (numThreads > 1) {
+			PAR_BLOCK {
+				_rank= FFPACK::PLUQ( _field,FFLAS::FflasNonUnit, _m, _n,
+						     _factLU.getPointer(),_factLU.getStride(),
+						     _permP.getPointer(), _permQ.getPointer(),
+						     BlasParallelHelper(numThreads));
+			}
+		}
+		else {
+			_rank= FFPACK::PLUQ( _field,FFLAS::FflasNonUnit, _m, _n,
+					     _factLU.getPointer(),_factLU.getStride(),
+					     _permP.getPointer(), _permQ.getPointer());
+		}
 	}
 
 	template <class Field>
@@ -51,6 +51,7 @@ namespace LinBox
 
 	struct MatrixContainerCategory {
 		struct BlasContainer{};
+		struct TransposedBlasContainer{};
 		struct Container{};
 		struct Blackbox{};
 	};
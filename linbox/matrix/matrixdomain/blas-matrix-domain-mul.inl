@@ -81,6 +81,45 @@ namespace LinBox {
         }
     };
 
+    // Parallel fgemm for two matrix containers
+    template <>
+    struct BlasMatrixDomainParallelMul<ContainerCategories::Matrix, ContainerCategories::Matrix>
+    {
+        template <class Matrix1, class Matrix2, class Matrix3>
+        static Matrix1& mul (size_t numThreads, Matrix1 &C, const Matrix2 &A, const Matrix3 &B)
+        {
+            return muladdin(numThreads, C.field().zero, C, C.field().one, A, B);
+        }
+
+        template <class Matrix1, class Matrix2, class Matrix3, class Matrix4>
+        static Matrix1& muladd (size_t numThreads, Matrix1 &D,
+                                const typename Matrix1::Field::Element &beta, const Matrix2 &C,
+                                const typename Matrix1::Field::Element &alpha, const Matrix3 &A, const Matrix4 &B)
+        {
+			linbox_check( D.rowdim() == C.rowdim());
+			linbox_check( D.coldim() == C.coldim());
+            D.copy(C);
+            return muladdin(numThreads, beta, D, alpha, A, B);
+        }
+
+        template <class Matrix1, class Matrix3, class Matrix4>
+        static Matrix1& muladdin (size_t numThreads,
+                                  const typename Matrix1::Field::Element &beta, Matrix1 &C,
+                                  const typename Matrix1::Field::Element &alpha, const Matrix3 &A, const Matrix4 &B)
+        {
+            linbox_check( A.coldim() == B.rowdim()); linbox_check( C.rowdim() == A.rowdim());
+			linbox_check( C.coldim() == B.coldim());
+
+            PAR_BLOCK {
+                FFLAS::fgemm( C.field(), isTransposed<Matrix3>::value, isTransposed<Matrix4>::value,
+                              C.rowdim(), C.coldim(), A.coldim(),
+                              alpha, A.getPointer(), A.getStride() , B.getPointer(), B.getStride(),
+                              beta,  C.getPointer(), C.getStride(), BlasParallelHelper(numThreads));
+            }
+            return C;
+        }
+    };
+
     // Specialization for vector container (i.e. BlasVector,  BlasSubvector)
     template <typename Vector1,typename Vector2,typename Vector3,typename Matrix>
     struct BlasMatrixDomainMulAdd_specialized<Vector1,Vector2,Vector3,Matrix, ContainerCategories::Vector, ContainerCategories::Matrix>
@@ -53,6 +53,7 @@
 #include "linbox/matrix/dense-matrix.h"
 #include "linbox/matrix/permutation-matrix.h"
 #include "linbox/matrix/factorized-matrix.h"
+#include "linbox/matrix/matrixdomain/blas-parallel.h"
 
 
 
@@ -152,6 +153,38 @@ namespace LinBox
 		}
 	};
 
+	/** @internal
+	 * Multiplications of BlasMatrixDomain with \p numThreads threads (see
+	 * BlasMatrixDomain::setNumThreads), by the category of the operands A and B.
+	 * Only products of two matrix containers have a parallel kernel, the
+	 * other operands use the sequential functors.
+	 */
+	template <typename Operand2Trait, typename Operand3Trait>
+	struct BlasMatrixDomainParallelMul
+	{
+		template <class Operand1, class Operand2, class Operand3>
+		static Operand1& mul (size_t numThreads, Operand1 &C, const Operand2 &A, const Operand3 &B)
+		{
+			return BlasMatrixDomainMul<Operand1,Operand2,Operand3>()(C,A,B);
+		}
+
+		template <class Operand1, class Operand2, class Operand3, class Operand4>
+		static Operand1& muladd (size_t numThreads, Operand1 &D,
+					 const typename Operand1::Field::Element &beta, const Operand2 &C,
+					 const typename Operand1::Field::Element &alpha, const Operand3 &A, const Operand4 &B)
+		{
+			return BlasMatrixDomainMulAdd<Operand1,Operand2,Operand3,Operand4>()(D,beta,C,alpha,A,B);
+		}
+
+		template <class Operand1, class Operand3, class Operand4>
+		static Operand1& muladdin (size_t numThreads,
+					   const typename Operand1::Field::Element &beta, Operand1 &C,
+					   const typename Operand1::Field::Element &alpha, const Operand3 &A, const Operand4 &B)
+		{
+			return BlasMatrixDomainMulAdd<Operand1,Operand1,Operand3,Operand4>()(beta,C,alpha,A,B);
+		}
+	};
+
 	/*! @internal
 	 * Class handling in-place multiplication of a Matrix by an Operand.
 	 *  Operand can be either a matrix a permutation or a vector
@@ -225,8 +258,8 @@ namespace LinBox
 	template<class Matrix>
 	class BlasMatrixDomainRank {
 	public:
-        size_t operator() (const Matrix& A) const;
-		size_t operator() (Matrix& A) const;
+        size_t operator() (const Matrix& A, size_t numThreads = 1) const;
+		size_t operator() (Matrix& A, size_t numThreads = 1) const;
 	};
 
 	/*! @internal
@@ -241,8 +274,8 @@ namespace LinBox
 	template<class Matrix>
 	class BlasMatrixDomainDet {
     public:
-        typename Matrix::Field::Element operator() (const Matrix& A) const;
-        typename Matrix::Field::Element operator() (Matrix& A) const;
+        typename Matrix::Field::Element operator() (const Matrix& A, size_t numThreads = 1) const;
+        typename Matrix::Field::Element operator() (Matrix& A, size_t numThreads = 1) const;
     };
 
 	/*! @internal
@@ -256,8 +289,8 @@ namespace LinBox
 	template<class Operand1, class Matrix, class Operand2=Operand1>
 	class BlasMatrixDomainLeftSolve {
 	public:
-		Operand1 &operator() (Operand1 &X, const Matrix &A, const Operand2 &B) const;
-		Operand1 &operator() (const Matrix &A, Operand1 &B) const;
+		Operand1 &operator() (Operand1 &X, const Matrix &A, const Operand2 &B, size_t numThreads = 1) const;
+		Operand1 &operator() (const Matrix &A, Operand1 &B, size_t numThreads = 1) const;
 	};
 
 	/*! @internal
@@ -271,8 +304,8 @@ namespace LinBox
 	template<class Operand1, class Matrix, class Operand2=Operand1>
 	class BlasMatrixDomainRightSolve {
 	public:
-		Operand1 &operator() (Operand1 &X, const Matrix &A, const Operand2 &B) const;
-		Operand1 &operator() (const Matrix &A, Operand1 &B) const;
+		Operand1 &operator() (Operand1 &X, const Matrix &A, const Operand2 &B, size_t numThreads = 1) const;
+		Operand1 &operator() (const Matrix &A, Operand1 &B, size_t numThreads = 1) const;
 	};
 
 	/*! @internal
@@ -321,22 +354,35 @@ namespace LinBox
 	protected:
 
 		const Field  * _field;
+		size_t     _numThreads;
 
 	public:
 
 		//! Constructor of BlasDomain.
-		BlasMatrixDomain () {}
-		BlasMatrixDomain (const Field& F ) { init(F); }
+		BlasMatrixDomain () : _numThreads(1) {}
+		BlasMatrixDomain (const Field& F ) : _numThreads(1) { init(F); }
 
 		void init(const Field& F ){_field = &F;}
 
 		//! Copy constructor
-		BlasMatrixDomain (const BlasMatrixDomain<Field> & BMD): _field(BMD._field) {}
+		BlasMatrixDomain (const BlasMatrixDomain<Field> & BMD): _field(BMD._field), _numThreads(BMD._numThreads) {}
 
 
 		//! Field accessor
 		const Field& field() const { return *_field; }
 
+		/** Number of threads of the FFLAS-FFPACK kernels.
+		 * With 1, the default, everything is sequential. Otherwise the
+		 * products of matrices, the triangular solves with a matrix right
+		 * hand side, the PLUQ factorizations of the solves, the rank and
+		 * the determinant use the parallel kernels, on \p numThreads
+		 * threads or on all the threads of the runtime for 0.
+		 */
+		BlasMatrixDomain<Field>& setNumThreads(size_t numThreads) { _numThreads = numThreads; return *this; }
+
+		//! Number of threads of the kernels, 1 if sequential
+		size_t numThreads() const { return _numThreads == 1 ? 1 : blasThreads(_numThreads); }
+
 		/*
 		 * Basics operation available matrix respecting BlasMatrix interface
 		 */
@@ -346,6 +392,9 @@ namespace LinBox
 		template <class Operand1, class Operand2, class Operand3>
 		Operand1& mul(Operand1& C, const Operand2& A, const Operand3& B) const
 		{
+			if (_numThreads != 1)
+				return BlasMatrixDomainParallelMul<typename ContainerTraits<Operand2>::ContainerCategory,
+								   typename ContainerTraits<Operand3>::ContainerCategory>::mul(numThreads(),C,A,B);
 			return BlasMatrixDomainMul<Operand1,Operand2,Operand3>()(C,A,B);
 		}
 
@@ -473,6 +522,9 @@ namespace LinBox
 		Operand1& muladd(Operand1& D, const Element& beta, const Operand2& C,
                          const Element& alpha, const Operand3& A, const Operand4& B) const
 		{
+			if (_numThreads != 1)
+				return BlasMatrixDomainParallelMul<typename ContainerTraits<Operand3>::ContainerCategory,
+								   typename ContainerTraits<Operand4>::ContainerCategory>::muladd(numThreads(),D,beta,C,alpha,A,B);
 			return BlasMatrixDomainMulAdd<Operand1,Operand2,Operand3,Operand4>()(D,beta,C,alpha,A,B);
 		}
 
@@ -482,6 +534,9 @@ namespace LinBox
 		Operand1& muladdin(const Element& beta, Operand1& C,
                            const Element& alpha, const Operand2& A, const Operand3& B) const
 		{
+			if (_numThreads != 1)
+				return BlasMatrixDomainParallelMul<typename ContainerTraits<Operand2>::ContainerCategory,
+								   typename ContainerTraits<Operand3>::ContainerCategory>::muladdin(numThreads(),beta,C,alpha,A,B);
 			return BlasMatrixDomainMulAdd<Operand1,Operand1,Operand2,Operand3>()(beta,C,alpha,A,B);
 		}
 
@@ -563,21 +618,21 @@ namespace LinBox
 		template <class Matrix>
 		unsigned int rank(const Matrix &A) const
 		{
-			return BlasMatrixDomainRank<Matrix>()(A);
+			return BlasMatrixDomainRank<Matrix>()(A, numThreads());
 		}
 
 		//! in-place Rank (the matrix is modified)
 		template <class Matrix>
 		unsigned int rankInPlace(Matrix &A) const
 		{
-			return BlasMatrixDomainRank<Matrix>()(A);
+			return BlasMatrixDomainRank<Matrix>()(A, numThreads());
 		}
 
 		//! determinant
 		template <class Matrix>
 		Element det(const Matrix &A) const
 		{
-			return BlasMatrixDomainDet<Matrix>()(A);
+			return BlasMatrixDomainDet<Matrix>()(A, numThreads());
 		}
 
 		//! in-place Determinant (the matrix is modified)
@@ -585,7 +640,7 @@ namespace LinBox
 		Element detInPlace(Matrix &A) const
 		{
 
-			return BlasMatrixDomainDet<Matrix>()(A);
+			return BlasMatrixDomainDet<Matrix>()(A, numThreads());
 		}
 		//@}
 
@@ -599,7 +654,7 @@ namespace LinBox
 		template <class Operand1, class Matrix, class Operand2>
 		Operand1& left_solve (Operand1& X, const Matrix& A, const Operand2& B) const
 		{
-			return BlasMatrixDomainLeftSolve<Operand1,Matrix,Operand2>()(X,A,B);
+			return BlasMatrixDomainLeftSolve<Operand1,Matrix,Operand2>()(X,A,B,numThreads());
 		}
 
 		//! linear solve with matrix right hand side, the result is stored in-place in B.
@@ -608,7 +663,7 @@ namespace LinBox
 		template <class Operand,class Matrix>
 		Operand& left_solve (const Matrix& A, Operand& B) const
 		{
-			return BlasMatrixDomainLeftSolve<Operand,Matrix,Operand>()(A,B);
+			return BlasMatrixDomainLeftSolve<Operand,Matrix,Operand>()(A,B,numThreads());
 		}
 
 		//! linear solve with matrix right hand side.
@@ -616,7 +671,7 @@ namespace LinBox
 		template <class Operand1, class Matrix, class Operand2>
 		Operand1& right_solve (Operand1& X, const Matrix& A, const Operand2& B) const
 		{
-			return BlasMatrixDomainRightSolve<Operand1,Matrix,Operand2>()(X,A,B);
+			return BlasMatrixDomainRightSolve<Operand1,Matrix,Operand2>()(X,A,B,numThreads());
 		}
 
 		//! linear solve with matrix right hand side, the result is stored in-place in B.
@@ -625,7 +680,7 @@ namespace LinBox
 		template <class Operand, class Matrix>
 		Operand& right_solve (const Matrix& A, Operand& B) const
 		{
-			return BlasMatrixDomainRightSolve<Operand,Matrix,Operand>()(A,B);
+			return BlasMatrixDomainRightSolve<Operand,Matrix,Operand>()(A,B,numThreads());
 		}
 
 		//! minimal polynomial computation.
@@ -636,6 +691,7 @@ namespace LinBox
 		}
 
 		//! characteristic polynomial computation.
+		//! @note FFPACK has no parallel charpoly: it is sequential whatever numThreads()
 		template <class Polynomial, class Matrix >
 		Polynomial& charpoly (Polynomial& P,  Matrix& A ) const // PG: remove constness of A as required by FFPACK
 		{
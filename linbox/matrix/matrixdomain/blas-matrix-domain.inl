@@ -40,28 +40,34 @@ namespace LinBox
 
 	template<class Matrix>
     typename Matrix::Field::Element
-	BlasMatrixDomainDet<Matrix>::operator() (const Matrix& A) const
+	BlasMatrixDomainDet<Matrix>::operator() (const Matrix& A, size_t numThreads) const
 	{
         if (A.rowdim() != A.coldim())
             return A.field().zero;
         typename Matrix::matrixType Acopy(A);
-        return 	BlasMatrixDomainDet<typename Matrix::matrixType>()(Acopy);
+        return 	BlasMatrixDomainDet<typename Matrix::matrixType>()(Acopy, numThreads);
     }
 
 	template<class Matrix>
 	typename Matrix::Field::Element
-	BlasMatrixDomainDet<Matrix>::operator() (Matrix& A) const
+	BlasMatrixDomainDet<Matrix>::operator() (Matrix& A, size_t numThreads) const
 	{
         if (A.rowdim() != A.coldim())
             return A.field().zero;
         typename Matrix::Field::Element det; A.field().init(det);
+        if (numThreads > 1) {
+            PAR_BLOCK {
+                FFPACK::Det(A.field(), det, A.coldim(), A.getPointer(), A.getStride(), BlasParallelHelper(numThreads));
+            }
+            return det;
+        }
         return FFPACK::Det(A.field(), det, A.coldim(), A.getPointer(), A.getStride());
 	}
 
 	template< class Matrix>
     class BlasMatrixDomainDet<TriangularBlasMatrix<Matrix> >{
     public:
-        typename Matrix::Field::Element operator() (const TriangularBlasMatrix<Matrix> & A) const
+        typename Matrix::Field::Element operator() (const TriangularBlasMatrix<Matrix> & A, size_t = 1) const
         {
             if (A.rowdim() != A.coldim())
                 return A.field().zero;
@@ -74,9 +80,9 @@ namespace LinBox
             return d;        
         }
         
-        typename Matrix::Field::Element operator() (TriangularBlasMatrix<Matrix> & A) const
+        typename Matrix::Field::Element operator() (TriangularBlasMatrix<Matrix> & A, size_t = 1) const
         {
-            return (*this)(const_cast<TriangularBlasMatrix<Matrix> &>(A));
+            return (*this)(const_cast<const TriangularBlasMatrix<Matrix> &>(A));
         }
     };
 } // LinBox
@@ -86,16 +92,23 @@ namespace LinBox
 
 	template<class Matrix>
     size_t
-	BlasMatrixDomainRank<Matrix>::operator() (const  Matrix  &A) const
+	BlasMatrixDomainRank<Matrix>::operator() (const  Matrix  &A, size_t numThreads) const
 	{
         typename Matrix::matrixType Acopy(A);
-        return 	BlasMatrixDomainRank<typename Matrix::matrixType>()(Acopy);
+        return 	BlasMatrixDomainRank<typename Matrix::matrixType>()(Acopy, numThreads);
 	}
 
 	template<class Matrix>
     size_t
-	BlasMatrixDomainRank<Matrix>::operator() (Matrix        &A) const
+	BlasMatrixDomainRank<Matrix>::operator() (Matrix        &A, size_t numThreads) const
 	{
+        if (numThreads > 1) {
+            size_t r = 0;
+            PAR_BLOCK {
+                r = FFPACK::Rank(A.field(),A.rowdim(), A.coldim(), A.getPointer(), A.getStride(), BlasParallelHelper(numThreads));
+            }
+            return r;
+        }
         return FFPACK::Rank(A.field(),A.rowdim(), A.coldim(), A.getPointer(), A.getStride());
 	}
 
@@ -193,33 +206,33 @@ namespace LinBox
 	 */
 	template <class Operand1, class Matrix, class Operand2>
 	Operand1&
-	BlasMatrixDomainLeftSolve<Operand1, Matrix, Operand2 >::operator() (Operand1& X, const Matrix& A, const Operand2& B) const
+	BlasMatrixDomainLeftSolve<Operand1, Matrix, Operand2 >::operator() (Operand1& X, const Matrix& A, const Operand2& B, size_t numThreads) const
 	{
-		PLUQMatrix<typename Matrix::Field> PLUQ(A);
+		PLUQMatrix<typename Matrix::Field> PLUQ(A, numThreads);
 		PLUQ.left_solve(X, B);
 		return X;
 	}
 	template <class Operand1, class Matrix, class Operand2>
 	Operand1&
-	BlasMatrixDomainLeftSolve<Operand1, Matrix, Operand2 >::operator() (const Matrix& A, Operand1& B) const
+	BlasMatrixDomainLeftSolve<Operand1, Matrix, Operand2 >::operator() (const Matrix& A, Operand1& B, size_t numThreads) const
 	{
-		PLUQMatrix<typename Matrix::Field> PLUQ(A);
+		PLUQMatrix<typename Matrix::Field> PLUQ(A, numThreads);
 		PLUQ.left_solve(B);
 		return B;
 	}
 	template <class Operand1, class Matrix, class Operand2>
 	Operand1&
-	BlasMatrixDomainRightSolve<Operand1, Matrix, Operand2 >::operator() (Operand1& X, const Matrix& A, const Operand2& B) const
+	BlasMatrixDomainRightSolve<Operand1, Matrix, Operand2 >::operator() (Operand1& X, const Matrix& A, const Operand2& B, size_t numThreads) const
 	{
-		PLUQMatrix<typename Matrix::Field> PLUQ(A);
+		PLUQMatrix<typename Matrix::Field> PLUQ(A, numThreads);
 		PLUQ.right_solve(X, B);
 		return X;
 	}
 	template <class Operand1, class Matrix, class Operand2>
 	Operand1&
-	BlasMatrixDomainRightSolve<Operand1, Matrix, Operand2 >::operator() ( const Matrix& A, Operand1& B) const
+	BlasMatrixDomainRightSolve<Operand1, Matrix, Operand2 >::operator() ( const Matrix& A, Operand1& B, size_t numThreads) const
 	{
-		PLUQMatrix<typename Matrix::Field> PLUQ(A);
+		PLUQMatrix<typename Matrix::Field> PLUQ(A, numThreads);
 		PLUQ.right_solve(B);
 		return B;
 	}
@@ -235,17 +248,25 @@ namespace LinBox
 	template <class Matrix1, class Matrix2, class Matrix3>
     class BlasMatrixDomainLeftSolve<Matrix1, TriangularBlasMatrix<Matrix2>, Matrix3> {
     public:
-        Matrix1& operator() (Matrix1& X, const TriangularBlasMatrix<Matrix2>& A, const Matrix3& B) const
+        Matrix1& operator() (Matrix1& X, const TriangularBlasMatrix<Matrix2>& A, const Matrix3& B, size_t numThreads = 1) const
         {
             linbox_check( X.rowdim() == B.rowdim());
             linbox_check( X.coldim() == B.coldim());
             X.copy(B);        
-            return (*this)(A, X);
+            return (*this)(A, X, numThreads);
         }        
-        Matrix3& operator() (const TriangularBlasMatrix<Matrix2>& A, Matrix3& B) const
+        Matrix3& operator() (const TriangularBlasMatrix<Matrix2>& A, Matrix3& B, size_t numThreads = 1) const
         {
             linbox_check( A.rowdim() == A.coldim());
             linbox_check( A.coldim() == B.rowdim());
+            if (numThreads > 1) {
+                PAR_BLOCK {
+                    FFLAS::ftrsm( A.field(), FFLAS::FflasLeft, (FFLAS::FFLAS_UPLO) A.getUpLo(),isTransposed<Matrix3>::value,(FFLAS::FFLAS_DIAG) A.getDiag(),
+                                  A.rowdim(), B.coldim(), A.field().one, A.getPointer(), A.getStride(), B.getPointer(), B.getStride(),
+                                  BlasParallelHelper(numThreads));
+                }
+                return B;
+            }
             FFLAS::ftrsm( A.field(), FFLAS::FflasLeft, (FFLAS::FFLAS_UPLO) A.getUpLo(),isTransposed<Matrix3>::value,(FFLAS::FFLAS_DIAG) A.getDiag(),
                           A.rowdim(), B.coldim(), A.field().one, A.getPointer(), A.getStride(), B.getPointer(), B.getStride());
             return B;
@@ -256,17 +277,25 @@ namespace LinBox
     template <class Matrix1, class Matrix2, class Matrix3>
 	class BlasMatrixDomainRightSolve<Matrix1, TriangularBlasMatrix<Matrix3>, Matrix2> {
     public:
-        Matrix1&operator() (Matrix1& X, const TriangularBlasMatrix<Matrix3>& A, const Matrix2& B) const
+        Matrix1&operator() (Matrix1& X, const TriangularBlasMatrix<Matrix3>& A, const Matrix2& B, size_t numThreads = 1) const
         {
             linbox_check( X.rowdim() == B.rowdim());
             linbox_check( X.coldim() == B.coldim());
             X.copy(B);        
-            return (*this)(A, X);
+            return (*this)(A, X, numThreads);
         }        
-        Matrix2& operator() (const TriangularBlasMatrix<Matrix3>& A, Matrix2& B) const
+        Matrix2& operator() (const TriangularBlasMatrix<Matrix3>& A, Matrix2& B, size_t numThreads = 1) const
         {
             linbox_check( A.rowdim() == A.coldim());
             linbox_check( A.coldim() == B.rowdim());
+            if (numThreads > 1) {
+                PAR_BLOCK {
+                    FFLAS::ftrsm( A.field(), FFLAS::FflasRight, (FFLAS::FFLAS_UPLO) A.getUpLo(),isTransposed<Matrix2>::value,(FFLAS::FFLAS_DIAG) A.getDiag(),
+                                  A.rowdim(), B.coldim(), A.field().one, A.getPointer(), A.getStride(), B.getPointer(), B.getStride(),
+                                  BlasParallelHelper(numThreads));
+                }
+                return B;
+            }
             FFLAS::ftrsm( A.field(), FFLAS::FflasRight, (FFLAS::FFLAS_UPLO) A.getUpLo(),isTransposed<Matrix2>::value,(FFLAS::FFLAS_DIAG) A.getDiag(),
                           A.rowdim(), B.coldim(), A.field().one, A.getPointer(), A.getStride(), B.getPointer(), B.getStride());
             return B;
@@ -277,14 +306,14 @@ namespace LinBox
     class BlasMatrixDomainLeftSolve<BlasVector<typename Matrix::Field>, TriangularBlasMatrix<Matrix> > {
     public:
         typedef typename Matrix::Field Field;
-        BlasVector<Field>& operator() (BlasVector<Field>& x,const TriangularBlasMatrix<Matrix>& A,  const BlasVector<Field>& b) const {
+        BlasVector<Field>& operator() (BlasVector<Field>& x,const TriangularBlasMatrix<Matrix>& A,  const BlasVector<Field>& b, size_t = 1) const {
             linbox_check( A.rowdim() == b.size());
             linbox_check( A.coldim() == x.size());
             linbox_check( x.size() == b.size());
             x.copy(b);        
             return (*this)(A, x);
         }      
-        BlasVector<Field>& operator() (const TriangularBlasMatrix<Matrix>& A,  BlasVector<Field>& b) const
+        BlasVector<Field>& operator() (const TriangularBlasMatrix<Matrix>& A,  BlasVector<Field>& b, size_t = 1) const
         {
             linbox_check( A.rowdim() == A.coldim());
             linbox_check( A.rowdim() == b.size());
@@ -298,14 +327,14 @@ namespace LinBox
     class BlasMatrixDomainRightSolve<BlasVector<typename Matrix::Field>, TriangularBlasMatrix<Matrix> >{
     public:
         typedef typename Matrix::Field Field;
-        BlasVector<Field>& operator() (BlasVector<Field>& x, const TriangularBlasMatrix<Matrix>& A, const BlasVector<Field>& b) const {
+        BlasVector<Field>& operator() (BlasVector<Field>& x, const TriangularBlasMatrix<Matrix>& A, const BlasVector<Field>& b, size_t = 1) const {
             linbox_check( A.rowdim() == b.size());
             linbox_check( A.coldim() == x.size());
             linbox_check( x.size() == b.size());
             x.copy(b);        
             return (*this)(A, x);
         }
-        BlasVector<Field>& operator() (const TriangularBlasMatrix<Matrix>& A, BlasVector<Field>& b) const
+        BlasVector<Field>& operator() (const TriangularBlasMatrix<Matrix>& A, BlasVector<Field>& b, size_t = 1) const
         {
             linbox_check( A.rowdim() == A.coldim());
             linbox_check( A.rowdim() == b.size());
@@ -318,14 +347,14 @@ namespace LinBox
     template <class Matrix, class Vect>
     class  BlasMatrixDomainLeftSolve<BlasSubvector<Vect>, TriangularBlasMatrix<Matrix> >{
     public:
-        BlasSubvector<Vect>& operator() (BlasSubvector<Vect>& x,const TriangularBlasMatrix<Matrix>& A,  const BlasSubvector<Vect>& b) const{
+        BlasSubvector<Vect>& operator() (BlasSubvector<Vect>& x,const TriangularBlasMatrix<Matrix>& A,  const BlasSubvector<Vect>& b, size_t = 1) const{
             linbox_check( A.rowdim() == b.size());
             linbox_check( A.coldim() == x.size());
             linbox_check( x.size() == b.size());
             x.copy(b);        
             return (*this)(A, x);
         }            
-        BlasSubvector<Vect>& operator() (const TriangularBlasMatrix<Matrix>& A,  BlasSubvector<Vect>& b) const
+        BlasSubvector<Vect>& operator() (const TriangularBlasMatrix<Matrix>& A,  BlasSubvector<Vect>& b, size_t = 1) const
         {
 			linbox_check( A.rowdim() == A.coldim());
 			linbox_check( A.rowdim() == b.size());
@@ -338,14 +367,14 @@ namespace LinBox
 	template <class Matrix, class Vect>
     class BlasMatrixDomainRightSolve<BlasSubvector<Vect>, TriangularBlasMatrix<Matrix> >{
     public:
-        BlasSubvector<Vect>& operator() (BlasSubvector<Vect>& x,const TriangularBlasMatrix<Matrix>& A,  const BlasSubvector<Vect>& b) const{
+        BlasSubvector<Vect>& operator() (BlasSubvector<Vect>& x,const TriangularBlasMatrix<Matrix>& A,  const BlasSubvector<Vect>& b, size_t = 1) const{
             linbox_check( A.rowdim() == b.size());
             linbox_check( A.coldim() == x.size());
             linbox_check( x.size() == b.size());
             x.copy(b);        
             return (*this)(A, x);
         }            
-        BlasSubvector<Vect>& operator() (const TriangularBlasMatrix<Matrix>& A, BlasSubvector<Vect>& b) const
+        BlasSubvector<Vect>& operator() (const TriangularBlasMatrix<Matrix>& A, BlasSubvector<Vect>& b, size_t = 1) const
         {
 			linbox_check( A.rowdim() == A.coldim());
 			linbox_check( A.rowdim() == b.size());
@@ -0,0 +1,69 @@
+/* linbox/matrix/matrixdomain/blas-parallel.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file matrix/matrixdomain/blas-parallel.h
+ * @ingroup matrixdomain
+ * @brief Parallel strategy of the FFLAS-FFPACK kernels used by the dense domains
+ */
+
+#ifndef __LINBOX_matrix_matrixdomain_blas_parallel_H
+#define __LINBOX_matrix_matrixdomain_blas_parallel_H
+
+#include <cstddef>
+
+#include <fflas-ffpack/paladin/parallel.h>
+#include <fflas-ffpack/fflas/fflas.h>
+
+namespace LinBox
+{
+
+	/** \brief Strategy of the parallel FFLAS-FFPACK kernels
+	 *
+	 * fgemm, ftrsm, PLUQ, Rank and Det cut their operands recursively
+	 * into tasks for a given number of threads. The kernels must be
+	 * called inside a PAR_BLOCK.
+	 */
+	typedef FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+					      FFLAS::StrategyParameter::Threads> BlasParallelHelper;
+
+	/** Number of threads of a dense kernel for the option \p numThreads of
+	 * @ref MethodBase and @ref BlasMatrixDomain: 1 is sequential and 0 takes
+	 * all the threads of the runtime (NUM_THREADS).
+	 */
+	inline size_t blasThreads (size_t numThreads)
+	{
+		return numThreads ? numThreads : size_t (NUM_THREADS);
+	}
+
+} // LinBox
+
+#endif // __LINBOX_matrix_matrixdomain_blas_parallel_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
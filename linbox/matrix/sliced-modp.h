@@ -0,0 +1,670 @@
+/* linbox/matrix/sliced-modp.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file matrix/sliced-modp.h
+ * @ingroup matrix
+ * @brief Bit-sliced matrices over GF(p) for small primes p < 16
+ */
+
+#ifndef __LINBOX_matrix_sliced_modp_H
+#define __LINBOX_matrix_sliced_modp_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "linbox/integer.h"
+#include "linbox/util/debug.h"
+#include "linbox/util/error.h"
+#include "linbox/randiter/mersenne-twister.h"
+
+#ifndef LINBOX_SLICED_MODP_THRESHOLD
+/// Smallest dimension for which the dense solutions over GF(p), 5 <= p < 16,
+/// switch to the bit-sliced elimination
+#define LINBOX_SLICED_MODP_THRESHOLD 256
+#endif
+
+namespace LinBox
+{
+
+	/** \brief A unit of 64 entries of GF(P) in bit planes
+	 *
+	 * Plane \f$b\f$ holds bit \f$b\f$ of the 64 residues in
+	 * \f$[0, P)\f$, so that a unit is \f$\lceil\log_2 P\rceil\f$ words:
+	 * 3 words for GF(5) and GF(7), 4 for GF(11) and GF(13). The sum of two
+	 * units is a ripple-carry adder on the planes, whose carry is the
+	 * extra plane, followed by a branch-free conditional subtraction of
+	 * \f$P\f$.
+	 */
+	template <size_t P>
+	class SlicedModpUnit {
+	public:
+		static_assert (P >= 2 && P < 16, "SlicedModpUnit: the prime must be less than 16");
+
+		typedef uint64_t Word;
+
+		static const size_t planes = (P <= 2) ? 1 : (P <= 4) ? 2 : (P <= 8) ? 3 : 4;
+		static const size_t lanes  = 64;
+
+		typedef std::array<Word, planes> Unit;
+
+		static Unit zero ()
+		{
+			Unit z;
+			z.fill (Word (0));
+			return z;
+		}
+
+		static bool isZero (const Unit &x)
+		{
+			Word t = 0;
+			for (size_t b = 0; b < planes; ++b)
+				t |= x[b];
+			return t == 0;
+		}
+
+		/// Residue of lane l
+		static size_t get (const Unit &x, size_t l)
+		{
+			size_t v = 0;
+			for (size_t b = 0; b < planes; ++b)
+				v |= size_t ((x[b] >> l) & 1) << b;
+			return v;
+		}
+
+		/// Sets lane l to the residue v < P
+		static void set (Unit &x, size_t l, size_t v)
+		{
+			const Word bit = Word (1) << l;
+			for (size_t b = 0; b < planes; ++b)
+				if ((v >> b) & 1)
+					x[b] |= bit;
+				else
+					x[b] &= ~bit;
+		}
+
+		/// z <- x + y. z may be x or y.
+		static Unit &add (Unit &z, const Unit &x, const Unit &y)
+		{
+			// s = x + y on planes + 1 bits
+			Word s[planes], c = 0;
+			for (size_t b = 0; b < planes; ++b) {
+				const Word h = x[b] ^ y[b];
+				s[b] = h ^ c;
+				c = (x[b] & y[b]) | (c & h);
+			}
+
+			// t = s - P on planes bits, with borrow br
+			Word t[planes], br = 0;
+			for (size_t b = 0; b < planes; ++b)
+				if ((P >> b) & 1) {
+					t[b] = ~(s[b] ^ br);
+					br = ~s[b] | br;
+				}
+				else {
+					t[b] = s[b] ^ br;
+					br = ~s[b] & br;
+				}
+
+			// s >= P iff the sum carried or s - P did not borrow
+			const Word ge = c | ~br;
+			for (size_t b = 0; b < planes; ++b)
+				z[b] = (t[b] & ge) | (s[b] & ~ge);
+			return z;
+		}
+
+		/// z <- -x. z may be x.
+		static Unit &neg (Unit &z, const Unit &x)
+		{
+			// P - x, masked to the nonzero lanes
+			Word d[planes], br = 0, nz = 0;
+			for (size_t b = 0; b < planes; ++b) {
+				const Word y = x[b];
+				nz |= y;
+				if ((P >> b) & 1) {
+					d[b] = ~(y ^ br);
+					br = y & br;
+				}
+				else {
+					d[b] = y ^ br;
+					br = y | br;
+				}
+			}
+			for (size_t b = 0; b < planes; ++b)
+				z[b] = d[b] & nz;
+			return z;
+		}
+
+		/// z <- x - y. z may be x or y.
+		static Unit &sub (Unit &z, const Unit &x, const Unit &y)
+		{
+			Unit t;
+			neg (t, y);
+			return add (z, x, t);
+		}
+
+		/// z <- a x, with a < P, by doubling and adding. z may be x.
+		static Unit &mul (Unit &z, size_t a, const Unit &x)
+		{
+			if (a == 0)
+				return z = zero ();
+			if (a == P - 1)
+				return neg (z, x);
+
+			size_t h = 1;
+			while ((h << 1) <= a)
+				h <<= 1;
+
+			const Unit y = x;
+			z = y;
+			for (h >>= 1; h != 0; h >>= 1) {
+				add (z, z, z);
+				if (a & h)
+					add (z, z, y);
+			}
+			return z;
+		}
+
+		/// z <- z + a x, with a < P
+		static Unit &axpyin (Unit &z, size_t a, const Unit &x)
+		{
+			if (a == 0)
+				return z;
+			if (a == 1)
+				return add (z, z, x);
+			if (a == P - 1)
+				return sub (z, z, x);
+
+			Unit t;
+			mul (t, a, x);
+			return add (z, z, t);
+		}
+
+		/// Inverse of the nonzero residue a
+		static size_t inv (size_t a)
+		{
+			size_t b = 1;
+			while ((a * b) % P != 1)
+				++b;
+			return b;
+		}
+	};
+
+	template <size_t P> const size_t SlicedModpUnit<P>::planes;
+	template <size_t P> const size_t SlicedModpUnit<P>::lanes;
+
+	/** \brief Dense \f$m\times n\f$ matrix over GF(P), P < 16, bit-sliced by rows
+	 *
+	 * Row \f$i\f$ is \f$\lceil n/64\rceil\f$ consecutive units and lane
+	 * \f$c\f$ of unit \f$w\f$ is column \f$64w+c\f$. Lanes past the last
+	 * column are kept zero. A vector of length \f$n\f$ is a \f$1\times n\f$
+	 * matrix; a block of 64 vectors of length \f$n\f$, as used by
+	 * @ref SlicedModpSparse::apply, is an \f$n\times 64\f$ matrix, one unit
+	 * per row.
+	 */
+	template <size_t P>
+	class SlicedModpMatrix {
+	public:
+		typedef SlicedModpUnit<P>          Arith;
+		typedef typename Arith::Word       Word;
+		typedef typename Arith::Unit       Unit;
+
+		static const size_t prime = P;
+
+		SlicedModpMatrix (size_t m = 0, size_t n = 0) :
+			_rowdim (m), _coldim (n), _units ((n + 63) / 64), _rep (m * _units, Arith::zero ())
+		{}
+
+		size_t rowdim () const { return _rowdim; }
+		size_t coldim () const { return _coldim; }
+		size_t units () const { return _units; }
+
+		Unit *row (size_t i) { return _rep.data () + i * _units; }
+		const Unit *row (size_t i) const { return _rep.data () + i * _units; }
+
+		size_t getEntry (size_t i, size_t j) const
+		{
+			return Arith::get (row (i)[j / 64], j % 64);
+		}
+
+		void setEntry (size_t i, size_t j, size_t a)
+		{
+			Arith::set (row (i)[j / 64], j % 64, a % P);
+		}
+
+		void zero () { std::fill (_rep.begin (), _rep.end (), Arith::zero ()); }
+
+		void swapRows (size_t i, size_t j)
+		{
+			if (i != j)
+				std::swap_ranges (row (i), row (i) + _units, row (j));
+		}
+
+		/// Uniformly random entries
+		SlicedModpMatrix &random (MersenneTwister &MT)
+		{
+			for (size_t i = 0; i < _rowdim; ++i)
+				for (size_t j = 0; j < _coldim; ++j)
+					setEntry (i, j, MT.randomIntRange (0, uint32_t (P)));
+			return *this;
+		}
+
+		bool isEqual (const SlicedModpMatrix &B) const
+		{
+			return _rowdim == B._rowdim && _coldim == B._coldim && _rep == B._rep;
+		}
+
+	protected:
+
+		size_t              _rowdim;
+		size_t              _coldim;
+		size_t              _units;
+		std::vector<Unit>   _rep;
+	};
+
+	template <size_t P> const size_t SlicedModpMatrix<P>::prime;
+
+	/** \brief Sparse matrix over GF(P) applied to blocks of 64 vectors
+	 *
+	 * Compressed rows of small residues. apply() and applyTranspose() act
+	 * on \f$n\times 64w\f$ @ref SlicedModpMatrix blocks, one unit
+	 * operation per nonzero for each 64 vectors, which is the inner loop
+	 * of (block) Wiedemann and Lanczos over small prime fields.
+	 */
+	template <size_t P>
+	class SlicedModpSparse {
+	public:
+		typedef SlicedModpUnit<P>          Arith;
+		typedef typename Arith::Unit       Unit;
+		typedef SlicedModpMatrix<P>        Block;
+
+		SlicedModpSparse () :
+			_rowdim (0), _coldim (0), _start (1, 0)
+		{}
+
+		/// Copy of a sparse matrix over a representation of GF(P)
+		template <class Field, class SparseMatrix>
+		SlicedModpSparse (const Field &F, const SparseMatrix &A) :
+			_rowdim (A.rowdim ()), _coldim (A.coldim ()), _start (A.rowdim () + 1, 0)
+		{
+			for (auto it = A.IndexedBegin (); it != A.IndexedEnd (); ++it)
+				++_start[it.rowIndex () + 1];
+			for (size_t i = 0; i < _rowdim; ++i)
+				_start[i + 1] += _start[i];
+
+			_col.resize (_start[_rowdim]);
+			_coef.resize (_start[_rowdim]);
+
+			std::vector<size_t> next (_start.begin (), _start.end () - 1);
+			for (auto it = A.IndexedBegin (); it != A.IndexedEnd (); ++it) {
+				const uint8_t a = residue (F, it.value ());
+				if (a == 0)
+					continue;
+				const size_t k = next[it.rowIndex ()]++;
+				_col[k] = uint32_t (it.colIndex ());
+				_coef[k] = a;
+			}
+
+			// Drop the slots left by explicit zeros
+			size_t k = 0;
+			for (size_t i = 0; i < _rowdim; ++i) {
+				const size_t b = _start[i], e = next[i];
+				_start[i] = k;
+				for (size_t l = b; l < e; ++l, ++k) {
+					_col[k] = _col[l];
+					_coef[k] = _coef[l];
+				}
+			}
+			_start[_rowdim] = k;
+			_col.resize (k);
+			_coef.resize (k);
+		}
+
+		size_t rowdim () const { return _rowdim; }
+		size_t coldim () const { return _coldim; }
+		size_t size () const { return _col.size (); }
+
+		/// Y <- A X
+		Block &apply (Block &Y, const Block &X) const
+		{
+			linbox_check (X.rowdim () == _coldim && Y.rowdim () == _rowdim);
+			linbox_check (X.units () == Y.units ());
+			const size_t w = X.units ();
+
+			for (size_t i = 0; i < _rowdim; ++i) {
+				Unit *y = Y.row (i);
+				std::fill (y, y + w, Arith::zero ());
+
+				for (size_t k = _start[i]; k < _start[i + 1]; ++k) {
+					const Unit *x = X.row (_col[k]);
+					for (size_t u = 0; u < w; ++u)
+						Arith::axpyin (y[u], _coef[k], x[u]);
+				}
+			}
+			return Y;
+		}
+
+		/// Y <- A^T X
+		Block &applyTranspose (Block &Y, const Block &X) const
+		{
+			linbox_check (X.rowdim () == _rowdim && Y.rowdim () == _coldim);
+			linbox_check (X.units () == Y.units ());
+			const size_t w = X.units ();
+
+			Y.zero ();
+			for (size_t i = 0; i < _rowdim; ++i) {
+				const Unit *x = X.row (i);
+
+				for (size_t k = _start[i]; k < _start[i + 1]; ++k) {
+					Unit *y = Y.row (_col[k]);
+					for (size_t u = 0; u < w; ++u)
+						Arith::axpyin (y[u], _coef[k], x[u]);
+				}
+			}
+			return Y;
+		}
+
+		/// Residue in [0, P) of an element of a representation of GF(P)
+		template <class Field>
+		static uint8_t residue (const Field &F, const typename Field::Element &e)
+		{
+			// reduced residues, possibly balanced
+			integer v;
+			F.convert (v, e);
+			if (v < 0)
+				v += integer (P);
+			for (size_t a = 1; a < P; ++a)
+				if (v == integer (a))
+					return uint8_t (a);
+			return 0;
+		}
+
+	protected:
+
+		size_t                  _rowdim;
+		size_t                  _coldim;
+		std::vector<size_t>     _start;
+		std::vector<uint32_t>   _col;
+		std::vector<uint8_t>    _coef;
+	};
+
+	/** \brief Elimination on @ref SlicedModpMatrix by the Method of Four Russians
+	 *
+	 * Columns are processed by strips of \f$k\f$: a plain elimination
+	 * finds the pivots of the strip and makes them unit and reduced with
+	 * respect to each other, then the \f$P^k\f$ combinations of the pivot
+	 * rows are tabulated, one unit addition per entry, and every other row
+	 * is cleared on the strip by a single addition. The table index of a
+	 * row is its entries at the pivot columns, read as base \f$P\f$
+	 * digits. The table is applied by stripes of units that stay in cache.
+	 */
+	template <size_t P>
+	class SlicedModpElimination {
+	public:
+		typedef SlicedModpUnit<P>          Arith;
+		typedef typename Arith::Unit       Unit;
+		typedef SlicedModpMatrix<P>        Matrix;
+
+		/** Row echelon form, in place, with unit pivots.
+		 * @param A matrix, modified
+		 * @param pivots on return, pivots[i] is the pivot column of row i;
+		 *        pivot columns are increasing
+		 * @param reduced also clear the pivot columns above the pivots
+		 * @return the rank
+		 */
+		static size_t rowEchelonize (Matrix &A, std::vector<size_t> &pivots, bool reduced = false)
+		{
+			const size_t m = A.rowdim (), n = A.coldim (), units = A.units ();
+			pivots.clear ();
+
+			const size_t k = stripWidth (std::min (m, n));
+			std::vector<size_t> pc (k), index (m);
+			std::vector<Unit> T, negPivot;
+
+			size_t r = 0;
+			for (size_t c = 0; c < n && r < m; c += k) {
+				const size_t kk = std::min (k, n - c);
+				const size_t found = gaussStrip (A, r, c, kk, pc.data ());
+
+				if (found == 0)
+					continue;
+
+				for (size_t l = 0; l < found; ++l)
+					pivots.push_back (pc[l]);
+
+				// T[g] = - sum_l g_l A_{r+l}, g_l the base P digits of g
+				const size_t w0 = c / 64, width = units - w0;
+				size_t entries = 1;
+				std::vector<size_t> power (found);
+				for (size_t l = 0; l < found; ++l) {
+					power[l] = entries;
+					entries *= P;
+				}
+
+				negPivot.resize (found * width);
+				for (size_t l = 0; l < found; ++l) {
+					const Unit *y = A.row (r + l) + w0;
+					for (size_t u = 0; u < width; ++u)
+						Arith::neg (negPivot[l * width + u], y[u]);
+				}
+
+				T.resize (entries * width);
+				std::fill (T.begin (), T.begin () + width, Arith::zero ());
+				for (size_t g = 1; g < entries; ++g) {
+					size_t l = 0;
+					while ((g / power[l]) % P == 0)
+						++l;
+
+					Unit *t = &T[g * width];
+					const Unit *s = &T[(g - power[l]) * width];
+					const Unit *y = &negPivot[l * width];
+					for (size_t u = 0; u < width; ++u)
+						Arith::add (t[u], s[u], y[u]);
+				}
+
+				// Rows to clear: below the strip pivots, and above if reduced
+				const size_t first = reduced ? 0 : r + found;
+				for (size_t i = first; i < m; ++i) {
+					index[i] = 0;
+					if (i >= r && i < r + found)
+						continue;
+					for (size_t l = 0; l < found; ++l)
+						index[i] += power[l] * A.getEntry (i, pc[l]);
+				}
+
+				const size_t stripe = std::max<size_t> (1, (size_t (1) << 12) / entries);
+				for (size_t s0 = 0; s0 < width; s0 += stripe) {
+					const size_t s1 = std::min (width, s0 + stripe);
+
+					for (size_t i = first; i < m; ++i) {
+						if (index[i] == 0)
+							continue;
+
+						Unit *x = A.row (i) + w0;
+						const Unit *t = &T[index[i] * width];
+						for (size_t u = s0; u < s1; ++u)
+							Arith::add (x[u], x[u], t[u]);
+					}
+				}
+
+				r += found;
+			}
+
+			return r;
+		}
+
+		/// Rank, A is modified
+		static size_t rankInPlace (Matrix &A)
+		{
+			std::vector<size_t> pivots;
+			return rowEchelonize (A, pivots);
+		}
+
+		/// Copy of a dense matrix over a representation of GF(P)
+		template <class Field, class DenseMatrix>
+		static Matrix &copy (Matrix &S, const Field &F, const DenseMatrix &A)
+		{
+			linbox_check (S.rowdim () == A.rowdim () && S.coldim () == A.coldim ());
+			S.zero ();
+
+			typename Field::Element e;
+			for (size_t i = 0; i < A.rowdim (); ++i)
+				for (size_t j = 0; j < A.coldim (); ++j) {
+					const uint8_t a = SlicedModpSparse<P>::residue (F, A.getEntry (e, i, j));
+					if (a != 0)
+						S.setEntry (i, j, a);
+				}
+			return S;
+		}
+
+		/// Copy of a SlicedModpMatrix into a dense matrix over a representation of GF(P)
+		template <class Field, class DenseMatrix>
+		static DenseMatrix &copyBack (DenseMatrix &A, const Field &F, const Matrix &S)
+		{
+			linbox_check (S.rowdim () == A.rowdim () && S.coldim () == A.coldim ());
+
+			typename Field::Element e;
+			for (size_t i = 0; i < A.rowdim (); ++i)
+				for (size_t j = 0; j < A.coldim (); ++j)
+					A.setEntry (i, j, F.init (e, (int64_t) S.getEntry (i, j)));
+			return A;
+		}
+
+	protected:
+
+		/// Strip width k, about 3/4 log_P of the dimension, at most 4
+		static size_t stripWidth (size_t d)
+		{
+			size_t l = 0;
+			while (d >= P) {
+				d /= P;
+				++l;
+			}
+			return std::max<size_t> (1, std::min<size_t> (4, (3 * l) / 4));
+		}
+
+		/// x <- x - a y on the units from u0 on
+		static void axmyin (Unit *x, size_t a, const Unit *y, size_t u0, size_t u1)
+		{
+			const size_t b = P - a;
+			for (size_t u = u0; u < u1; ++u)
+				Arith::axpyin (x[u], b, y[u]);
+		}
+
+		/** Pivots of columns c, ..., c + k - 1 among rows r, r + 1, ...
+		 * The pivot rows are moved to rows r, r + 1, ..., made unit and
+		 * reduced with respect to each other on the strip; candidate rows
+		 * are reduced lazily by the pivots already found.
+		 * @return the number of pivots found
+		 */
+		static size_t gaussStrip (Matrix &A, size_t r, size_t c, size_t k, size_t *pc)
+		{
+			const size_t m = A.rowdim (), u0 = c / 64, u1 = A.units ();
+			size_t found = 0;
+
+			for (size_t j = c; j < c + k && r + found < m; ++j) {
+				for (size_t p = r + found; p < m; ++p) {
+					Unit *x = A.row (p);
+
+					for (size_t l = 0; l < found; ++l) {
+						const size_t a = A.getEntry (p, pc[l]);
+						if (a != 0)
+							axmyin (x, a, A.row (r + l), u0, u1);
+					}
+
+					const size_t a = A.getEntry (p, j);
+					if (a == 0)
+						continue;
+
+					A.swapRows (p, r + found);
+
+					Unit *y = A.row (r + found);
+					if (a != 1) {
+						const size_t b = Arith::inv (a);
+						for (size_t u = u0; u < u1; ++u)
+							Arith::mul (y[u], b, y[u]);
+					}
+
+					for (size_t l = 0; l < found; ++l) {
+						const size_t e = A.getEntry (r + l, j);
+						if (e != 0)
+							axmyin (A.row (r + l), e, y, u0, u1);
+					}
+
+					pc[found++] = j;
+					break;
+				}
+			}
+
+			return found;
+		}
+	};
+
+	/// Whether the dense solutions over F switch to @ref SlicedModpElimination
+	template <class Field>
+	inline bool useSlicedModp (const Field &F, size_t m, size_t n)
+	{
+		integer p, q;
+		F.characteristic (p); F.cardinality (q);
+		return (p == q) && (p >= 5) && (p < 16) && (std::min (m, n) >= LINBOX_SLICED_MODP_THRESHOLD);
+	}
+
+	/// Rank of a dense matrix over a representation of GF(P)
+	template <size_t P, class Field, class DenseMatrix>
+	inline size_t slicedRankModp (const Field &F, const DenseMatrix &A)
+	{
+		typedef SlicedModpElimination<P> Elim;
+		typename Elim::Matrix S (A.rowdim (), A.coldim ());
+		Elim::copy (S, F, A);
+		return Elim::rankInPlace (S);
+	}
+
+	/// Rank of a dense matrix over a representation of GF(p), 5 <= p < 16
+	template <class Field, class DenseMatrix>
+	inline size_t slicedRankModp (const Field &F, const DenseMatrix &A)
+	{
+		integer p;
+		F.characteristic (p);
+
+		if (p == 5) return slicedRankModp<5> (F, A);
+		if (p == 7) return slicedRankModp<7> (F, A);
+		if (p == 11) return slicedRankModp<11> (F, A);
+		if (p == 13) return slicedRankModp<13> (F, A);
+
+		throw LinBoxError ("slicedRankModp: the characteristic must be a prime less than 16");
+	}
+
+} // namespace LinBox
+
+#endif // __LINBOX_matrix_sliced_modp_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -32,6 +32,7 @@
 
 #include "linbox/matrix/sliced3/dense-sliced.h"
 #include "linbox/matrix/sliced3/sliced-domain.h"
+#include "linbox/matrix/sliced3/sliced-elimination.h"
 
 #endif // __LINBOX_matrix_sliced3_H
 
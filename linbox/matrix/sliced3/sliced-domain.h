@@ -2,7 +2,9 @@
 #define __SLICED_DOMAIN_H
 
 #include "dense-sliced.h"
+#include "sliced-elimination.h"
 #include "linbox/matrix/matrix-domain.h"
+#include <givaro/modular.h>
 
 /*
 The SlicedDomain template over a Field type parameter has constructor from an instance of Field which must represent GF(3).
@@ -102,6 +104,29 @@ public:
 		return C.mul(A,B);
 	}
 
+	//  return C <-- A * B, by Four Russians tables when the
+	//  matrices are aligned on units (see SlicedElimination)
+	Matrix & mul (Matrix& C, Matrix& A, Matrix& B){
+		if (A.l() || A.r() || B.l() || B.r() || C.l() || C.r())
+			return C.mul(A,B);
+		return SlicedElimination<MatrixDomain>::mul(C, A, B);
+	}
+
+	//  row echelon form of A in place, unit pivots, returns the rank
+	size_t rowEchelonize (Matrix& A, std::vector<size_t>& pivots) {
+		return SlicedElimination<MatrixDomain>::rowEchelonize(A, pivots);
+	}
+
+	//  rank of A, A is modified
+	size_t rankInPlace (Matrix& A) {
+		return SlicedElimination<MatrixDomain>::rankInPlace(A);
+	}
+
+	//  P A Q = L U, see SlicedElimination::pluq
+	size_t pluq (Matrix& A, Matrix& L, std::vector<size_t>& P, std::vector<size_t>& Q) {
+		return SlicedElimination<MatrixDomain>::pluq(A, L, P, Q);
+	}
+
 	// A += x*B
 	Matrix& axpyin( Matrix& A, Scalar& x, Matrix &B) {
 		typename Matrix::RawIterator Ab(A.rawBegin()), Ae(A.rawEnd()), Bb(B.rawBegin());
@@ -162,6 +187,42 @@ public:
 	}
 };
 
+/// Sliced matrices used by the dense solutions over GF(3)
+typedef MatrixDomain<SlicedField<Givaro::Modular<int64_t>, uint64_t> > SlicedGF3Domain;
+
+/// Whether a dense m x n problem over F is worth the bit-sliced elimination
+template <class Field>
+inline bool useSlicedGF3 (const Field& F, size_t m, size_t n)
+{
+	integer p, q;
+	F.characteristic(p); F.cardinality(q);
+	return (p == 3) && (q == 3) && (std::min(m, n) >= LINBOX_SLICED_GF3_THRESHOLD);
+}
+
+/// Rank of a dense matrix over a representation of GF(3)
+template <class Field, class DenseMatrix>
+inline size_t slicedRankGF3 (const Field& F, const DenseMatrix& A)
+{
+	typedef SlicedElimination<SlicedGF3Domain> Elim;
+	typename Elim::Matrix S(SlicedGF3Domain(), A.rowdim(), A.coldim());
+	Elim::copy(S, F, A);
+	return Elim::rankInPlace(S);
+}
+
+/// Row echelon form of a dense matrix over a representation of GF(3),
+/// in place, with unit pivots
+template <class Field, class DenseMatrix>
+inline size_t slicedRowEchelonizeGF3 (const Field& F, DenseMatrix& A)
+{
+	typedef SlicedElimination<SlicedGF3Domain> Elim;
+	typename Elim::Matrix S(SlicedGF3Domain(), A.rowdim(), A.coldim());
+	Elim::copy(S, F, A);
+	std::vector<size_t> pivots;
+	const size_t r = Elim::rowEchelonize(S, pivots);
+	Elim::copyBack(A, F, S);
+	return r;
+}
+
 }
 	
 #endif // __SLICED_DOMAIN_H
@@ -0,0 +1,496 @@
+/* linbox/matrix/sliced3/sliced-elimination.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file matrix/sliced3/sliced-elimination.h
+ * @ingroup matrix
+ * @brief Four-Russians multiplication and elimination on bit-sliced GF(3) matrices
+ */
+
+#ifndef __LINBOX_matrix_sliced3_sliced_elimination_H
+#define __LINBOX_matrix_sliced3_sliced_elimination_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "linbox/integer.h"
+#include "linbox/util/debug.h"
+#include "linbox/util/error.h"
+#include "dense-sliced.h"
+
+#ifndef LINBOX_SLICED_GF3_THRESHOLD
+/// Smallest dimension for which the dense solutions over GF(3) switch to
+/// the bit-sliced elimination
+#define LINBOX_SLICED_GF3_THRESHOLD 128
+#endif
+
+namespace LinBox {
+
+/** \brief Multiplication and elimination on row packed @ref Sliced matrices
+ *
+ * A unit of a row holds \f$B\f$ = <code>8*sizeof(Word)</code> entries in
+ * two words: b0 is set for nonzero entries and b1 for entries equal to
+ * 2, so that a row addition costs a handful of word operations per unit.
+ *
+ * Both products and elimination use the Method of Four Russians: the
+ * \f$3^k\f$ combinations of \f$k\f$ rows are tabulated, one row addition
+ * per entry, and each row of the other operand then needs a single
+ * addition per strip of \f$k\f$ columns. The index of a row in a table is
+ * read directly from the two bit planes: for an entry pattern (p0, p1) of
+ * the planes on the strip, the ternary index is tern[p0] + tern[p1]. The
+ * tables are applied by stripes of units that fit in cache.
+ *
+ * Matrices must be row packed, and submatrices aligned on units.
+ */
+template <class _Domain>
+class SlicedElimination {
+public:
+	typedef _Domain                         Domain;
+	typedef Sliced<Domain>                  Matrix;
+	typedef typename Domain::Word_T         Word;
+	typedef SlicedBase<Word>                Unit;
+
+	static const size_t bits = 8 * sizeof (Word);
+
+	/// C <- A B. C must have the dimensions of the product and must not
+	/// be A or B.
+	static Matrix &mul (Matrix &C, Matrix &A, Matrix &B)
+	{
+		linbox_check (A.coldim () == B.rowdim ());
+		linbox_check (C.rowdim () == A.rowdim () && C.coldim () == B.coldim ());
+		checkAligned (A); checkAligned (B); checkAligned (C);
+
+		const size_t m = A.rowdim (), K = A.coldim ();
+		const size_t W = units (C);
+
+		C.zero ();
+		if (m == 0 || K == 0 || W == 0)
+			return C;
+
+		const size_t k = stripWidth (m, 8);
+		std::vector<size_t> tern;
+		ternary (tern, k);
+
+		std::vector<Unit> T;
+		std::vector<uint32_t> index (m);
+
+		for (size_t c = 0; c < K; c += k) {
+			const size_t kk = std::min (k, K - c);
+			const size_t entries = power3 (kk);
+
+			for (size_t i = 0; i < m; ++i)
+				index[i] = pattern (row (A, i), c, kk, tern);
+
+			// Stripes of C whose table stays in cache
+			const size_t stripe = std::max<size_t> (1, (size_t (1) << 14) / entries);
+			for (size_t u0 = 0; u0 < W; u0 += stripe) {
+				const size_t width = std::min (W, u0 + stripe) - u0;
+
+				T.resize (entries * width);
+				std::fill (T.begin (), T.begin () + (ptrdiff_t) width, zeroUnit ());
+				for (size_t l = 0, p = 1; l < kk; ++l, p *= 3) {
+					const Unit *b = row (B, c + l) + u0;
+					for (size_t t = 0; t < p; ++t) {
+						assignRow (&T[(t + p) * width], &T[t * width], width);
+						addin (&T[(t + p) * width], b, width);
+						assignRow (&T[(t + 2 * p) * width], &T[(t + p) * width], width);
+						addin (&T[(t + 2 * p) * width], b, width);
+					}
+				}
+
+				for (size_t i = 0; i < m; ++i)
+					if (index[i] != 0)
+						addin (row (C, i) + u0, &T[index[i] * width], width);
+			}
+		}
+
+		return C;
+	}
+
+	/** Row echelon form, in place.
+	 * The pivots are ones; entries above the pivots are not reduced.
+	 * @param pivots on return, the pivot column of each nonzero row
+	 * @return the rank
+	 */
+	static size_t rowEchelonize (Matrix &A, std::vector<size_t> &pivots)
+	{
+		return echelonize (A, pivots, (std::vector<size_t> *) 0, (Matrix *) 0);
+	}
+
+	/// Rank, A is modified
+	static size_t rankInPlace (Matrix &A)
+	{
+		std::vector<size_t> pivots;
+		return rowEchelonize (A, pivots);
+	}
+
+	/** PLUQ decomposition: \f$PAQ = LU\f$.
+	 *
+	 * On return, the first \f$r\f$ rows of A are the rows of U in
+	 * echelon form with unit pivots, before the column permutation: U
+	 * is the first \f$r\f$ rows of A times Q; the other rows are zero.
+	 * L is \f$m\times r\f$ lower trapezoidal, its diagonal entries are
+	 * the original pivots (1 or 2).
+	 *
+	 * @param L \f$m\times\min(m,n)\f$ matrix receiving L in its first r columns
+	 * @param P P[i] is the row of the input moved to row i
+	 * @param Q Q[j] is the column of A in column j of AQ: the pivot
+	 *        columns first, in increasing order, then the others
+	 * @return the rank r
+	 */
+	static size_t pluq (Matrix &A, Matrix &L, std::vector<size_t> &P, std::vector<size_t> &Q)
+	{
+		linbox_check (L.rowdim () == A.rowdim ());
+		linbox_check (L.coldim () >= std::min (A.rowdim (), A.coldim ()));
+		checkAligned (L);
+
+		std::vector<size_t> pivots;
+		L.zero ();
+		const size_t r = echelonize (A, pivots, &P, &L);
+
+		std::vector<bool> isPivot (A.coldim (), false);
+		Q.assign (pivots.begin (), pivots.end ());
+		for (size_t i = 0; i < r; ++i)
+			isPivot[pivots[i]] = true;
+		for (size_t j = 0; j < A.coldim (); ++j)
+			if (!isPivot[j])
+				Q.push_back (j);
+
+		return r;
+	}
+
+	/// Copy of a dense matrix over a representation of GF(3)
+	template <class Field, class DenseMatrix>
+	static Matrix &copy (Matrix &S, const Field &F, const DenseMatrix &A)
+	{
+		linbox_check (S.rowdim () == A.rowdim () && S.coldim () == A.coldim ());
+		S.zero ();
+
+		typename Field::Element e;
+		integer v;
+		for (size_t i = 0; i < A.rowdim (); ++i)
+			for (size_t j = 0; j < A.coldim (); ++j) {
+				// reduced residues, possibly balanced
+				F.convert (v, A.getEntry (e, i, j));
+				if (v == 1 || v == -2)
+					S.setEntry (i, j, typename Matrix::Scalar (1));
+				else if (v == 2 || v == -1)
+					S.setEntry (i, j, typename Matrix::Scalar (2));
+			}
+		return S;
+	}
+
+	/// Copy of a Sliced matrix into a dense matrix over a representation of GF(3)
+	template <class Field, class DenseMatrix>
+	static DenseMatrix &copyBack (DenseMatrix &A, const Field &F, Matrix &S)
+	{
+		linbox_check (S.rowdim () == A.rowdim () && S.coldim () == A.coldim ());
+
+		typename Field::Element e;
+		for (size_t i = 0; i < A.rowdim (); ++i)
+			for (size_t j = 0; j < A.coldim (); ++j)
+				A.setEntry (i, j, F.init (e, (int64_t) value (row (S, i), j)));
+		return A;
+	}
+
+protected:
+
+	static void checkAligned (Matrix &A)
+	{
+		if (A.l () != 0 || A.r () != 0)
+			throw LinBoxError ("SlicedElimination: submatrices must be aligned on units");
+	}
+
+	static size_t units (const Matrix &A) { return (A.coldim () + bits - 1) / bits; }
+
+	static Unit *row (Matrix &A, size_t i) { return A._rep + i * A._stride; }
+
+	static Unit zeroUnit () { Unit u; u.b0 = 0; u.b1 = 0; return u; }
+
+	static size_t power3 (size_t k)
+	{
+		size_t p = 1;
+		while (k--)
+			p *= 3;
+		return p;
+	}
+
+	/// Strip width: \f$3^k\f$ about the 3/4 power of the dimension d
+	static size_t stripWidth (size_t d, size_t kmax)
+	{
+		size_t l = 0;
+		for (size_t p = 3; p <= d; p *= 3)
+			++l;
+		return std::max<size_t> (1, std::min (kmax, (3 * l) / 4));
+	}
+
+	/// tern[p] is the sum of \f$3^l\f$ over the bits l of p
+	static void ternary (std::vector<size_t> &tern, size_t k)
+	{
+		tern.assign (size_t (1) << k, 0);
+		for (size_t l = 0, p = 1; l < k; ++l, p *= 3)
+			for (size_t b = 0; b < (size_t (1) << l); ++b)
+				tern[(size_t (1) << l) + b] = tern[b] + p;
+	}
+
+	/// Bits c, ..., c + k - 1 of a word plane
+	static Word planeBits (Word lo, Word hi, size_t off, size_t k)
+	{
+		Word v = lo >> off;
+		if (off + k > bits)
+			v |= hi << (bits - off);
+		return k == bits ? v : (v & ((Word (1) << k) - 1));
+	}
+
+	/// Ternary index of entries c, ..., c + k - 1 of a row (k < bits)
+	static uint32_t pattern (const Unit *x, size_t c, size_t k, const std::vector<size_t> &tern)
+	{
+		const size_t w = c / bits, off = c % bits;
+		const bool two = (off + k > bits);
+		const Word p0 = planeBits (x[w].b0, two ? x[w + 1].b0 : Word (0), off, k);
+		const Word p1 = planeBits (x[w].b1, two ? x[w + 1].b1 : Word (0), off, k);
+		return uint32_t (tern[(size_t) p0] + tern[(size_t) p1]);
+	}
+
+	static unsigned value (const Unit *x, size_t j)
+	{
+		const Unit &u = x[j / bits];
+		return unsigned ((u.b0 >> (j % bits)) & 1) + unsigned ((u.b1 >> (j % bits)) & 1);
+	}
+
+	static void assignRow (Unit *x, const Unit *y, size_t n)
+	{
+		std::copy (y, y + n, x);
+	}
+
+	/// x <- x + y
+	static void addin (Unit *x, const Unit *y, size_t n)
+	{
+		for (size_t u = 0; u < n; ++u) {
+			const Word a = x[u].b0 ^ y[u].b1;
+			const Word b = x[u].b1 ^ y[u].b0;
+			const Word s = a ^ x[u].b1;
+			const Word t = b ^ y[u].b1;
+			x[u].b1 = a & b;
+			x[u].b0 = s | t;
+		}
+	}
+
+	/// x <- x - y
+	static void subin (Unit *x, const Unit *y, size_t n)
+	{
+		for (size_t u = 0; u < n; ++u) {
+			const Word y1 = y[u].b1 ^ y[u].b0;
+			const Word a = x[u].b0 ^ y1;
+			const Word b = x[u].b1 ^ y[u].b0;
+			const Word s = a ^ x[u].b1;
+			const Word t = b ^ y1;
+			x[u].b1 = a & b;
+			x[u].b0 = s | t;
+		}
+	}
+
+	/// x <- -x
+	static void negin (Unit *x, size_t n)
+	{
+		for (size_t u = 0; u < n; ++u)
+			x[u].b1 ^= x[u].b0;
+	}
+
+	/// x <- x + a y, a in {1, 2}
+	static void axpyin (Unit *x, unsigned a, const Unit *y, size_t n)
+	{
+		if (a == 1)
+			addin (x, y, n);
+		else
+			subin (x, y, n);
+	}
+
+	static void swapRows (Matrix &A, size_t i, size_t j)
+	{
+		if (i != j)
+			std::swap_ranges (row (A, i), row (A, i) + units (A), row (A, j));
+	}
+
+	static void addEntry (Matrix &L, size_t i, size_t j, unsigned a)
+	{
+		const unsigned v = (value (row (L, i), j) + a) % 3;
+		L.setEntry (i, j, typename Matrix::Scalar (v));
+	}
+
+	/** Non reduced echelon form by strips.
+	 * Rows at or below the current rank only have entries in the
+	 * columns at or after the current strip. L, if given, accumulates
+	 * the multipliers: row i of the input, after the row permutation,
+	 * is the sum of L(i, l) times the l-th final pivot row.
+	 */
+	static size_t echelonize (Matrix &A, std::vector<size_t> &pivots, std::vector<size_t> *P, Matrix *L)
+	{
+		checkAligned (A);
+
+		const size_t m = A.rowdim (), n = A.coldim ();
+		const size_t W = units (A);
+
+		pivots.clear ();
+		if (P != 0) {
+			P->resize (m);
+			for (size_t i = 0; i < m; ++i)
+				(*P)[i] = i;
+		}
+
+		const size_t k = stripWidth (std::min (m, n), 6);
+		std::vector<size_t> tern;
+		ternary (tern, k);
+
+		std::vector<size_t> pc (k);
+		std::vector<Unit> T;
+		std::vector<int32_t> slot;
+		std::vector<uint32_t> index (m);
+
+		size_t r = 0;
+		for (size_t c = 0; c < n && r < m; c += k) {
+			const size_t kk = std::min (k, n - c);
+			const size_t found = gaussStrip (A, r, c, kk, pc.data (), P, L);
+
+			if (found == 0)
+				continue;
+
+			for (size_t l = 0; l < found; ++l)
+				pivots.push_back (pc[l]);
+
+			// Combinations of the strip pivot rows; a combination is
+			// found back from its entries on the strip, since the pivot
+			// rows restricted to their pivot columns are unit triangular
+			const size_t w0 = c / bits, width = W - w0;
+			const size_t combos = power3 (found);
+
+			T.resize (combos * width);
+			std::fill (T.begin (), T.begin () + (ptrdiff_t) width, zeroUnit ());
+			for (size_t l = 0, p = 1; l < found; ++l, p *= 3) {
+				const Unit *e = row (A, r + l) + w0;
+				for (size_t t = 0; t < p; ++t) {
+					assignRow (&T[(t + p) * width], &T[t * width], width);
+					addin (&T[(t + p) * width], e, width);
+					assignRow (&T[(t + 2 * p) * width], &T[(t + p) * width], width);
+					addin (&T[(t + 2 * p) * width], e, width);
+				}
+			}
+
+			slot.assign (power3 (kk), -1);
+			for (size_t t = 0; t < combos; ++t)
+				slot[pattern (&T[t * width], c - w0 * bits, kk, tern)] = int32_t (t);
+
+			for (size_t i = r + found; i < m; ++i) {
+				const int32_t t = slot[pattern (row (A, i), c, kk, tern)];
+				linbox_check (t >= 0);
+				index[i] = uint32_t (t);
+
+				if (L != 0)
+					for (size_t l = 0, d = (size_t) t; d != 0; ++l, d /= 3)
+						if (d % 3)
+							addEntry (*L, i, r + l, unsigned (d % 3));
+			}
+
+			const size_t stripe = std::max<size_t> (1, (size_t (1) << 14) / combos);
+			for (size_t s0 = 0; s0 < width; s0 += stripe) {
+				const size_t s1 = std::min (width, s0 + stripe);
+
+				for (size_t i = r + found; i < m; ++i)
+					if (index[i] != 0)
+						subin (row (A, i) + w0 + s0, &T[index[i] * width + s0], s1 - s0);
+			}
+
+			r += found;
+		}
+
+		return r;
+	}
+
+	/** Pivots of columns c, ..., c + k - 1 among rows r, r + 1, ...
+	 * A pivot row is reduced by the pivots found before it on the
+	 * strip, then scaled to a unit pivot; candidate rows are reduced
+	 * lazily.
+	 * @return the number of pivots found
+	 */
+	static size_t gaussStrip (Matrix &A, size_t r, size_t c, size_t k, size_t *pc,
+				  std::vector<size_t> *P, Matrix *L)
+	{
+		const size_t m = A.rowdim ();
+		const size_t w0 = c / bits, width = units (A) - w0;
+		size_t found = 0;
+
+		for (size_t j = c; j < c + k && r + found < m; ++j) {
+			for (size_t p = r + found; p < m; ++p) {
+				Unit *x = row (A, p);
+
+				for (size_t l = 0; l < found; ++l) {
+					const unsigned a = value (x, pc[l]);
+					if (a != 0) {
+						// x - a e = x + (3 - a) e
+						axpyin (x + w0, 3 - a, row (A, r + l) + w0, width);
+						if (L != 0)
+							addEntry (*L, p, r + l, a);
+					}
+				}
+
+				const unsigned v = value (x, j);
+				if (v == 0)
+					continue;
+
+				const size_t q = r + found;
+				swapRows (A, p, q);
+				if (L != 0)
+					swapRows (*L, p, q);
+				if (P != 0)
+					std::swap ((*P)[p], (*P)[q]);
+
+				// Unit pivot: the input row is v times the pivot row
+				if (v == 2)
+					negin (row (A, q) + w0, width);
+				if (L != 0)
+					addEntry (*L, q, q, v);
+
+				pc[found++] = j;
+				break;
+			}
+		}
+
+		return found;
+	}
+};
+
+template <class _Domain> const size_t SlicedElimination<_Domain>::bits;
+
+} // namespace LinBox
+
+#endif // __LINBOX_matrix_sliced3_sliced_elimination_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
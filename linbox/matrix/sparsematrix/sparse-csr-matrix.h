@@ -984,6 +984,17 @@ namespace LinBox {
 			return _start ;
 		}
 
+		//! Row starts, without copy (the matrix must be resized before writing to them).
+		const svector_t & refStart( ) const
+		{
+			return _start ;
+		}
+
+		svector_t & refStart( )
+		{
+			return _start ;
+		}
+
 		size_t rowLength(const size_t & i)
 		{
 			return getEnd(i) - getStart(i) ;
@@ -1023,6 +1034,17 @@ namespace LinBox {
 			return _colid ;
 		}
 
+		//! Column indices, without copy.
+		const svector_t & refColid( ) const
+		{
+			return _colid ;
+		}
+
+		svector_t & refColid( )
+		{
+			return _colid ;
+		}
+
 		const Element & getData(const size_t & i) const
 		{
 			return _data[i];
@@ -1045,6 +1067,17 @@ namespace LinBox {
 			return _data ;
 		}
 
+		//! Values, without copy.
+		const std::vector<Element> & refData( ) const
+		{
+			return _data ;
+		}
+
+		std::vector<Element> & refData( )
+		{
+			return _data ;
+		}
+
 		void firstTriple() const
 		{
 			_triples.reset();
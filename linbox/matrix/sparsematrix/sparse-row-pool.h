@@ -0,0 +1,157 @@
+/* linbox/matrix/sparsematrix/sparse-row-pool.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file matrix/sparsematrix/sparse-row-pool.h
+ * @ingroup sparsematrix
+ * @brief Recycling of the buffers of sparse rows during elimination
+ */
+
+#ifndef __LINBOX_matrix_sparsematrix_sparse_row_pool_H
+#define __LINBOX_matrix_sparsematrix_sparse_row_pool_H
+
+#include <cstddef>
+#include <vector>
+
+//! Number of free buffers kept in each size class of a SparseRowPool
+#ifndef LINBOX_ROW_POOL_DEPTH
+#define LINBOX_ROW_POOL_DEPTH 32
+#endif
+
+namespace LinBox
+{
+
+	/** \brief Free buffers of sparse rows, by size class
+	 *
+	 * An elimination step builds the new row in a separate buffer and
+	 * swaps it in, and the rows of the pivots are emptied once used. With
+	 * plain vectors each step allocates a buffer and frees one. The pool
+	 * keeps the freed buffers instead: class \f$c\f$ holds the buffers of
+	 * capacity in \f$[2^c, 2^{c+1})\f$, at most \p depth of them, and a
+	 * buffer of capacity at least \f$n\f$ is taken from the classes of
+	 * \f$n\f$ and the two above before calling the allocator.
+	 *
+	 * The \p Vector is a std::vector of (index, value) pairs such as the
+	 * rows of SparseMatrix<Field, SparseMatrixFormat::SparseSeq>, which
+	 * keep their type: only their buffers move. One pool per thread is
+	 * given by @ref local(), so that parallel eliminations do not share
+	 * it; @ref compact() returns its buffers to the allocator.
+	 */
+	template <class Vector>
+	class SparseRowPool {
+	public:
+
+		static const size_t classes = 8 * sizeof (size_t);
+
+		SparseRowPool (size_t depth = LINBOX_ROW_POOL_DEPTH) :
+			_depth (depth), _free (classes)
+		{}
+
+		/// The pool of the calling thread
+		static SparseRowPool &local ()
+		{
+			static thread_local SparseRowPool pool;
+			return pool;
+		}
+
+		/** \p v is resized to \p n, in a recycled buffer if its own is too small.
+		 * The previous buffer of \p v goes back to the pool.
+		 */
+		Vector &acquire (Vector &v, size_t n)
+		{
+			if (v.capacity () < n) {
+				release (v);
+				const size_t c = sizeClass (n);
+				for (size_t d = c; d < classes && d <= c + 2; ++d) {
+					std::vector<Vector> &F = _free[d];
+					if (!F.empty () && F.back ().capacity () >= n) {
+						v.swap (F.back ());
+						F.pop_back ();
+						break;
+					}
+				}
+			}
+			v.clear ();
+			v.resize (n);
+			return v;
+		}
+
+		/// The buffer of \p v goes back to the pool; \p v is left empty, without buffer
+		void release (Vector &v)
+		{
+			if (v.capacity () == 0)
+				return;
+			v.clear ();
+			std::vector<Vector> &F = _free[sizeClass (v.capacity ())];
+			if (F.size () < _depth) {
+				F.emplace_back ();
+				F.back ().swap (v);
+			}
+			else
+				Vector ().swap (v);
+		}
+
+		/// Frees all the buffers held
+		void compact ()
+		{
+			for (size_t c = 0; c < classes; ++c)
+				std::vector<Vector> ().swap (_free[c]);
+		}
+
+		/// Number of buffers held
+		size_t buffers () const
+		{
+			size_t s = 0;
+			for (size_t c = 0; c < classes; ++c)
+				s += _free[c].size ();
+			return s;
+		}
+
+	protected:
+
+		/// floor(log2(n)) for n > 0
+		static size_t sizeClass (size_t n)
+		{
+			size_t c = 0;
+			while (n >>= 1)
+				++c;
+			return c;
+		}
+
+		size_t                            _depth;
+		std::vector<std::vector<Vector> > _free;
+	};
+
+	template <class Vector> const size_t SparseRowPool<Vector>::classes;
+
+} // LinBox
+
+#endif // __LINBOX_matrix_sparsematrix_sparse_row_pool_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,469 @@
+/* linbox/randiter/prime-pool.h
+ * Copyright (C) 2026 The LinBox group
+ *
+ * --------------------------------------------
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file randiter/prime-pool.h
+ * @ingroup randiter
+ * @brief Shared cache of word-size primes with precomputed reduction constants
+ */
+
+#ifndef __LINBOX_randiter_prime_pool_H
+#define __LINBOX_randiter_prime_pool_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "linbox/integer.h"
+#include "linbox/util/error.h"
+#include "linbox/util/timer.h"
+#include "linbox/randiter/random-prime.h"
+
+//! Number of candidates sieved at once when the pool is extended
+#ifndef LINBOX_PRIME_POOL_WINDOW
+#define LINBOX_PRIME_POOL_WINDOW (size_t(1) << 14)
+#endif
+
+//! A PrimeIterator<PoolTag> first draws its primes among the first LINBOX_PRIME_POOL_SPREAD of the pool
+#ifndef LINBOX_PRIME_POOL_SPREAD
+#define LINBOX_PRIME_POOL_SPREAD 1024
+#endif
+
+namespace LinBox
+{
+
+	/** \brief A prime of the pool and its reduction constants
+	 *
+	 * All the constants are computed once, when the prime enters the pool.
+	 */
+	struct PoolPrime {
+		uint64_t p;          //!< the prime
+		double   invp;       //!< 1/p, for reductions through floating point quotients
+		uint64_t montInv;    //!< \f$-p^{-1} \bmod 2^{64}\f$, for Montgomery reduction
+		uint64_t montR2;     //!< \f$2^{128} \bmod p\f$, to enter the Montgomery form
+		size_t   twoAdicity; //!< largest k such that \f$2^k\f$ divides p-1
+		uint64_t root;       //!< primitive \f$2^k\f$-th root of unity, k the two-adicity
+	};
+
+	namespace Protected
+	{
+		inline uint64_t mulmod64 (uint64_t a, uint64_t b, uint64_t p)
+		{
+			return uint64_t ((unsigned __int128) a * b % p);
+		}
+
+		inline uint64_t powmod64 (uint64_t a, uint64_t e, uint64_t p)
+		{
+			uint64_t r = 1 % p;
+			a %= p;
+			for (; e; e >>= 1) {
+				if (e & 1)
+					r = mulmod64 (r, a, p);
+				a = mulmod64 (a, a, p);
+			}
+			return r;
+		}
+
+		/// Deterministic Miller-Rabin for n < 2^64
+		inline bool isPrime64 (uint64_t n)
+		{
+			if (n < 2)
+				return false;
+			static const uint64_t small[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+			for (uint64_t q : small) {
+				if (n % q == 0)
+					return n == q;
+			}
+			uint64_t d = n - 1;
+			size_t s = 0;
+			while (!(d & 1)) {
+				d >>= 1;
+				++s;
+			}
+			for (uint64_t a : small) {
+				uint64_t x = powmod64 (a, d, n);
+				if (x == 1 || x == n - 1)
+					continue;
+				size_t r = 1;
+				for (; r < s; ++r) {
+					x = mulmod64 (x, x, n);
+					if (x == n - 1)
+						break;
+				}
+				if (r == s)
+					return false;
+			}
+			return true;
+		}
+
+		/// Inverse of a modulo p, 0 if a is not invertible
+		inline uint64_t invmod64 (uint64_t a, uint64_t p)
+		{
+			int64_t u0 = 0, u1 = 1;
+			uint64_t r0 = p, r1 = a % p;
+			while (r1 != 0) {
+				const uint64_t q = r0 / r1, r = r0 - q * r1;
+				const int64_t u = u0 - int64_t (q) * u1;
+				r0 = r1; r1 = r;
+				u0 = u1; u1 = u;
+			}
+			if (r0 != 1)
+				return 0;
+			return u0 < 0 ? uint64_t (u0 + int64_t (p)) : uint64_t (u0);
+		}
+	} // Protected
+
+	/** \brief Thread-safe cache of the primes of a given bit size
+	 *
+	 * The primes of \p bits bits are enumerated once, from the largest
+	 * one down, by sieving windows of LINBOX_PRIME_POOL_WINDOW candidates
+	 * with the small primes and checking the survivors with a
+	 * deterministic Miller-Rabin test; the FFT primes (\f$2^k\f$ dividing
+	 * p-1) have their own sequences. Each prime comes with its
+	 * @ref PoolPrime constants, and the pool keeps, for the i-th prime of
+	 * a sequence, the inverse modulo \f$p_i\f$ of \f$p_0 \cdots p_{i-1}\f$,
+	 * that is the constant of the i-th step of a Chinese remaindering
+	 * along the sequence.
+	 *
+	 * Entries are never moved once in the pool, so that the references
+	 * returned stay valid while other threads extend it. The primes are
+	 * smaller than \f$2^{63}\f$.
+	 */
+	class PrimePool {
+	public:
+
+		/// The pool shared by all the threads
+		static PrimePool &shared ()
+		{
+			static PrimePool pool;
+			return pool;
+		}
+
+		/// The i-th largest prime of \p bits bits
+		const PoolPrime &prime (size_t bits, size_t i)
+		{
+			std::lock_guard<std::mutex> lock (_mutex);
+			return fetch (bits, 0, i);
+		}
+
+		/// The i-th largest prime p of \p bits bits with \f$2^k\f$ dividing p-1
+		const PoolPrime &fftPrime (size_t bits, size_t k, size_t i)
+		{
+			std::lock_guard<std::mutex> lock (_mutex);
+			return fetch (bits, k, i);
+		}
+
+		/** Inverse of \f$p_0 \cdots p_{i-1}\f$ modulo \f$p_i\f$, the
+		 * primes of the sequence of prime() (or of fftPrime() for k > 0);
+		 * 1 for i = 0.
+		 */
+		uint64_t crtInverse (size_t bits, size_t i, size_t k = 0)
+		{
+			std::lock_guard<std::mutex> lock (_mutex);
+			Sequence &S = sequence (bits, k);
+			fetch (bits, k, i);
+			while (S.crt.size () <= i) {
+				const size_t j = S.crt.size ();
+				const uint64_t p = S.primes[j].p;
+				uint64_t prod = 1 % p;
+				for (size_t l = 0; l < j; ++l)
+					prod = Protected::mulmod64 (prod, S.primes[l].p % p, p);
+				S.crt.push_back (Protected::invmod64 (prod, p));
+			}
+			return S.crt[i];
+		}
+
+		/// Inverse of \f$p_i\f$ modulo \f$p_j\f$, both primes of the sequence of prime()
+		uint64_t inverse (size_t bits, size_t i, size_t j)
+		{
+			std::lock_guard<std::mutex> lock (_mutex);
+			const uint64_t pi = fetch (bits, 0, i).p;
+			const uint64_t pj = fetch (bits, 0, j).p;
+			return Protected::invmod64 (pi, pj);
+		}
+
+		/// Number of primes of \p bits bits (with \f$2^k\f$ dividing p-1) in the pool
+		size_t cached (size_t bits, size_t k = 0)
+		{
+			std::lock_guard<std::mutex> lock (_mutex);
+			return sequence (bits, k).primes.size ();
+		}
+
+		/// The constants of a prime p
+		static PoolPrime constants (uint64_t p)
+		{
+			PoolPrime P;
+			P.p = p;
+			P.invp = 1.0 / double (p);
+
+			uint64_t inv = p; // p^{-1} mod 2^64, by Newton iteration
+			for (size_t i = 0; i < 6; ++i)
+				inv *= 2 - p * inv;
+			P.montInv = uint64_t (0) - inv;
+			const uint64_t r = uint64_t (((unsigned __int128) 1 << 64) % p);
+			P.montR2 = Protected::mulmod64 (r, r, p);
+
+			P.twoAdicity = 0;
+			while (!(((p - 1) >> P.twoAdicity) & 1))
+				++P.twoAdicity;
+			uint64_t g = 2;
+			while (Protected::powmod64 (g, (p - 1) / 2, p) != p - 1)
+				++g;
+			P.root = Protected::powmod64 (g, (p - 1) >> P.twoAdicity, p);
+			return P;
+		}
+
+	protected:
+
+		struct Sequence {
+			std::deque<PoolPrime> primes;
+			std::deque<uint64_t>  crt;
+			uint64_t              next;  //!< candidates below next remain to be checked
+		};
+
+		PrimePool ()
+		{
+			std::vector<char> composite (1024, 0);
+			for (uint64_t q = 3; q < composite.size (); q += 2)
+				if (!composite[q]) {
+					_small.push_back (q);
+					for (uint64_t m = q * q; m < composite.size (); m += 2 * q)
+						composite[m] = 1;
+				}
+		}
+
+		Sequence &sequence (size_t bits, size_t k)
+		{
+			if (bits < 3 || bits > 63)
+				throw LinBoxError ("PrimePool: the primes must have between 3 and 63 bits");
+			if (k >= bits - 1)
+				throw LinBoxError ("PrimePool: no FFT prime of that size");
+			auto it = _sequences.find (std::make_pair (bits, k));
+			if (it == _sequences.end ()) {
+				Sequence S;
+				S.next = uint64_t (1) << bits;
+				it = _sequences.emplace (std::make_pair (bits, k), std::move (S)).first;
+			}
+			return it->second;
+		}
+
+		const PoolPrime &fetch (size_t bits, size_t k, size_t i)
+		{
+			Sequence &S = sequence (bits, k);
+			while (S.primes.size () <= i)
+				extend (S, bits, k);
+			return S.primes[i];
+		}
+
+		/// Adds the primes of the next window of candidates
+		void extend (Sequence &S, size_t bits, size_t k)
+		{
+			const uint64_t low = uint64_t (1) << (bits - 1);
+			if (S.next <= low)
+				throw LinBoxError ("PrimePool: ran out of primes of that size");
+
+			if (k > 0) {
+				// candidates m 2^k + 1 below next, in decreasing order
+				const uint64_t step = uint64_t (1) << k;
+				uint64_t n = ((S.next - 2) >> k) * step + 1;
+				// k < bits-1, so that n - step does not wrap around
+				for (size_t c = 0; c < LINBOX_PRIME_POOL_WINDOW && n >= low; ++c, n -= step)
+					if (Protected::isPrime64 (n))
+						S.primes.push_back (constants (n));
+				S.next = (n >= low) ? n + 1 : low;
+				return;
+			}
+
+			const uint64_t hi = S.next;
+			const uint64_t lo = (hi - low > LINBOX_PRIME_POOL_WINDOW) ? hi - LINBOX_PRIME_POOL_WINDOW : low;
+			std::vector<char> composite (hi - lo, 0);
+			for (uint64_t q : _small) {
+				if (q * q >= hi)
+					break;
+				uint64_t m = ((lo + q - 1) / q) * q;
+				if (m < q * q)
+					m = q * q;
+				for (; m < hi; m += q)
+					composite[m - lo] = 1;
+			}
+			for (uint64_t n = hi - 1; n >= lo && n > 1; --n) {
+				if ((n & 1) && !composite[n - lo] && Protected::isPrime64 (n))
+					S.primes.push_back (constants (n));
+				if (n == lo)
+					break;
+			}
+			S.next = lo;
+		}
+
+		std::vector<uint64_t>                                 _small;
+		std::map<std::pair<size_t, size_t>, Sequence>         _sequences;
+		std::mutex                                            _mutex;
+	};
+
+	/** \brief Prime iterator over the shared @ref PrimePool
+	 * @ingroup primes
+	 * @ingroup randiter
+	 *
+	 * Draws distinct primes of the given bit size at random from the
+	 * pool: the i-th prime is uniform among the unused ones of the first
+	 * W primes of the pool, where W starts at LINBOX_PRIME_POOL_SPREAD
+	 * and doubles whenever half of them have been given, so that an
+	 * early terminated CRA sees random primes however many it uses. W is
+	 * bounded by a lower estimate of the number of primes of that size;
+	 * past it, the remaining primes are given in order. Below 12 bits all
+	 * the primes are given in order.
+	 *
+	 * The primes are distinct, so a CRA does not check them for
+	 * coprimality, and no primality test is done after the first use of
+	 * the pool. A copy of the iterator gives the same primes as the
+	 * original. The constants of the current prime and the CRT constant
+	 * of the primes given so far are available with @ref constants() and
+	 * @ref crtInverse().
+	 */
+	template<>
+	class PrimeIterator<IteratorCategories::PoolTag> {
+	public:
+		typedef integer Prime_Type ;
+		typedef UniqueSamplingTrait<IteratorCategories::PoolTag> UniqueSamplingTag;
+		typedef IteratorCategories::PoolTag IteratorTag;
+
+		/*! Constructor.
+		 * @param bits size of primes (in bits), at most 63.
+		 * @param seed if \c 0 a seed will be generated, otherwise, the
+		 * provided seed chooses the sequence of primes.
+		 */
+		PrimeIterator (uint64_t bits = 23, uint64_t seed = 0) :
+			_bits (bits), _pool (PrimePool::shared ())
+		{
+			setSeed (seed);
+		}
+
+		inline PrimeIterator<IteratorCategories::PoolTag> &operator ++ ()
+		{
+			next ();
+			return *this;
+		}
+
+		const Prime_Type &operator * () const { return _prime; }
+
+		/// Restarts the sequence chosen by \p seed
+		void setSeed (uint64_t seed)
+		{
+			if (! seed)
+				seed = BaseTimer::seed ();
+			_seed = seed;
+			restart ();
+		}
+
+		/// Restarts the same sequence on the primes of \p bits bits
+		void setBits (uint64_t bits)
+		{
+			_bits = bits;
+			restart ();
+		}
+
+		uint64_t getBits () const { return _bits; }
+
+		/// Reduction constants of the current prime
+		const PoolPrime &constants () const { return *_current; }
+
+		/// Inverse modulo the current prime of the product of the primes given before it
+		uint64_t crtInverse () const { return _crtInverse; }
+
+	protected:
+
+		void restart ()
+		{
+			// there are about 2^{b-1} / (b log 2) primes of b bits
+			_cap = (_bits < 12) ? 0 : size_t ((uint64_t (1) << (_bits - 1)) / (16 * _bits));
+			_generator.seed (_seed);
+			_scan = 0;
+			_given.clear ();
+			_used.clear ();
+			_product = 1;
+			next ();
+		}
+
+		/// Draws the index of the next prime in the pool
+		void next ()
+		{
+			const size_t k = _given.size ();
+			size_t W = std::min (size_t (LINBOX_PRIME_POOL_SPREAD), _cap);
+			while ((2 * k >= W) && (W < _cap))
+				W = std::min (2 * W, _cap);
+
+			size_t i;
+			if (2 * k < W) {
+				if (_used.size () < W)
+					_used.resize (W, false);
+				do
+					i = size_t (_generator () % W);
+				while (_used[i]);
+				_used[i] = true;
+			}
+			else {
+				// in order, skipping the primes drawn at random
+				while (_scan < _used.size () && _used[_scan])
+					++_scan;
+				i = _scan++;
+			}
+
+			if (! _given.empty ())
+				_product *= _prime;
+			_given.push_back (i);
+			_current = &_pool.prime (size_t (_bits), i);
+			_prime = Prime_Type (_current->p);
+			_crtInverse = Protected::invmod64 (uint64_t (_product % _prime), _current->p);
+		}
+
+		uint64_t            _bits;
+		uint64_t            _seed;
+		size_t              _cap;     //!< the random draws are among the first _cap primes
+		size_t              _scan;    //!< next index given in order
+		std::mt19937_64     _generator;
+		std::vector<size_t> _given;   //!< pool indices of the primes given
+		std::vector<bool>   _used;
+		const PoolPrime    *_current;
+		Prime_Type          _prime;
+		integer             _product; //!< product of the primes given before the current one
+		uint64_t            _crtInverse;
+		PrimePool          &_pool;
+	};
+
+} // LinBox
+
+#endif // __LINBOX_randiter_prime_pool_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -49,6 +49,8 @@ namespace LinBox
         struct UniformTag{};
             //! Iterator sampling randomly (no distribution guaranteed whatsoever) from all primes of given bitsize
         struct HeuristicTag{};
+            //! Iterator running through the shared pool of primes of given bitsize (see prime-pool.h)
+        struct PoolTag{};
     };
 
         /*! \brief Whether a prime generator generates a sequence with non repeating
@@ -62,6 +64,10 @@ namespace LinBox
     struct UniqueSamplingTrait<IteratorCategories::DeterministicTag>
 		:public std::true_type { };
 
+    template<>
+    struct UniqueSamplingTrait<IteratorCategories::PoolTag>
+		:public std::true_type { };
+
 
         /*!  @brief  Prime Iterator.
          * @ingroup primes
@@ -342,6 +348,8 @@ namespace LinBox
 
 }
 
+#include "linbox/randiter/prime-pool.h"
+
 #endif //__LINBOX_random_prime_iterator_H
 
 // Local Variables:
@@ -266,7 +266,7 @@ namespace LinBox
 #include "linbox/ring/modular.h"
 #include "linbox/algorithms/cra-domain.h"
 #include "linbox/algorithms/cra-builder-full-multip.h"
-#include "linbox/algorithms/cra-builder-early-multip.h"
+#include "linbox/algorithms/cra-builder-early-coeffwise.h"
 #include "linbox/algorithms/matrix-hom.h"
 
 namespace LinBox
@@ -286,19 +286,26 @@ namespace LinBox
         typedef Givaro::ModularBalanced<double> Field;
 		PrimeIterator<IteratorCategories::HeuristicTag> genprime(FieldTraits<Field>::bestBitSize(A.coldim()));
 
-            // @todo: use a value for the switch provided by the method and not by a macro
-#ifdef __LINBOX_HEURISTIC_CRA
-		ChineseRemainder< CRABuilderEarlyMultip<Field > > cra(LINBOX_DEFAULT_EARLY_TERMINATION_THRESHOLD);
-#else
-        double hbound = FastCharPolyHadamardBound(A);
-		ChineseRemainder< CRABuilderFullMultip<Field > > cra(hbound);
-#endif
 		IntegerModularCharpoly<Matrix, Method> iteration(A, M);
-		cra.operator() (P, iteration, genprime);
-		commentator().stop ("done", NULL, "IbbCharpoly");
+		CRATimedIteration<IntegerModularCharpoly<Matrix, Method> > timed(iteration);
+		if (M.heuristicCRA) {
+			// each coefficient stops being updated once stable
+			ChineseRemainder< CRABuilderEarlyCoeffwise<Field > > cra(M.earlyTerminationThreshold);
+			cra.operator() (P, timed, genprime);
 #ifdef __LB_CRA_TIMING__
-        cra.reportTimes(std::clog) << std::endl;
+			cra.reportTimes(std::clog) << std::endl;
 #endif
+		}
+		else {
+			double hbound = FastCharPolyHadamardBound(A);
+			ChineseRemainder< CRABuilderFullMultip<Field > > cra(hbound);
+			cra.operator() (P, timed, genprime);
+#ifdef __LB_CRA_TIMING__
+			cra.reportTimes(std::clog) << std::endl;
+#endif
+		}
+		timed.report(commentator().report(Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)) << std::endl;
+		commentator().stop ("done", NULL, "IntCharpoly");
 		return P;
 	}
 
@@ -38,6 +38,11 @@
 #define LINBOX_DEFAULT_EARLY_TERMINATION_THRESHOLD 10
 #endif
 
+// Number of primes giving the maximal rank before integerRank stops.
+#if !defined(LINBOX_DEFAULT_RANK_AGREEMENT)
+#define LINBOX_DEFAULT_RANK_AGREEMENT 2
+#endif
+
 // Used to decide which method to use when using Method::Auto on a Blackbox or Sparse matrix.
 #if !defined(LINBOX_USE_BLACKBOX_THRESHOLD)
 #define LINBOX_USE_BLACKBOX_THRESHOLD 1000u
@@ -338,6 +338,7 @@ namespace LinBox
 
 		BlasMatrix<Field> B(A);
 		BlasMatrixDomain<Field> BMD(F);
+		BMD.setNumThreads(Meth.numThreads);
 		d= BMD.detInPlace(B);
 		commentator().stop ("done", NULL, "blasdet");
 
@@ -595,9 +596,9 @@ namespace LinBox
 
 } // end of LinBox namespace
 
-//#if 0
+#include "linbox/algorithms/hybrid-det.h"
+#include "linbox/algorithms/batch-det.h"
 #ifdef __LINBOX_HAVE_NTL
-# include "linbox/algorithms/hybrid-det.h"
 # define SOLUTION_CRA_DET lif_cra_det
 #else
 # define SOLUTION_CRA_DET cra_det
@@ -620,6 +621,53 @@ namespace LinBox
 		return SOLUTION_CRA_DET(d, A, tag, Meth);
 	}
 
+	/** Dense integer matrices use the Dixon divisor with a CRA on the
+	 * cofactor in all builds (see lif_cra_det): the CRA then needs primes
+	 * for the cofactor only, not for the whole determinant.
+	 */
+	template <class Field, class Rep, class MyMethod>
+	typename Field::Element &det (typename Field::Element                 &d,
+				      const BlasMatrix<Field, Rep>            &A,
+				      const RingCategories::IntegerTag        &tag,
+				      const MyMethod                          &Meth)
+	{
+		if (A.coldim() != A.rowdim())
+			throw LinboxError("LinBox ERROR: matrix must be square for determinant computation\n");
+		return lif_cra_det(d, A, tag, Meth);
+	}
+
+	/** Determinants of many dense integer matrices at once.
+	 *
+	 * All the matrices share the primes, the workspaces and the threads
+	 * (see batch_cra_det), with early termination per matrix: for many
+	 * small matrices this avoids a whole CRA set up for each of them.
+	 */
+	template <class Field, class Rep, class MyMethod>
+	std::vector<typename Field::Element> &det (std::vector<typename Field::Element>      &d,
+						   const std::vector<BlasMatrix<Field, Rep> > &A,
+						   const RingCategories::IntegerTag          &tag,
+						   const MyMethod                            &Meth)
+	{
+		return batch_cra_det(d, A, Meth);
+	}
+
+	// The batched det with category specializer
+	template <class Field, class Rep, class MyMethod>
+	std::vector<typename Field::Element> &det (std::vector<typename Field::Element>      &d,
+						   const std::vector<BlasMatrix<Field, Rep> > &A,
+						   const MyMethod                            &Meth)
+	{
+		return det(d, A, typename FieldTraits<Field>::categoryTag(), Meth);
+	}
+
+	// The batched det with default Method
+	template <class Field, class Rep>
+	std::vector<typename Field::Element> &det (std::vector<typename Field::Element>      &d,
+						   const std::vector<BlasMatrix<Field, Rep> > &A)
+	{
+		return det(d, A, Method::Auto());
+	}
+
 	template< class Blackbox, class MyMethod>
 	typename Blackbox::Field::Element &det (typename Blackbox::Field::Element         &d,
 						const Blackbox                            &A,
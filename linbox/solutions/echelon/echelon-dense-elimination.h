@@ -27,6 +27,7 @@
 #include <linbox/matrix/dense-matrix.h>
 #include <linbox/matrix/sparse-matrix.h>
 #include <linbox/solutions/methods.h>
+#include <linbox/matrix/sliced3.h>
 namespace LinBox {
         //
         // row echelon
@@ -43,12 +44,17 @@ namespace LinBox {
 
         size_t m = A.rowdim();
         size_t n = A.coldim();
-        size_t* P = new size_t[m];
-        size_t* Q = new size_t[n];
         const Field& F = A.field();
 
         E = A;
 
+        // Over GF(3), bit-sliced Four-Russians elimination
+        if (useSlicedGF3(F, m, n))
+            return slicedRowEchelonizeGF3(F, E);
+
+        size_t* P = new size_t[m];
+        size_t* Q = new size_t[n];
+
         size_t R = FFPACK::RowEchelonForm (F, m, n, E.getPointer(), E.getStride(), P, Q, false);
 
         FFPACK::getEchelonForm (F, FFLAS::FflasUpper, FFLAS::FflasUnit, m, n, R, Q,
@@ -103,9 +109,13 @@ namespace LinBox {
 
         size_t m = A.rowdim();
         size_t n = A.coldim();
+        const Field& F = A.field();
+
+        if (useSlicedGF3(F, m, n))
+            return slicedRowEchelonizeGF3(F, A);
+
         size_t* P = new size_t[m];
         size_t* Q = new size_t[n];
-        const Field& F = A.field();
 
         size_t R = FFPACK::RowEchelonForm (F, m, n, A.getPointer(), A.getStride(), P, Q, false);
 
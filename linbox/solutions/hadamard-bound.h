@@ -27,10 +27,235 @@
 #include <linbox/matrix/matrix-category.h>
 #include <linbox/matrix/matrix-traits.h>
 
+#include <fflas-ffpack/paladin/parallel.h>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <functional>
 #include <limits>
+#include <vector>
+
+//! Number of entries under which the norms of a dense matrix are computed by a single task
+#ifndef LINBOX_HADAMARD_PARALLEL_THRESHOLD
+#define LINBOX_HADAMARD_PARALLEL_THRESHOLD (size_t(1) << 16)
+#endif
 
 namespace LinBox {
 
+    // ----- Double-precision sums of squares
+
+    namespace Protected {
+        /**
+         * Sum of the squares of integers, kept as s 2^e with double s.
+         *
+         * Each integer only contributes its leading double and exponent
+         * (mpz_get_d_2exp), so that no multiprecision product is formed.
+         * Two sums are kept: a rigorous upper bound, where the truncated
+         * mantissas are rounded up and the rounding errors of the additions
+         * are accounted for, and an estimate, correct to a few ulps.
+         */
+        struct LogSquareSum {
+            double upper = 0.0;
+            double estimate = 0.0;
+            long exp = 0;
+            size_t count = 0;
+            long maxExp = LONG_MIN; //!< |a| < maxMant 2^maxExp for every a added
+            double maxMant = 0.0;
+
+            void add(const Integer& a)
+            {
+                if (a == 0) return;
+                long e;
+                const double d = std::fabs(mpz_get_d_2exp(&e, a.get_mpz()));
+                // d has 53 bits and is truncated: |a| < (d + 2^-53) 2^e
+                const double du = d + 0x1p-53;
+                if (e > maxExp || (e == maxExp && du > maxMant)) {
+                    maxExp = e;
+                    maxMant = du;
+                }
+                addScaled(du * du * (1.0 + 0x1p-50), d * d, 2 * e, 1);
+            }
+
+            template <class Element>
+            void add(const Element& a)
+            {
+                add(Integer(a));
+            }
+
+            void add(const LogSquareSum& o)
+            {
+                if (o.count == 0) return;
+                if (o.maxExp > maxExp || (o.maxExp == maxExp && o.maxMant > maxMant)) {
+                    maxExp = o.maxExp;
+                    maxMant = o.maxMant;
+                }
+                addScaled(o.upper, o.estimate, o.exp, o.count);
+            }
+
+            /// log2 of the euclidean norm: rigorous upper bound and estimate; false if null
+            bool logNorm(double& logUpper, double& logEstimate) const
+            {
+                if (count == 0) {
+                    logUpper = logEstimate = 0.0;
+                    return false;
+                }
+                // recursive summation of positive terms: relative error below count 2^-52
+                const double u = upper * (1.0 + double(count + 1) * 0x1p-52);
+                logUpper = (std::log2(u) + double(exp)) / 2.0;
+                logUpper = logUpper * (1.0 + 0x1p-40) + 0x1p-40;
+                logEstimate = (std::log2(estimate) + double(exp)) / 2.0;
+                return true;
+            }
+
+            /// Upper bound on log2 of the largest absolute value added, -infinity if none
+            double logMax() const
+            {
+                if (count == 0) return -std::numeric_limits<double>::infinity();
+                const double l = std::log2(maxMant) + double(maxExp);
+                return l * (1.0 + 0x1p-40) + 0x1p-40;
+            }
+
+        protected:
+            // Adds (u, v) 2^f, where u and v hold n terms, each below 2 (resp. n)
+            void addScaled(double u, double v, long f, size_t n)
+            {
+                if (count == 0) {
+                    upper = u;
+                    estimate = v;
+                    exp = f;
+                }
+                else if (f > exp) {
+                    upper = rescaleUp(upper, exp - f, count) + u;
+                    estimate = std::ldexp(estimate, int(std::max(exp - f, long(INT_MIN / 2)))) + v;
+                    exp = f;
+                }
+                else {
+                    upper += rescaleUp(u, f - exp, n);
+                    estimate += std::ldexp(v, int(std::max(f - exp, long(INT_MIN / 2))));
+                }
+                count += n;
+            }
+
+            // x 2^d rounded up, x the sum of n terms below 2 and d <= 0
+            static double rescaleUp(double x, long d, size_t n)
+            {
+                if (d < -960) return std::ldexp(2.0 * double(n), -960);
+                return std::ldexp(x, int(d));
+            }
+        };
+    }
+
+    /**
+     * Logarithms of the euclidean norms of the rows and columns of an
+     * integer matrix, and of its largest entry.
+     *
+     * Computed in a single pass over the entries, in double precision,
+     * by parallel tasks on row strips for large dense matrices. The
+     * upper bounds are rigorous, the estimates are the exact values up to
+     * double precision. All the bounds of this file (determinant, minors,
+     * rational solutions) derive from it; computing it once and passing
+     * it to several of them avoids rescanning the matrix.
+     */
+    struct HadamardLogNorms {
+        std::vector<double> rowLogNorms; //!< upper bounds, 0 for a null row
+        std::vector<double> colLogNorms; //!< upper bounds, 0 for a null column
+        std::vector<double> rowLogEstimates;
+        std::vector<double> colLogEstimates;
+        size_t nullRows = 0;
+        size_t nullCols = 0;
+        double logInfinityNorm = -std::numeric_limits<double>::infinity(); //!< upper bound, -infinity if A = 0
+
+        HadamardLogNorms() = default;
+
+        template <class IMatrix>
+        explicit HadamardLogNorms(const IMatrix& A)
+        {
+            typename MatrixTraits<IMatrix>::MatrixCategory tag;
+            compute(A, tag);
+        }
+
+    protected:
+        template <class IMatrix>
+        void compute(const IMatrix& A, const MatrixCategories::RowColMatrixTag& tag)
+        {
+            const size_t m = A.rowdim(), n = A.coldim();
+            std::vector<Protected::LogSquareSum> rows(m);
+
+            const size_t NN = (m * n < LINBOX_HADAMARD_PARALLEL_THRESHOLD) ? 1
+                              : std::max<size_t>(1, std::min<size_t>(NUM_THREADS, m));
+            std::vector<std::vector<Protected::LogSquareSum>> cols(NN, std::vector<Protected::LogSquareSum>(n));
+
+            if (NN == 1) {
+                scanRows(A, 0, m, rows.data(), cols[0].data());
+            }
+            else {
+                SYNCH_GROUP(
+                for (size_t t = 0; t < NN; ++t) {
+                    const size_t first = m * t / NN, last = m * (t + 1) / NN;
+                    Protected::LogSquareSum* R = rows.data() + first;
+                    Protected::LogSquareSum* C = cols[t].data();
+                    { TASK(MODE(CONSTREFERENCE(A) WRITE(R, C)),
+                           scanRows(A, first, last, R, C);)}
+                }
+                )
+                for (size_t t = 1; t < NN; ++t)
+                    for (size_t j = 0; j < n; ++j) cols[0][j].add(cols[t][j]);
+            }
+            finish(rows, cols[0]);
+        }
+
+        template <class IMatrix>
+        void compute(const IMatrix& A, const MatrixCategories::RowMatrixTag& tag)
+        {
+            std::vector<Protected::LogSquareSum> rows(A.rowdim()), cols(A.coldim());
+            size_t i = 0;
+            for (auto rowIt = A.rowBegin(); rowIt != A.rowEnd(); ++rowIt, ++i) {
+                for (const auto& pair : *rowIt) {
+                    rows[i].add(pair.second);
+                    cols[pair.first].add(pair.second);
+                }
+            }
+            finish(rows, cols);
+        }
+
+        template <class IMatrix>
+        void compute(const IMatrix& A, const MatrixCategories::BlackboxTag& tag)
+        {
+            DenseMatrix<typename IMatrix::Field> ACopy(A);
+            compute(ACopy, MatrixCategories::RowColMatrixTag());
+        }
+
+        /// Rows [first, last) of A into R (one per row) and C (one per column)
+        template <class IMatrix>
+        static void scanRows(const IMatrix& A, size_t first, size_t last,
+                             Protected::LogSquareSum* R, Protected::LogSquareSum* C)
+        {
+            for (size_t i = first; i < last; ++i, ++R)
+                for (size_t j = 0; j < A.coldim(); ++j) {
+                    const Integer& a = A.getEntry(i, j);
+                    R->add(a);
+                    C[j].add(a);
+                }
+        }
+
+        void finish(const std::vector<Protected::LogSquareSum>& rows, const std::vector<Protected::LogSquareSum>& cols)
+        {
+            Protected::LogSquareSum all;
+            rowLogNorms.resize(rows.size());
+            rowLogEstimates.resize(rows.size());
+            for (size_t i = 0; i < rows.size(); ++i) {
+                if (!rows[i].logNorm(rowLogNorms[i], rowLogEstimates[i])) ++nullRows;
+                all.add(rows[i]);
+            }
+            colLogNorms.resize(cols.size());
+            colLogEstimates.resize(cols.size());
+            for (size_t j = 0; j < cols.size(); ++j)
+                if (!cols[j].logNorm(colLogNorms[j], colLogEstimates[j])) ++nullCols;
+            logInfinityNorm = all.logMax();
+        }
+    };
+
     // ----- Vector norm
 
     // Returns false if the vector is null, true otherwise
@@ -40,22 +265,17 @@ namespace LinBox {
 #ifdef DEBUG_HADAMARD_BOUND
         std::clog << "BEG vectorLogNorm\n" ;
 #endif
-        Integer normSquared = 0;
+        Protected::LogSquareSum normSquared;
         for (ConstIterator it = begin; it != end; ++it) {
-            // normSquared += Integer(*it)*Integer(*it);
-            Integer rit(*it);
-            Integer::axpyin(normSquared, rit, rit);
+            normSquared.add(*it);
         }
 
-        if (normSquared == 0) {
-            logNorm = 0.0;
+        double logEstimate;
+        if (!normSquared.logNorm(logNorm, logEstimate)) {
             return false; // Vector is zero
         }
 
-        logNorm = Givaro::logtwo(normSquared) / 2.0;
-
 #ifdef DEBUG_HADAMARD_BOUND
-        std::clog << "normSquared:=" << normSquared << ';' << std::endl;
         std::clog << "vectorLogNorm:=" << logNorm << ';' << std::endl;
         std::clog << "END vectorLogNorm\n" ;
 #endif
@@ -81,6 +301,11 @@ namespace LinBox {
          *       HadamardCol(A) / min || A*,j ||  }
          */
         double logBoundOverMinNorm;
+        /**
+         * Estimate of logBound, exact up to double precision
+         * but not an upper bound.
+         */
+        double logEstimate;
     };
 
     /**
@@ -125,26 +350,22 @@ namespace LinBox {
         minLogNorm = std::numeric_limits<double>::infinity();
 
         for (auto rowIt = A.rowBegin(); rowIt != A.rowEnd(); ++rowIt) {
-            Integer normSquared = 0;
+            Protected::LogSquareSum normSquared;
             for (const auto& pair : *rowIt) {
-                normSquared += (pair.second) * (pair.second);
+                normSquared.add(pair.second);
             }
-            if (normSquared == 0) {
+            double rowLogNorm, rowLogEstimate;
+            if (!normSquared.logNorm(rowLogNorm, rowLogEstimate)) {
                 logBound = 0.0;
                 minLogNorm = 0.0;
                 return;
             }
 
-            double logNormSquared = Givaro::logtwo(normSquared);
-            if (logNormSquared < minLogNorm) {
-                minLogNorm = logNormSquared;
+            if (rowLogNorm < minLogNorm) {
+                minLogNorm = rowLogNorm;
             }
-            logBound += logNormSquared;
+            logBound += rowLogNorm;
         }
-
-        // Square-root
-        logBound /= 2.0;
-        minLogNorm /= 2.0;
     }
 
     template <class IMatrix>
@@ -197,31 +418,27 @@ namespace LinBox {
         minLogNorm = std::numeric_limits<double>::infinity();
 
         // This vector contains the norm squared for each columns.
-        std::vector<Integer> columnsNormsSquared(A.coldim());
+        std::vector<Protected::LogSquareSum> columnsNormsSquared(A.coldim());
         for (auto rowIt = A.rowBegin(); rowIt != A.rowEnd(); ++rowIt) {
             for (const auto& pair : *rowIt) {
-                columnsNormsSquared[pair.first] += (pair.second) * (pair.second);
+                columnsNormsSquared[pair.first].add(pair.second);
             }
         }
 
         // All the norms have been computed, we check which one is the smallest
         // and compute the product (aka sum bitsize-wise) of them to make the logBound.
-        for (const Integer& normSquared : columnsNormsSquared) {
-            if (normSquared == 0) {
+        for (const auto& normSquared : columnsNormsSquared) {
+            double colLogNorm, colLogEstimate;
+            if (!normSquared.logNorm(colLogNorm, colLogEstimate)) {
                 logBound = 0.0;
                 minLogNorm = 0.0;
                 return;
             }
-            double logNormSquared = Givaro::logtwo(normSquared);
-            if (logNormSquared < minLogNorm) {
-                minLogNorm = logNormSquared;
+            if (colLogNorm < minLogNorm) {
+                minLogNorm = colLogNorm;
             }
-            logBound += logNormSquared;
+            logBound += colLogNorm;
         }
-
-        // Square-root
-        logBound /= 2.0;
-        minLogNorm /= 2.0;
     }
 
     template <class IMatrix>
@@ -237,44 +454,61 @@ namespace LinBox {
      *
      * The results are expressed as bit size.
      */
-    template <class IMatrix>
-    HadamardLogBoundDetails DetailedHadamardBound(const IMatrix& A)
+    inline HadamardLogBoundDetails DetailedHadamardBound(const HadamardLogNorms& norms)
     {
-#ifdef DEBUG_HADAMARD_BOUND
-        std::clog << "BEG DetailedHadamardBound\n" ;
-#endif
-        double rowLogBound = 0.0;
-        double rowMinLogNorm = 0.0;
-        HadamardRowLogBound(rowLogBound, rowMinLogNorm, A);
-        double rowLogBoundOverMinNorm = rowLogBound - rowMinLogNorm;
+        HadamardLogBoundDetails data;
+        data.logBound = 0.0;
+        data.logBoundOverMinNorm = 0.0;
+        data.logEstimate = 0.0;
+        if (norms.nullRows > 0 || norms.nullCols > 0) {
+            return data;
+        }
+
+        auto sumAndMin = [](double& sum, double& min, const std::vector<double>& logNorms) {
+            sum = 0.0;
+            min = std::numeric_limits<double>::infinity();
+            for (double l : logNorms) {
+                sum += l;
+                min = std::min(min, l);
+            }
+        };
+
+        double rowLogBound, rowMinLogNorm, colLogBound, colMinLogNorm, rowLogEstimate, colLogEstimate, unused;
+        sumAndMin(rowLogBound, rowMinLogNorm, norms.rowLogNorms);
+        sumAndMin(colLogBound, colMinLogNorm, norms.colLogNorms);
+        sumAndMin(rowLogEstimate, unused, norms.rowLogEstimates);
+        sumAndMin(colLogEstimate, unused, norms.colLogEstimates);
 #ifdef DEBUG_HADAMARD_BOUND
         std::clog << "rowLogBound:=" << rowLogBound << ';' << std::endl;
         std::clog << "rowMinLogNorm:=" << rowMinLogNorm << ';' << std::endl;
-        std::clog << "rowLogBoundOverMinNorm:=" << rowLogBoundOverMinNorm << ';' << std::endl;
-#endif
-
-        double colLogBound = 0.0;
-        double colMinLogNorm = 0.0;
-        HadamardColLogBound(colLogBound, colMinLogNorm, A);
-        double colLogBoundOverMinNorm = colLogBound - colMinLogNorm;
-#ifdef DEBUG_HADAMARD_BOUND
         std::clog << "colLogBound:=" << colLogBound << ';' << std::endl;
         std::clog << "colMinLogNorm:=" << colMinLogNorm << ';' << std::endl;
-        std::clog << "colLogBoundOverMinNorm:=" << colLogBoundOverMinNorm << ';' << std::endl;
 #endif
 
-        HadamardLogBoundDetails data;
         data.logBound = std::min(rowLogBound, colLogBound);
-        data.logBoundOverMinNorm = std::min(rowLogBoundOverMinNorm, colLogBoundOverMinNorm);
+        data.logBoundOverMinNorm = std::min(rowLogBound - rowMinLogNorm, colLogBound - colMinLogNorm);
+        data.logEstimate = std::min(rowLogEstimate, colLogEstimate);
 #ifdef DEBUG_HADAMARD_BOUND
         std::clog << "logBound:=" << data.logBound << ';' << std::endl;
         std::clog << "logBoundOverMinNorm:=" << data.logBoundOverMinNorm << ';' << std::endl;
-        std::clog << "END DetailedHadamardBound\n" ;
+        std::clog << "logEstimate:=" << data.logEstimate << ';' << std::endl;
 #endif
-
         return data;
     }
 
+    /**
+     * Precise Hadamard bound (bound on determinant) by taking the minimum
+     * of the column-wise and the row-wise euclidean norm.
+     *
+     * The results are expressed as bit size.
+     * The row and column norms are computed in a single pass.
+     */
+    template <class IMatrix>
+    HadamardLogBoundDetails DetailedHadamardBound(const IMatrix& A)
+    {
+        return DetailedHadamardBound(HadamardLogNorms(A));
+    }
+
     // ----- Hadamard bound
 
     /**
@@ -289,6 +523,44 @@ namespace LinBox {
         return DetailedHadamardBound(A).logBound;
     }
 
+    inline double HadamardBound(const HadamardLogNorms& norms)
+    {
+        return DetailedHadamardBound(norms).logBound;
+    }
+
+    // ----- Bound on the minors
+
+    /// Bit size of the product of the k largest of the given log norms
+    inline double largestLogNormsSum(std::vector<double>& logNorms, size_t k)
+    {
+        k = std::min(k, logNorms.size());
+        std::partial_sort(logNorms.begin(), logNorms.begin() + k, logNorms.end(), std::greater<double>());
+        double logBound = 0.0;
+        for (size_t i = 0; i < k; ++i) logBound += logNorms[i];
+        return logBound;
+    }
+
+    /// Bound on the minors from precomputed norms, see below
+    inline double HadamardMinorLogBound(const HadamardLogNorms& norms)
+    {
+        // null rows have a zero log norm and do not change the sum
+        std::vector<double> logNorms(norms.rowLogNorms);
+        return largestLogNormsSum(logNorms, std::min(norms.rowLogNorms.size(), norms.colLogNorms.size()));
+    }
+
+    /**
+     * Bound on the absolute value of every minor of A, of any size.
+     *
+     * Unlike HadamardBound, zero rows do not make the bound vanish: it is
+     * the product of the min(m, n) largest nonzero row norms.
+     * The result is expressed as bit size.
+     */
+    template <class IMatrix>
+    double HadamardMinorLogBound(const IMatrix& A)
+    {
+        return HadamardMinorLogBound(HadamardLogNorms(A));
+    }
+
     // ----- Fast Hadamard bound
 
 
@@ -310,10 +582,23 @@ namespace LinBox {
         max = 0;
         for (auto it = A.Begin(); it != A.End(); ++it) {
             const Integer& ai = *it;
-            if (max < ai)
-                max = ai;
-            else if (max < -ai)
-                max = -ai;
+            if (absCompare(ai, max) > 0)
+                max = Givaro::abs(ai);
+        }
+
+        return max;
+    }
+
+    template <class IMatrix>
+    inline Integer& InfinityNorm(Integer& max, const IMatrix& A, const MatrixCategories::RowMatrixTag& tag)
+    {
+        max = 0;
+        for (auto rowIt = A.rowBegin(); rowIt != A.rowEnd(); ++rowIt) {
+            for (const auto& pair : *rowIt) {
+                const Integer& ai = pair.second;
+                if (absCompare(ai, max) > 0)
+                    max = Givaro::abs(ai);
+            }
         }
 
         return max;
@@ -335,6 +620,25 @@ namespace LinBox {
         return logBound;
     }
 
+    /// Bit size of the fast Hadamard bound, from precomputed norms
+    inline double FastHadamardBound(const HadamardLogNorms& norms)
+    {
+        if (norms.logInfinityNorm < 0.0) {
+            return 0.0;
+        }
+
+        uint64_t n = std::max(norms.rowLogNorms.size(), norms.colLogNorms.size());
+        return static_cast<double>(n) * (Givaro::logtwo(n) / 2.0 + norms.logInfinityNorm);
+    }
+
+    template <class IMatrix>
+    inline double FastHadamardBound(const IMatrix& A, const MatrixCategories::RowMatrixTag& tag)
+    {
+        Integer infnorm;
+        InfinityNorm(infnorm, A, tag);
+        return FastHadamardBound(A, infnorm);
+    }
+
     template <class IMatrix>
     inline double FastHadamardBound(const IMatrix& A, const MatrixCategories::RowColMatrixTag& tag)
     {
@@ -426,13 +730,20 @@ namespace LinBox {
     typename std::enable_if<std::is_same<typename FieldTraits<typename Matrix::Field>::categoryTag, RingCategories::IntegerTag>::value,
                             RationalSolveHadamardBoundData>::type
     RationalSolveHadamardBound(const Matrix& A, const Vector& b)
+    {
+        return RationalSolveHadamardBound(HadamardLogNorms(A), b);
+    }
+
+    /// Same from the precomputed norms of the matrix
+    template <class Vector>
+    RationalSolveHadamardBoundData RationalSolveHadamardBound(const HadamardLogNorms& norms, const Vector& b)
     {
 #ifdef DEBUG_HADAMARD_BOUND
         std::clog << "BEG RationalSolveHadamardBound\n" ;
 #endif
         RationalSolveHadamardBoundData data;
 
-        auto hadamardBound = DetailedHadamardBound(A);
+        auto hadamardBound = DetailedHadamardBound(norms);
         double bLogNorm;
         vectorLogNorm(bLogNorm, b.begin(), b.end());
 
@@ -212,9 +212,18 @@ namespace LinBox {
         Dispatch dispatch = Dispatch::Auto;
         Communicator* pCommunicator = nullptr;
         bool master() const { return (pCommunicator == nullptr) || pCommunicator->master(); }
+        //! Integer minpoly and charpoly stop each coefficient once it is unchanged for
+        //! earlyTerminationThreshold primes (Monte Carlo), not at the Hadamard bound.
+#ifdef __LINBOX_HEURISTIC_CRA
+        bool heuristicCRA = true;
+#else
+        bool heuristicCRA = false;
+#endif
 
         // ----- For Elimination-based methods.
         PivotStrategy pivotStrategy = PivotStrategy::Linear;
+        size_t numThreads = 1; //!< Threads of the dense FFLAS-FFPACK kernels (fgemm, ftrsm, PLUQ, rank, det).
+                               //!  1 is sequential, 0 uses all the threads of the runtime.
 
         // ----- For Dixon method.
         // @fixme SingularSolutionType::Deterministic fails with Dense Dixon
@@ -187,6 +187,7 @@ namespace LinBox
 
 #include "linbox/ring/modular.h"
 #include "linbox/algorithms/cra-domain.h"
+#include "linbox/algorithms/cra-builder-early-coeffwise.h"
 #include "linbox/randiter/random-prime.h"
 #include "linbox/algorithms/matrix-hom.h"
 
@@ -250,19 +251,25 @@ namespace LinBox
         PrimeIterator<IteratorCategories::HeuristicTag> genprime(FieldTraits<Field>::bestBitSize(A.coldim()));
 		IntegerModularMinpoly<Blackbox,MyMethod> iteration(A, M);
 
-            // @todo: use a value for the switch provided by the method and not by a macro
-#  ifdef __LINBOX_HEURISTIC_CRA
-		ChineseRemainder< CRABuilderEarlyMultip<Field > > cra(LINBOX_DEFAULT_EARLY_TERMINATION_THRESHOLD);
-#  else
-        double hbound = FastCharPolyHadamardBound(A);
-		ChineseRemainder< CRABuilderFullMultip<Field > > cra(hbound);
-#  endif
-		cra(P, iteration, genprime);
+		CRATimedIteration<IntegerModularMinpoly<Blackbox,MyMethod> > timed(iteration);
+		if (M.heuristicCRA) {
+			// degree-aware: residues of lower degree come from unlucky primes
+			ChineseRemainder< CRABuilderEarlyCoeffwise<Field > > cra(M.earlyTerminationThreshold);
+			cra(P, timed, genprime);
+		}
+		else {
+			double hbound = FastCharPolyHadamardBound(A);
+			ChineseRemainder< CRABuilderFullMultip<Field > > cra(hbound);
+			cra(P, timed, genprime);
+		}
 
 #ifdef __LINBOX_HAVE_MPI
 		if(!c || c->rank() == 0)
 #endif
+		{
+			timed.report(commentator().report(Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)) << std::endl;
 			commentator().stop ("done", NULL, "Iminpoly");
+		}
 		return P;
 	}
 
@@ -31,14 +31,86 @@
  * - Dense matrix nullspace on Integers or <code>Z/pZ</code>
  * - Sparse matrix nullspace
  * - Random element in the nullspace
+ *
+ * Only the sampling of the nullspace of a blackbox by block Lanczos or,
+ * over GF(2), block Wiedemann is provided for now.
  */
 
+#include "linbox/field/field-traits.h"
+#include "linbox/solutions/methods.h"
+#include "linbox/algorithms/mg-block-lanczos.h"
+#include "linbox/algorithms/block-wiedemann-gf2.h"
+#include "linbox/util/error.h"
+
+#include <type_traits>
+
 namespace LinBox
 {
-#error "you don't want to include this file for now."
+    /**
+     * \brief Nullspace sampling specialisation for BlockLanczos.
+     */
+    template <class Matrix, class Blackbox, class CategoryTag>
+    inline size_t nullspace (Matrix &X, const Blackbox &A, const CategoryTag &tag, const Method::BlockLanczos &m)
+    {
+        throw LinboxError("Method::BlockLanczos can only be used with RingCategories::ModularTag.");
+    }
+
+    /**
+     * \brief Nullspace sampling specialisation for BlockLanczos with ModularTag.
+     *
+     * The columns of \p X are filled with vectors of the right nullspace of
+     * \p A. Over \f$ \mathbf{F}_2 \f$ the vectors are linearly independent.
+     *
+     * \return the number of columns of \p X that were filled.
+     */
+    template <class Matrix, class Blackbox>
+    inline size_t nullspace (Matrix &X, const Blackbox &A, const RingCategories::ModularTag &tag, const Method::BlockLanczos &m)
+    {
+        MGBlockLanczosSolver<typename Blackbox::Field> solver (A.field (), m);
+
+        return solver.sampleNullspace (A, X);
+    }
+
+    /**
+     * \brief Nullspace sampling specialisation for BlockWiedemann.
+     */
+    template <class Matrix, class Blackbox, class CategoryTag>
+    inline size_t nullspace (Matrix &X, const Blackbox &A, const CategoryTag &tag, const Method::BlockWiedemann &m)
+    {
+        throw LinboxError("Method::BlockWiedemann nullspace can only be used with RingCategories::ModularTag.");
+    }
+
+    /**
+     * \brief Nullspace sampling specialisation for BlockWiedemann with ModularTag, over \f$ \mathbf{F}_2 \f$ only.
+     *
+     * The columns of \p X are filled with linearly independent vectors of
+     * the right nullspace of \p A.
+     *
+     * \return the number of columns of \p X that were filled.
+     */
+    template <class Matrix, class Blackbox>
+    inline size_t nullspace (Matrix &X, const Blackbox &A, const RingCategories::ModularTag &tag, const Method::BlockWiedemann &m)
+    {
+        static_assert (std::is_same<typename Blackbox::Field, GF2>::value,
+                       "Method::BlockWiedemann nullspace is only available over GF2");
+
+        BlockWiedemannSolverGF2 solver (A.field (), m);
+
+        return solver.sampleNullspace (A, X);
+    }
+
+    /**
+     * Sample the right nullspace of \p A by the selected method.
+     * \ingroup solutions
+     */
+    template <class Matrix, class Blackbox, class MyMethod>
+    inline size_t nullspace (Matrix &X, const Blackbox &A, const MyMethod &m)
+    {
+        return nullspace (X, A, typename FieldTraits<typename Blackbox::Field>::categoryTag (), m);
+    }
 }
 
-#endif // __LINBOX_modulardense_nullspace_H
+#endif // __LINBOX_nullspace_H
 
 // Local Variables:
 // mode: C++
@@ -41,10 +41,16 @@
 #include "linbox/algorithms/massey-domain.h"
 #include "linbox/algorithms/gauss.h"
 #include "linbox/algorithms/gauss-gf2.h"
+#include "linbox/algorithms/mg-block-lanczos.h"
+#include "linbox/algorithms/block-wiedemann-gf2.h"
 #include "linbox/matrix/matrix-domain.h"
 #include "linbox/algorithms/whisart_trace.h"
 #include "linbox/matrix/dense-matrix.h"
 #include "linbox/matrix/matrixdomain/blas-matrix-domain.h"
+#include "linbox/matrix/sliced3.h"
+#include "linbox/matrix/sliced-modp.h"
+#include "linbox/algorithms/multiprime-rank.h"
+#include "linbox/solutions/hadamard-bound.h"
 
 #include "linbox/vector/vector-traits.h"
 #include "linbox/solutions/trace.h"
@@ -67,7 +73,7 @@ namespace LinBox
 	 * For small or dense matrices DenseElimination will be faster.
 	 * \param[out] r  output rank of A.
 	 * \param[in]  A linear transform, member of any blackbox class.
-	 * \param[in]  M may be a \p Method::Auto (the default), a \p Method::Wiedemann, a  \p Method::DenseElimination, or a \p Method::SparseElimination..
+	 * \param[in]  M may be a \p Method::Auto (the default), a \p Method::Wiedemann, a  \p Method::DenseElimination, a \p Method::SparseElimination, or over GF2 a \p Method::BlockLanczos or a \p Method::BlockWiedemann.
 	 * \param      tag UNDOC
 	 * \return a reference to r.
 	 */
@@ -124,6 +130,26 @@ namespace LinBox
 		return rankInPlace(r, A, typename FieldTraits<typename Blackbox::Field>::categoryTag(), Method::SparseElimination());
 	}
 
+	/**
+	 * Rank of an integer matrix from its ranks modulo several random primes.
+	 * \ingroup solutions
+	 * The ranks modulo the primes are computed concurrently, and the
+	 * remaining ones are cancelled once \p agreement primes gave the
+	 * maximal rank (see MultiPrimeRank). The result is never larger than
+	 * the rank of \p A, and is proven when it is \f$\min(m,n)\f$.
+	 * @param[out] r        rank of \p A
+	 * @param[out] failure  bound on the probability that \p r is too small
+	 * @param A         matrix over the integers
+	 * @param M         method used modulo each prime
+	 * @param agreement number of primes that must give the maximal rank
+	 * @param certify   also check the rank modulo a prime of another size,
+	 *                  which is independent of the primes of the first phase
+	 * @return \p r
+	 */
+	template <class Blackbox, class Method>
+	inline size_t &integerRank (size_t &r, double &failure, const Blackbox &A, const Method &M,
+				    size_t agreement = LINBOX_DEFAULT_RANK_AGREEMENT, bool certify = false);
+
 
 
 } // LinBox
@@ -31,6 +31,8 @@
 // #define __LINBOX_rank_sparse_elimination_format SparseMatrixFormat::COO
 // #define __LINBOX_rank_sparse_elimination_format SparseMatrixFormat::CSR
 
+#include <type_traits>
+
 #include "linbox/field/field-traits.h"
 
 #include <givaro/extension.h>
@@ -423,8 +425,15 @@ namespace LinBox
 		linbox_check( a == b );
 		linbox_check( a < LinBox::BlasBound);
 		BlasMatrix<Field> B(A);
-		BlasMatrixDomain<Field> D(F);
-		r = D.rankInPlace(B);
+		if (useSlicedGF3(F, B.rowdim(), B.coldim()))
+			r = slicedRankGF3(F, B);
+		else if (useSlicedModp(F, B.rowdim(), B.coldim()))
+			r = slicedRankModp(F, B);
+		else {
+			BlasMatrixDomain<Field> D(F);
+			D.setNumThreads(M.numThreads);
+			r = D.rankInPlace(B);
+		}
 		commentator().stop ("done", NULL, "blasrank");
 		return r;
 	}
@@ -463,6 +472,56 @@ namespace LinBox
         return integral_rank(r,A,M);
     }
 
+	/// Rank of the image of an integer matrix modulo one prime, for MultiPrimeRank
+	template <class Blackbox, class MyMethod>
+	struct IntegerRankIteration {
+		const Blackbox &A;
+		const MyMethod &M;
+
+		IntegerRankIteration (const Blackbox &B, const MyMethod &N) :
+			A (B), M (N)
+		{}
+
+		template <class Field>
+		size_t &operator() (size_t &r, const Field &F)
+		{
+			typedef typename Blackbox::template rebind< Field >::other FBlackbox;
+			FBlackbox Ap (A, F);
+			return rankInPlace (r, Ap, RingCategories::ModularTag (), M);
+		}
+	};
+
+	template <class Blackbox, class MyMethod>
+	inline size_t &integerRank (size_t          &r,
+				    double          &failure,
+				    const Blackbox  &A,
+				    const MyMethod  &M,
+				    size_t          agreement,
+				    bool            certify)
+	{
+		commentator().start ("Integer Rank modulo several primes", "mprank");
+		typedef Givaro::ModularBalanced<double> projField;
+		const size_t bits = FieldTraits<projField>::bestBitSize(A.rowdim());
+		PrimeIterator<IteratorCategories::HeuristicTag> genprime(bits);
+
+		IntegerRankIteration<Blackbox, MyMethod> iteration (A, M);
+		MultiPrimeRank<projField> MPR (agreement);
+		MPR (r, iteration, genprime, std::min (A.rowdim (), A.coldim ()), HadamardMinorLogBound (A));
+
+		if (certify && !MPR.certified ()) {
+			// a prime of another size cannot have been tried already
+			PrimeIterator<IteratorCategories::HeuristicTag> checkprime(bits - 1);
+			MPR.certify (r, iteration, checkprime);
+		}
+		failure = MPR.failureProbability ();
+
+		commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
+			<< "Integer Rank " << r << " from " << MPR.primes () << " primes, "
+			<< MPR.agreeing () << " agreeing, failure probability <= " << failure << std::endl;
+		commentator().stop ("done", NULL, "mprank");
+		return r;
+	}
+
 	// error hanlder for rational domain
 	template <class Blackbox, class Method>
 	inline size_t &rank (size_t                           &r,
@@ -583,6 +642,48 @@ namespace LinBox { /*  rankInPlace */
 		return r;
 	}
 
+	/** M may be <code>Method::BlockLanczos()</code>, over \f$ \mathbf{F}_2 \f$ only.
+	 *
+	 * Monte Carlo: the rank is the column dimension minus the dimension of
+	 * the sampled nullspace.
+	 */
+	template <class Blackbox>
+	inline size_t &rank (size_t                     &r,
+				    const Blackbox                    &A,
+				    const RingCategories::ModularTag  &tag,
+				    const Method::BlockLanczos        &m)
+	{
+		static_assert (std::is_same<typename Blackbox::Field, GF2>::value,
+			       "Method::BlockLanczos rank is only available over GF2");
+
+		commentator().start ("Block Lanczos Rank over GF2", "blrankmod2");
+		MGBlockLanczosSolver<GF2> solver (A.field (), m);
+		r = solver.rank (A);
+		commentator().stop ("done", NULL, "blrankmod2");
+		return r;
+	}
+
+	/** M may be <code>Method::BlockWiedemann()</code>, over \f$ \mathbf{F}_2 \f$ only.
+	 *
+	 * Monte Carlo, as for <code>Method::BlockLanczos</code>; the blocking
+	 * factor is rounded up to 64, 128 or 256 packed columns.
+	 */
+	template <class Blackbox>
+	inline size_t &rank (size_t                     &r,
+				    const Blackbox                    &A,
+				    const RingCategories::ModularTag  &tag,
+				    const Method::BlockWiedemann      &m)
+	{
+		static_assert (std::is_same<typename Blackbox::Field, GF2>::value,
+			       "Method::BlockWiedemann rank is only available over GF2");
+
+		commentator().start ("Block Wiedemann Rank over GF2", "bwrankmod2");
+		BlockWiedemannSolverGF2 solver (A.field (), m);
+		r = solver.rank (A);
+		commentator().stop ("done", NULL, "bwrankmod2");
+		return r;
+	}
+
 	/// specialization to \f$ \mathbf{F}_2 \f$
 	inline size_t &rankInPlace (size_t                       &r,
 				      GaussDomain<GF2>::Matrix            &A,
@@ -615,8 +716,15 @@ namespace LinBox { /*  rankInPlace */
 
 		commentator().start ("BlasBB Rank", "blasbbrank");
 		const Field F = A.field();
-		BlasMatrixDomain<Field> D(F);
-		r = D.rankInPlace(static_cast< BlasMatrix<Field>& >(A));
+		if (useSlicedGF3(F, A.rowdim(), A.coldim()))
+			r = slicedRankGF3(F, A);
+		else if (useSlicedModp(F, A.rowdim(), A.coldim()))
+			r = slicedRankModp(F, A);
+		else {
+			BlasMatrixDomain<Field> D(F);
+			D.setNumThreads(M.numThreads);
+			r = D.rankInPlace(static_cast< BlasMatrix<Field>& >(A));
+		}
 		commentator().stop ("done", NULL, "blasbbrank");
 		return r;
 	}
@@ -55,7 +55,7 @@ namespace LinBox {
 
         commentator().start("solve.dense-elimination.modular.dense");
 
-        PLUQMatrix<Field> PLUQ(A);
+        PLUQMatrix<Field> PLUQ(A, m.numThreads);
         PLUQ.left_solve(x, b);
 
         commentator().stop("solve.dense-elimination.modular.dense");
@@ -58,7 +58,8 @@ namespace LinBox {
         using FMatrix = BlasMatrix<Field>;
         using NumericSolver = LPS<FMatrix>;
 
-        NumericSolver numSolver;
+        // one step of refinement with an extended residual: more correct bits per overlap step
+        NumericSolver numSolver(1, true);
         RationalSolverSN<Ring, NumericSolver> rsolver(b.field(), numSolver, false);
 
         SolverReturnStatus status = rsolver.solve(xNum, xDen, A, b);
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <linbox/algorithms/block-wiedemann.h>
+#include <linbox/algorithms/block-wiedemann-gf2.h>
 #include <linbox/algorithms/coppersmith.h>
 #include <linbox/algorithms/wiedemann.h>
 #include <linbox/solutions/methods.h>
@@ -124,6 +125,29 @@ namespace LinBox {
         return x;
     }
 
+    /**
+     * \brief Solve specialisation for BlockWiedemann over \f$ \mathbf{F}_2 \f$.
+     *
+     * Word-packed blocks of 64, 128 or 256 columns, see BitBlockWiedemannSolver.
+     */
+    template <class ResultVector, class Vector>
+    ResultVector& solve(ResultVector& x, const ZeroOne<GF2>& A, const Vector& b, const RingCategories::ModularTag& tag,
+                        const Method::BlockWiedemann& m)
+    {
+        commentator().start("solve.block-wiedemann.gf2");
+        linbox_check((A.coldim() == x.size()) && (A.rowdim() == b.size()));
+
+        BlockWiedemannSolverGF2 solver(A.field(), m);
+
+        if (!solver.solve(A, x, b)) {
+            throw LinboxMathInconsistentSystem("From BlockWiedemann solve over GF2.");
+        }
+
+        commentator().stop("solve.block-wiedemann.gf2");
+
+        return x;
+    }
+
     //
     // Coppersmith
     // @deprecated Kept but not tested.
@@ -38,11 +38,28 @@ namespace LinBox {
         template <class T> inline void ssend(const T& value, int dest) {}
         template <class T> inline void recv(T& value, int src) {}
         template <class T> inline void bcast(T& value, int src) {}
+
+        template <class T> inline void send(const T& value, int dest, int tag) {}
+        template <class T> inline void recv(T& value, int src, int tag) {}
+        template <class T> inline void isend(const T& value, int dest, int tag) {}
+        inline void probe(int src, int tag) {}
+        inline bool iprobe(int src, int tag) { return false; }
+        inline void waitall() {}
     };
 }
 #else
 
+#include <list>
 #include <mpi.h>
+#include <type_traits>
+#include <vector>
+
+#include "./serialization.h"
+
+#ifndef LINBOX_MPI_CHUNK_BYTES
+/// Large buffers are sent in chunks of this size, so that transfers are pipelined.
+#define LINBOX_MPI_CHUNK_BYTES (uint64_t(1) << 26)
+#endif
 
 namespace LinBox {
     /**
@@ -89,12 +106,90 @@ namespace LinBox {
         template <class T> void recv(T& value, int src);
         template <class T> void bcast(T& value, int src);
 
+        // tagged whole object communication
+        template <class T> void send(const T& value, int dest, int tag);
+        template <class T> void recv(T& value, int src, int tag);
+
+        /**
+         * Nonblocking send: the serialized value is kept by the communicator
+         * until the transfer completes (see waitall()).
+         */
+        template <class T> void isend(const T& value, int dest, int tag);
+
+        // Wait for a matching message (any of MPI_ANY_SOURCE, MPI_ANY_TAG), the envelope is then in status().
+        void probe(int src, int tag);
+        // Same as probe() but returns immediately, true iff a matching message is pending.
+        bool iprobe(int src, int tag);
+
+        // Complete all pending isend().
+        void waitall();
+
+        /**
+         * Direct transport of dense matrices, vectors and CSR matrices.
+         *
+         * Instead of serializing entry by entry, the dimensions are sent
+         * first and then the contiguous storage itself, in chunks of
+         * LINBOX_MPI_CHUNK_BYTES in flight together.  Elements that are plain
+         * data (e.g. of Givaro::Modular<double>) are sent as is: the nodes are
+         * expected to share the same byte order.  Integer entries are sent as
+         * their sizes followed by all the GMP limbs packed in one buffer.
+         * Other element types go through serialize().
+         */
+        template <class Field> void send(const BlasMatrix<Field>& M, int dest);
+        template <class Field> void ssend(const BlasMatrix<Field>& M, int dest);
+        template <class Field> void recv(BlasMatrix<Field>& M, int src);
+        template <class Field> void bcast(BlasMatrix<Field>& M, int src);
+
+        template <class Field> void send(const BlasVector<Field>& V, int dest);
+        template <class Field> void ssend(const BlasVector<Field>& V, int dest);
+        template <class Field> void recv(BlasVector<Field>& V, int src);
+        template <class Field> void bcast(BlasVector<Field>& V, int src);
+
+        template <class Field> void send(const SparseMatrix<Field, SparseMatrixFormat::CSR>& M, int dest);
+        template <class Field> void ssend(const SparseMatrix<Field, SparseMatrixFormat::CSR>& M, int dest);
+        template <class Field> void recv(SparseMatrix<Field, SparseMatrixFormat::CSR>& M, int src);
+        template <class Field> void bcast(SparseMatrix<Field, SparseMatrixFormat::CSR>& M, int src);
+
+    protected:
+        // Dimensions, sent with MPI_Ssend if synchronous, received from src and then sets the source in status()
+        void sendHeader(const uint64_t* header, int count, int dest, bool synchronous);
+        void recvHeader(uint64_t* header, int count, int src);
+
+        // Chunked transfers of raw buffers
+        void sendBuffer(const void* data, uint64_t bytes, int dest, int tag);
+        void recvBuffer(void* data, uint64_t bytes, int src, int tag);
+        void bcastBuffer(void* data, uint64_t bytes, int src);
+
+        // Element arrays: raw if trivially copyable, packed limbs for Integer, serialized otherwise
+        template <class Element> void sendElements(const Element* p, uint64_t n, int dest, int tag);
+        template <class Element> void recvElements(Element* p, uint64_t n, int src, int tag);
+        template <class Element> void bcastElements(Element* p, uint64_t n, int src);
+
+        template <class Element> void sendElements(const Element* p, uint64_t n, int dest, int tag, std::true_type);
+        template <class Element> void recvElements(Element* p, uint64_t n, int src, int tag, std::true_type);
+        template <class Element> void bcastElements(Element* p, uint64_t n, int src, std::true_type);
+
+        template <class Element> void sendElements(const Element* p, uint64_t n, int dest, int tag, std::false_type);
+        template <class Element> void recvElements(Element* p, uint64_t n, int src, int tag, std::false_type);
+        template <class Element> void bcastElements(Element* p, uint64_t n, int src, std::false_type);
+
+        void sendElements(const Integer* p, uint64_t n, int dest, int tag);
+        void recvElements(Integer* p, uint64_t n, int src, int tag);
+        void bcastElements(Integer* p, uint64_t n, int src);
+
+    protected:
+        // Release the buffers of completed isend().
+        void cleanup();
+
     protected:
         MPI_Comm _comm;       // MPI's handle for the communicator
         MPI_Status _status;   // status from most recent receive
         int _size = 0;
         int _rank = 0;
         bool _boss = false;   // Whether it's a MPI initializing communicator
+
+        // pending nonblocking sends and their buffers
+        std::list<std::pair<MPI_Request, std::vector<uint8_t>>> _pending;
     };
 }
 
@@ -26,6 +26,11 @@
 
 #include "./serialization.h"
 
+#include <algorithm>
+#include <cstdlib>
+
+#include "linbox/util/error.h"
+
 namespace LinBox {
 
     // ----- Constructors
@@ -65,6 +70,7 @@ namespace LinBox {
 
     Communicator::~Communicator()
     {
+        waitall();
         if (_boss) {
             MPI_Finalize();
         }
@@ -137,6 +143,407 @@ namespace LinBox {
             unserialize(value, bytes);
         }
     }
+
+    // tagged whole object communication
+
+    template <class T> void Communicator::send(const T& value, int dest, int tag)
+    {
+        std::vector<uint8_t> bytes;
+        uint64_t length = serialize(bytes, value);
+        MPI_Send(bytes.data(), length, MPI_UINT8_T, dest, tag, _comm);
+    }
+
+    template <class T> void Communicator::recv(T& value, int src, int tag)
+    {
+        int length = 0;
+        MPI_Probe(src, tag, _comm, &_status);
+        MPI_Get_count(&_status, MPI_UINT8_T, &length);
+
+        // Receive the probed message, even if src or tag were wildcards
+        std::vector<uint8_t> bytes(length);
+        MPI_Recv(bytes.data(), length, MPI_UINT8_T, _status.MPI_SOURCE, _status.MPI_TAG, _comm, &_status);
+        unserialize(value, bytes);
+    }
+
+    template <class T> void Communicator::isend(const T& value, int dest, int tag)
+    {
+        cleanup();
+
+        _pending.emplace_back();
+        auto& pending = _pending.back();
+        uint64_t length = serialize(pending.second, value);
+        MPI_Isend(pending.second.data(), length, MPI_UINT8_T, dest, tag, _comm, &pending.first);
+    }
+
+    // ----- Direct transport
+
+    inline void Communicator::sendHeader(const uint64_t* header, int count, int dest, bool synchronous)
+    {
+        if (synchronous) {
+            MPI_Ssend(header, count, MPI_UINT64_T, dest, 0, _comm);
+        }
+        else {
+            MPI_Send(header, count, MPI_UINT64_T, dest, 0, _comm);
+        }
+    }
+
+    inline void Communicator::recvHeader(uint64_t* header, int count, int src)
+    {
+        MPI_Recv(header, count, MPI_UINT64_T, src, 0, _comm, &_status);
+    }
+
+    inline void Communicator::sendBuffer(const void* data, uint64_t bytes, int dest, int tag)
+    {
+        auto b = static_cast<const uint8_t*>(data);
+        std::vector<MPI_Request> requests;
+        for (uint64_t offset = 0; offset < bytes; offset += LINBOX_MPI_CHUNK_BYTES) {
+            uint64_t length = std::min<uint64_t>(LINBOX_MPI_CHUNK_BYTES, bytes - offset);
+            requests.emplace_back();
+            MPI_Isend(b + offset, static_cast<int>(length), MPI_BYTE, dest, tag, _comm, &requests.back());
+        }
+        MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    }
+
+    inline void Communicator::recvBuffer(void* data, uint64_t bytes, int src, int tag)
+    {
+        auto b = static_cast<uint8_t*>(data);
+        std::vector<MPI_Request> requests;
+        for (uint64_t offset = 0; offset < bytes; offset += LINBOX_MPI_CHUNK_BYTES) {
+            uint64_t length = std::min<uint64_t>(LINBOX_MPI_CHUNK_BYTES, bytes - offset);
+            requests.emplace_back();
+            MPI_Irecv(b + offset, static_cast<int>(length), MPI_BYTE, src, tag, _comm, &requests.back());
+        }
+        MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    }
+
+    inline void Communicator::bcastBuffer(void* data, uint64_t bytes, int src)
+    {
+        auto b = static_cast<uint8_t*>(data);
+        std::vector<MPI_Request> requests;
+        for (uint64_t offset = 0; offset < bytes; offset += LINBOX_MPI_CHUNK_BYTES) {
+            uint64_t length = std::min<uint64_t>(LINBOX_MPI_CHUNK_BYTES, bytes - offset);
+            requests.emplace_back();
+            MPI_Ibcast(b + offset, static_cast<int>(length), MPI_BYTE, src, _comm, &requests.back());
+        }
+        MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    }
+
+    // Element arrays
+
+    template <class Element> void Communicator::sendElements(const Element* p, uint64_t n, int dest, int tag)
+    {
+        sendElements(p, n, dest, tag, typename std::is_trivially_copyable<Element>::type());
+    }
+
+    template <class Element> void Communicator::recvElements(Element* p, uint64_t n, int src, int tag)
+    {
+        recvElements(p, n, src, tag, typename std::is_trivially_copyable<Element>::type());
+    }
+
+    template <class Element> void Communicator::bcastElements(Element* p, uint64_t n, int src)
+    {
+        bcastElements(p, n, src, typename std::is_trivially_copyable<Element>::type());
+    }
+
+    template <class Element>
+    void Communicator::sendElements(const Element* p, uint64_t n, int dest, int tag, std::true_type)
+    {
+        sendBuffer(p, n * sizeof(Element), dest, tag);
+    }
+
+    template <class Element>
+    void Communicator::recvElements(Element* p, uint64_t n, int src, int tag, std::true_type)
+    {
+        recvBuffer(p, n * sizeof(Element), src, tag);
+    }
+
+    template <class Element>
+    void Communicator::bcastElements(Element* p, uint64_t n, int src, std::true_type)
+    {
+        bcastBuffer(p, n * sizeof(Element), src);
+    }
+
+    template <class Element>
+    void Communicator::sendElements(const Element* p, uint64_t n, int dest, int tag, std::false_type)
+    {
+        std::vector<uint8_t> bytes;
+        uint64_t length = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            length += serialize(bytes, p[i]);
+        }
+        MPI_Send(&length, 1, MPI_UINT64_T, dest, tag, _comm);
+        sendBuffer(bytes.data(), length, dest, tag);
+    }
+
+    template <class Element>
+    void Communicator::recvElements(Element* p, uint64_t n, int src, int tag, std::false_type)
+    {
+        uint64_t length = 0;
+        MPI_Recv(&length, 1, MPI_UINT64_T, src, tag, _comm, MPI_STATUS_IGNORE);
+        std::vector<uint8_t> bytes(length);
+        recvBuffer(bytes.data(), length, src, tag);
+
+        uint64_t offset = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            offset += unserialize(p[i], bytes, offset);
+        }
+    }
+
+    template <class Element>
+    void Communicator::bcastElements(Element* p, uint64_t n, int src, std::false_type)
+    {
+        std::vector<uint8_t> bytes;
+        uint64_t length = 0;
+        if (src == _rank) {
+            for (uint64_t i = 0; i < n; ++i) {
+                length += serialize(bytes, p[i]);
+            }
+        }
+        MPI_Bcast(&length, 1, MPI_UINT64_T, src, _comm);
+        bytes.resize(length);
+        bcastBuffer(bytes.data(), length, src);
+
+        if (src != _rank) {
+            uint64_t offset = 0;
+            for (uint64_t i = 0; i < n; ++i) {
+                offset += unserialize(p[i], bytes, offset);
+            }
+        }
+    }
+
+    // Integers: the sizes, then all the limbs in one buffer
+
+    namespace Protected {
+        inline uint64_t packIntegers(std::vector<int32_t>& sizes, std::vector<mp_limb_t>& limbs, const Integer* p, uint64_t n)
+        {
+            sizes.resize(n);
+            uint64_t count = 0;
+            for (uint64_t i = 0; i < n; ++i) {
+                sizes[i] = p[i].get_mpz()->_mp_size;
+                count += std::abs(sizes[i]);
+            }
+
+            limbs.resize(count);
+            auto it = limbs.begin();
+            for (uint64_t i = 0; i < n; ++i) {
+                const mp_limb_t* d = p[i].get_mpz()->_mp_d;
+                it = std::copy(d, d + std::abs(sizes[i]), it);
+            }
+            return count;
+        }
+
+        inline void unpackIntegers(Integer* p, uint64_t n, const std::vector<int32_t>& sizes, const std::vector<mp_limb_t>& limbs)
+        {
+            auto it = limbs.begin();
+            for (uint64_t i = 0; i < n; ++i) {
+                __mpz_struct* mpzStruct = p[i].get_mpz();
+                int32_t l = std::abs(sizes[i]);
+                if (mpzStruct->_mp_alloc < l) {
+                    _mpz_realloc(mpzStruct, l);
+                }
+                std::copy(it, it + l, mpzStruct->_mp_d);
+                mpzStruct->_mp_size = sizes[i];
+                it += l;
+            }
+        }
+    }
+
+    inline void Communicator::sendElements(const Integer* p, uint64_t n, int dest, int tag)
+    {
+        std::vector<int32_t> sizes;
+        std::vector<mp_limb_t> limbs;
+        uint64_t header[2] = {Protected::packIntegers(sizes, limbs, p, n), sizeof(mp_limb_t)};
+
+        MPI_Send(header, 2, MPI_UINT64_T, dest, tag, _comm);
+        sendBuffer(sizes.data(), n * sizeof(int32_t), dest, tag);
+        sendBuffer(limbs.data(), header[0] * sizeof(mp_limb_t), dest, tag);
+    }
+
+    inline void Communicator::recvElements(Integer* p, uint64_t n, int src, int tag)
+    {
+        uint64_t header[2];
+        MPI_Recv(header, 2, MPI_UINT64_T, src, tag, _comm, MPI_STATUS_IGNORE);
+        if (header[1] != sizeof(mp_limb_t)) {
+            throw LinboxError("Communicator: GMP limbs have different sizes on the nodes.");
+        }
+
+        std::vector<int32_t> sizes(n);
+        std::vector<mp_limb_t> limbs(header[0]);
+        recvBuffer(sizes.data(), n * sizeof(int32_t), src, tag);
+        recvBuffer(limbs.data(), header[0] * sizeof(mp_limb_t), src, tag);
+        Protected::unpackIntegers(p, n, sizes, limbs);
+    }
+
+    inline void Communicator::bcastElements(Integer* p, uint64_t n, int src)
+    {
+        std::vector<int32_t> sizes;
+        std::vector<mp_limb_t> limbs;
+        uint64_t header[2] = {0, sizeof(mp_limb_t)};
+        if (src == _rank) {
+            header[0] = Protected::packIntegers(sizes, limbs, p, n);
+        }
+
+        MPI_Bcast(header, 2, MPI_UINT64_T, src, _comm);
+        if (header[1] != sizeof(mp_limb_t)) {
+            throw LinboxError("Communicator: GMP limbs have different sizes on the nodes.");
+        }
+        sizes.resize(n);
+        limbs.resize(header[0]);
+        bcastBuffer(sizes.data(), n * sizeof(int32_t), src);
+        bcastBuffer(limbs.data(), header[0] * sizeof(mp_limb_t), src);
+
+        if (src != _rank) {
+            Protected::unpackIntegers(p, n, sizes, limbs);
+        }
+    }
+
+    // BlasMatrix
+
+    template <class Field> void Communicator::send(const BlasMatrix<Field>& M, int dest)
+    {
+        uint64_t header[2] = {M.rowdim(), M.coldim()};
+        sendHeader(header, 2, dest, false);
+        sendElements(M.getPointer(), header[0] * header[1], dest, 0);
+    }
+
+    template <class Field> void Communicator::ssend(const BlasMatrix<Field>& M, int dest)
+    {
+        uint64_t header[2] = {M.rowdim(), M.coldim()};
+        sendHeader(header, 2, dest, true);
+        sendElements(M.getPointer(), header[0] * header[1], dest, 0);
+    }
+
+    template <class Field> void Communicator::recv(BlasMatrix<Field>& M, int src)
+    {
+        uint64_t header[2];
+        recvHeader(header, 2, src);
+        M.resize(header[0], header[1]);
+        recvElements(M.getPointer(), header[0] * header[1], _status.MPI_SOURCE, 0);
+    }
+
+    template <class Field> void Communicator::bcast(BlasMatrix<Field>& M, int src)
+    {
+        uint64_t header[2] = {M.rowdim(), M.coldim()};
+        MPI_Bcast(header, 2, MPI_UINT64_T, src, _comm);
+        if (src != _rank) {
+            M.resize(header[0], header[1]);
+        }
+        bcastElements(M.getPointer(), header[0] * header[1], src);
+    }
+
+    // BlasVector
+
+    template <class Field> void Communicator::send(const BlasVector<Field>& V, int dest)
+    {
+        uint64_t header = V.size();
+        sendHeader(&header, 1, dest, false);
+        sendElements(V.getPointer(), header, dest, 0);
+    }
+
+    template <class Field> void Communicator::ssend(const BlasVector<Field>& V, int dest)
+    {
+        uint64_t header = V.size();
+        sendHeader(&header, 1, dest, true);
+        sendElements(V.getPointer(), header, dest, 0);
+    }
+
+    template <class Field> void Communicator::recv(BlasVector<Field>& V, int src)
+    {
+        uint64_t header;
+        recvHeader(&header, 1, src);
+        V.resize(header);
+        recvElements(V.getPointer(), header, _status.MPI_SOURCE, 0);
+    }
+
+    template <class Field> void Communicator::bcast(BlasVector<Field>& V, int src)
+    {
+        uint64_t header = V.size();
+        MPI_Bcast(&header, 1, MPI_UINT64_T, src, _comm);
+        if (src != _rank) {
+            V.resize(header);
+        }
+        bcastElements(V.getPointer(), header, src);
+    }
+
+    // CSR: row starts, column indices and values, each in one buffer
+
+    template <class Field> void Communicator::send(const SparseMatrix<Field, SparseMatrixFormat::CSR>& M, int dest)
+    {
+        uint64_t header[3] = {M.rowdim(), M.coldim(), M.size()};
+        sendHeader(header, 3, dest, false);
+        // straight from the storage of M
+        sendBuffer(M.refStart().data(), (header[0] + 1) * sizeof(index_t), dest, 0);
+        sendBuffer(M.refColid().data(), header[2] * sizeof(index_t), dest, 0);
+        sendElements(M.refData().data(), header[2], dest, 0);
+    }
+
+    template <class Field> void Communicator::ssend(const SparseMatrix<Field, SparseMatrixFormat::CSR>& M, int dest)
+    {
+        uint64_t header[3] = {M.rowdim(), M.coldim(), M.size()};
+        sendHeader(header, 3, dest, true);
+        // straight from the storage of M
+        sendBuffer(M.refStart().data(), (header[0] + 1) * sizeof(index_t), dest, 0);
+        sendBuffer(M.refColid().data(), header[2] * sizeof(index_t), dest, 0);
+        sendElements(M.refData().data(), header[2], dest, 0);
+    }
+
+    template <class Field> void Communicator::recv(SparseMatrix<Field, SparseMatrixFormat::CSR>& M, int src)
+    {
+        uint64_t header[3];
+        recvHeader(header, 3, src);
+        src = _status.MPI_SOURCE;
+
+        // straight into the storage of M
+        M.resize(header[0], header[1], header[2]);
+        recvBuffer(M.refStart().data(), (header[0] + 1) * sizeof(index_t), src, 0);
+        recvBuffer(M.refColid().data(), header[2] * sizeof(index_t), src, 0);
+        recvElements(M.refData().data(), header[2], src, 0);
+    }
+
+    template <class Field> void Communicator::bcast(SparseMatrix<Field, SparseMatrixFormat::CSR>& M, int src)
+    {
+        uint64_t header[3] = {M.rowdim(), M.coldim(), M.size()};
+        MPI_Bcast(header, 3, MPI_UINT64_T, src, _comm);
+
+        // from and into the storage of M
+        if (src != _rank) {
+            M.resize(header[0], header[1], header[2]);
+        }
+        bcastBuffer(M.refStart().data(), (header[0] + 1) * sizeof(index_t), src);
+        bcastBuffer(M.refColid().data(), header[2] * sizeof(index_t), src);
+        bcastElements(M.refData().data(), header[2], src);
+    }
+
+    // nonblocking helpers
+
+    inline void Communicator::probe(int src, int tag)
+    {
+        MPI_Probe(src, tag, _comm, &_status);
+    }
+
+    inline bool Communicator::iprobe(int src, int tag)
+    {
+        int flag = 0;
+        MPI_Iprobe(src, tag, _comm, &flag, &_status);
+        return flag != 0;
+    }
+
+    inline void Communicator::cleanup()
+    {
+        for (auto it = _pending.begin(); it != _pending.end();) {
+            int done = 0;
+            MPI_Test(&it->first, &done, MPI_STATUS_IGNORE);
+            it = done ? _pending.erase(it) : std::next(it);
+        }
+    }
+
+    inline void Communicator::waitall()
+    {
+        for (auto& pending : _pending) {
+            MPI_Wait(&pending.first, MPI_STATUS_IGNORE);
+        }
+        _pending.clear();
+    }
 }
 
 // Local Variables:
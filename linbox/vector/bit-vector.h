@@ -29,9 +29,13 @@
 
 #include <linbox/linbox-config.h>
 #include "linbox/vector/vector.h"
+#include <algorithm>
 #include <iterator>
 #include <vector>
 #include <stdexcept>
+#if defined(__LINBOX_HAVE_AVX2_INSTRUCTIONS)
+#include <immintrin.h>
+#endif
 
 namespace LinBox
 {
@@ -72,6 +76,170 @@ namespace LinBox
 #else
 #pragma message "error SIZEOF_LONG not defined !"
 #endif
+
+#ifdef __GNUC__
+#undef __LINBOX_PARITY
+#define __LINBOX_PARITY(s) bool(__builtin_parityl(s))
+#endif
+
+	/// Mask of the bits of the last word of a bit vector of size n
+	inline unsigned long BitTailMask (size_t n)
+	{
+		const size_t r = n & __LINBOX_POS_ALL_ONES;
+		return r ? (1UL << r) - 1UL : __LINBOX_ALL_ONES;
+	}
+
+	/** Word kernels on the storage of bit vectors.
+	 *
+	 * The loops run on raw words; the XOR and AND/parity ones process
+	 * four words per AVX2 instruction when available and are otherwise
+	 * left to the compiler's vectoriser. Functions taking a \p tail mask
+	 * ignore the bits of the last word outside of it.
+	 */
+	namespace BitWords
+	{
+		/// x[i] ^= y[i], i < n
+		inline void xorin (unsigned long *x, const unsigned long *y, size_t n)
+		{
+			size_t i = 0;
+#if defined(__LINBOX_HAVE_AVX2_INSTRUCTIONS) && (__LINBOX_SIZEOF_LONG == 8)
+			for (; i + 4 <= n; i += 4) {
+				const __m256i a = _mm256_loadu_si256 ((const __m256i *) (x + i));
+				const __m256i b = _mm256_loadu_si256 ((const __m256i *) (y + i));
+				_mm256_storeu_si256 ((__m256i *) (x + i), _mm256_xor_si256 (a, b));
+			}
+#endif
+			for (; i < n; ++i)
+				x[i] ^= y[i];
+		}
+
+		/// z[i] = x[i] ^ y[i], i < n
+		inline void xor3 (unsigned long *z, const unsigned long *x, const unsigned long *y, size_t n)
+		{
+			size_t i = 0;
+#if defined(__LINBOX_HAVE_AVX2_INSTRUCTIONS) && (__LINBOX_SIZEOF_LONG == 8)
+			for (; i + 4 <= n; i += 4) {
+				const __m256i a = _mm256_loadu_si256 ((const __m256i *) (x + i));
+				const __m256i b = _mm256_loadu_si256 ((const __m256i *) (y + i));
+				_mm256_storeu_si256 ((__m256i *) (z + i), _mm256_xor_si256 (a, b));
+			}
+#endif
+			for (; i < n; ++i)
+				z[i] = x[i] ^ y[i];
+		}
+
+		/// Parity of the popcount of the x[i] & y[i], i < n
+		inline bool dotParity (const unsigned long *x, const unsigned long *y, size_t n, unsigned long tail)
+		{
+			if (n == 0)
+				return false;
+
+			unsigned long t = 0;
+			size_t i = 0;
+#if defined(__LINBOX_HAVE_AVX2_INSTRUCTIONS) && (__LINBOX_SIZEOF_LONG == 8)
+			__m256i acc = _mm256_setzero_si256 ();
+			for (; i + 5 <= n; i += 4) {
+				const __m256i a = _mm256_loadu_si256 ((const __m256i *) (x + i));
+				const __m256i b = _mm256_loadu_si256 ((const __m256i *) (y + i));
+				acc = _mm256_xor_si256 (acc, _mm256_and_si256 (a, b));
+			}
+			t = (unsigned long) (_mm256_extract_epi64 (acc, 0) ^ _mm256_extract_epi64 (acc, 1)
+					     ^ _mm256_extract_epi64 (acc, 2) ^ _mm256_extract_epi64 (acc, 3));
+#endif
+			for (; i + 1 < n; ++i)
+				t ^= x[i] & y[i];
+			t ^= x[n - 1] & y[n - 1] & tail;
+
+			return __LINBOX_PARITY (t);
+		}
+
+		inline bool isZero (const unsigned long *x, size_t n, unsigned long tail)
+		{
+			if (n == 0)
+				return true;
+
+			unsigned long t = x[n - 1] & tail;
+			for (size_t i = 0; i + 1 < n; ++i)
+				t |= x[i];
+			return t == 0;
+		}
+
+		inline bool areEqual (const unsigned long *x, const unsigned long *y, size_t n, unsigned long tail)
+		{
+			if (n == 0)
+				return true;
+
+			for (size_t i = 0; i + 1 < n; ++i)
+				if (x[i] != y[i])
+					return false;
+			return ((x[n - 1] ^ y[n - 1]) & tail) == 0;
+		}
+
+		/// Words of a dense 0-1 vector, NULL if empty
+		template <class Vector>
+		inline const unsigned long *data (const Vector &v)
+		{
+			return (v.wordBegin () == v.wordEnd ()) ? (const unsigned long *) 0 : &*v.wordBegin ();
+		}
+
+		template <class Vector>
+		inline unsigned long *data (Vector &v)
+		{
+			return (v.wordBegin () == v.wordEnd ()) ? (unsigned long *) 0 : &*v.wordBegin ();
+		}
+
+		/// Index of the lowest set bit of a nonzero word
+		inline size_t lowestBit (unsigned long t)
+		{
+#ifdef __GNUC__
+			return size_t (__builtin_ctzl (t));
+#else
+			size_t c = 0;
+			for (; !(t & 1UL); t >>= 1)
+				++c;
+			return c;
+#endif
+		}
+
+		/// Bit j of x
+		inline bool bit (const unsigned long *x, size_t j)
+		{
+			return (x[j >> __LINBOX_LOGOF_SIZE] >> (j & __LINBOX_POS_ALL_ONES)) & 1UL;
+		}
+
+		/// Flips bit j of x
+		inline void flip (unsigned long *x, size_t j)
+		{
+			x[j >> __LINBOX_LOGOF_SIZE] ^= 1UL << (j & __LINBOX_POS_ALL_ONES);
+		}
+
+		/// The len bits of x starting at bit j, len <= bits of a word
+		inline unsigned long bits (const unsigned long *x, size_t j, size_t len)
+		{
+			const size_t w = j >> __LINBOX_LOGOF_SIZE, o = j & __LINBOX_POS_ALL_ONES;
+			unsigned long v = x[w] >> o;
+			if (o != 0 && o + len > __LINBOX_BITSOF_LONG)
+				v |= x[w + 1] << (__LINBOX_BITSOF_LONG - o);
+			return (len < __LINBOX_BITSOF_LONG) ? v & ((1UL << len) - 1UL) : v;
+		}
+
+		/// Bits [j, j + len) of y <- bits [0, len) of x
+		inline void copyBits (unsigned long *y, size_t j, const unsigned long *x, size_t len)
+		{
+			for (size_t k = 0; k < len; k += __LINBOX_BITSOF_LONG) {
+				const size_t l = std::min<size_t> (__LINBOX_BITSOF_LONG, len - k);
+				const unsigned long v = bits (x, k, l);
+				const unsigned long m = (l < __LINBOX_BITSOF_LONG) ? (1UL << l) - 1UL : __LINBOX_ALL_ONES;
+
+				const size_t p = j + k, w = p >> __LINBOX_LOGOF_SIZE, o = p & __LINBOX_POS_ALL_ONES;
+				y[w] = (y[w] & ~(m << o)) | (v << o);
+				if (o != 0 && o + l > __LINBOX_BITSOF_LONG) {
+					const size_t s = __LINBOX_BITSOF_LONG - o;
+					y[w + 1] = (y[w + 1] & ~(m >> s)) | (v >> s);
+				}
+			}
+		}
+	}
  
 	/** A vector of boolean 0-1 values, stored compactly to save space.
 	 *
@@ -98,9 +266,7 @@ namespace LinBox
 		BitVector (std::vector<unsigned long> &v) :
 		       	_v (v), _size (_v.size () * __LINBOX_BITSOF_LONG) {}
 		BitVector (size_t n, bool val = false)
-		{ resize (n, val);
-	std::cerr << "bV: " << _size << ", _v: " << _v.size() << std::endl;
-		}
+		{ resize (n, val); }
 
                 
 		template <class F2Field> BitVector (const F2Field&, std::vector<bool> &v)
@@ -578,31 +578,15 @@ namespace LinBox
 	template<class Container>
 	inline BitVector &BitVector::operator = (const Container &v)
 	{
-		typename Container::const_iterator i;
-		typename Container::const_iterator i_end = v.begin () + (v.size () >> __LINBOX_LOGOF_SIZE);
-		std::vector<unsigned long>::iterator j;
-		unsigned long idx;
-
-		_v.resize ((v.size () >> __LINBOX_LOGOF_SIZE) + ((v.size () & __LINBOX_POS_ALL_ONES) ? 1UL : 0UL));
-
-		for (j = _v.begin (); i != i_end; ++j) {
-			*j = 0UL;
-			for (idx = 0UL; idx < __LINBOX_BITSOF_LONG; ++idx, ++i) {
-				*j <<= 1UL;
-				*j |= *i & 1UL;
-			}
-		}
-
-		if (v.size () & __LINBOX_POS_ALL_ONES) {
-			*j = 0UL;
-
-			for (idx = 0UL; idx < (v.size () & __LINBOX_POS_ALL_ONES); ++idx) {
-				*j <<= 1UL;
-				*j |= *i & 1UL;
-			}
-		}
+		typename Container::const_iterator i = v.begin ();
 
 		_size = v.size ();
+		_v.assign ((_size >> __LINBOX_LOGOF_SIZE) + ((_size & __LINBOX_POS_ALL_ONES) ? 1UL : 0UL), 0UL);
+
+		// entry k is bit k % BITSOF_LONG of word k / BITSOF_LONG
+		for (size_t k = 0; k < _size; ++k, ++i)
+			if (*i)
+				_v[k >> __LINBOX_LOGOF_SIZE] |= 1UL << (k & __LINBOX_POS_ALL_ONES);
 
 		return *this;
 	}
@@ -617,21 +601,9 @@ namespace LinBox
 
 	inline bool BitVector::operator == (const BitVector &v) const
 	{
-		const_word_iterator i, j;
-		unsigned long mask;
-
 		if (_size != v._size) return false;
 
-		for (i = wordBegin (), j = v.wordBegin (); i != wordEnd () - 1UL; ++i, ++j)
-			if (*i != *j) return false;
-
-		mask = (1UL << (_size & (8 * sizeof (unsigned long) - 1UL))) - 1UL;
-		if (mask == 0UL) mask = (unsigned long) -1UL;
-
-		if ((*i & mask) == (*j & mask))
-			return true;
-		else
-			return false;
+		return BitWords::areEqual (_v.data (), v._v.data (), _v.size (), BitTailMask (_size));
 	}
 
 #if 0
@@ -319,7 +319,22 @@ namespace LinBox
 		template <class Vector1, class Vector2>
 		inline Vector1 &copySpecialized (Vector1 &res, const Vector2 &v, size_t i, size_t len, VectorCategories::DenseZeroOneVectorTag) const
 		{
-			std::copy (v.begin (), (len == 0) ? v.end () : v.begin () + len, res.begin () + i);
+			return copyRangeSpecialized (res, v, i, (len == 0) ? v.size () : len,
+						     typename VectorTraits<Vector2>::VectorCategory ());
+		}
+
+		template <class Vector1, class Vector2>
+		inline Vector1 &copyRangeSpecialized (Vector1 &res, const Vector2 &v, size_t i, size_t len, VectorCategories::DenseZeroOneVectorTag) const
+		{
+			if (len != 0)
+				BitWords::copyBits (BitWords::data (res), i, BitWords::data (v), len);
+			return res;
+		}
+
+		template <class Vector1, class Vector2>
+		inline Vector1 &copyRangeSpecialized (Vector1 &res, const Vector2 &v, size_t i, size_t len, VectorCategories::DenseVectorTag) const
+		{
+			std::copy (v.begin (), v.begin () + len, res.begin () + i);
 			return res;
 		}
 
@@ -417,6 +432,7 @@ namespace LinBox
 		{
 			copy (res, y);
 			addin (res, x);
+			return res;
 		}
 
 		template <class Vector1, class Vector2, class Vector3>
@@ -147,24 +147,21 @@ namespace LinBox
 						     VectorCategories::DenseZeroOneVectorTag,
 						     VectorCategories::SparseZeroOneVectorTag) const
 	{
-		typename Vector1::const_iterator i = v1.begin ();
+		const unsigned long *x = BitWords::data (v1);
+		const size_t n = size_t (v1.wordEnd () - v1.wordBegin ());
 		typename Vector2::const_iterator j = v2.begin ();
-		size_t idx = 0;
 
-		for (; j != v2.end (); ++j, ++i, ++idx) {
-			while (idx < *j) {
-				if (*i) return false;
-				++idx;
-				++i;
-			}
+		// Compare each word with the word spanned by the sparse entries
+		for (size_t w = 0; w < n; ++w) {
+			unsigned long e = 0UL;
+			for (; j != v2.end () && (*j >> __LINBOX_LOGOF_SIZE) == w; ++j)
+				e |= 1UL << (*j & __LINBOX_POS_ALL_ONES);
 
-			if (!*i) return false;
+			const unsigned long mask = (w + 1 == n) ? BitTailMask (v1.size ()) : __LINBOX_ALL_ONES;
+			if ((x[w] & mask) != e) return false;
 		}
 
-		for (; i != v1.end (); ++i)
-			if (*i) return false;
-
-		return true;
+		return j == v2.end ();
 	}
 
 	template <class Vector1, class Vector2>
@@ -172,11 +169,10 @@ namespace LinBox
 						     VectorCategories::DenseZeroOneVectorTag,
 						     VectorCategories::DenseZeroOneVectorTag) const
 	{
-		typename Vector1::const_word_iterator i = v1.wordBegin ();
-		typename Vector2::const_word_iterator j = v2.wordBegin ();
-		for (; j != v2.wordEnd (); ++j, ++i)
-			if (*i != *j) return false;
-		return true;
+		if (v1.size () != v2.size ()) return false;
+
+		return BitWords::areEqual (BitWords::data (v1), BitWords::data (v2),
+					   size_t (v1.wordEnd () - v1.wordBegin ()), BitTailMask (v1.size ()));
 	}
 
 	template <class Vector1, class Vector2>
@@ -191,12 +187,7 @@ namespace LinBox
 	bool VectorDomain<GF2>::isZeroSpecialized (const Vector &v,
 						   VectorCategories::DenseZeroOneVectorTag) const
 	{
-		typename Vector::const_word_iterator i;
-
-		for (i = v.wordBegin (); i != v.wordEnd (); ++i)
-			if (*i) return false;
-
-		return true;
+		return BitWords::isZero (BitWords::data (v), size_t (v.wordEnd () - v.wordBegin ()), BitTailMask (v.size ()));
 	}
 
 	template <class Vector1, class Vector2>
@@ -204,13 +195,17 @@ namespace LinBox
 						     VectorCategories::SparseZeroOneVectorTag,
 						     VectorCategories::DenseZeroOneVectorTag) const
 	{
-		typename Vector2::const_iterator i;
-		size_t idx = 0;
+		const unsigned long *x = BitWords::data (v);
+		const size_t n = size_t (v.wordEnd () - v.wordBegin ());
 
 		res.clear ();
 
-		for (i = v.begin (); i != v.end (); ++i, ++idx)
-			if (*i) res.push_back (idx);
+		for (size_t w = 0; w < n; ++w) {
+			unsigned long t = (w + 1 == n) ? x[w] & BitTailMask (v.size ()) : x[w];
+
+			for (; t != 0UL; t &= t - 1UL)
+				res.push_back ((w << __LINBOX_LOGOF_SIZE) + BitWords::lowestBit (t));
+		}
 
 		return res;
 	}
@@ -220,14 +215,14 @@ namespace LinBox
 						     VectorCategories::DenseZeroOneVectorTag,
 						     VectorCategories::SparseZeroOneVectorTag) const
 	{
-		size_t sparsesize = *(v.rbegin());
-		if (sparsesize > res.size()) res.resize( *(v.rbegin()) );
-		std::fill (res.wordBegin (), res.wordEnd (), 0);
-
-		for (typename Vector2::const_iterator i = v.begin ();
-		     i != v.end ();
-		     ++i)
-			res[*i] = true;
+		if (!v.empty () && *(v.rbegin ()) >= res.size ())
+			res.resize (*(v.rbegin ()) + 1);
+		std::fill (res.wordBegin (), res.wordEnd (), 0UL);
+
+		unsigned long *y = BitWords::data (res);
+		for (typename Vector2::const_iterator i = v.begin (); i != v.end (); ++i)
+			y[*i >> __LINBOX_LOGOF_SIZE] |= 1UL << (*i & __LINBOX_POS_ALL_ONES);
+
 		return res;
 	}
 
@@ -258,12 +253,8 @@ namespace LinBox
 		linbox_check (res.size () == y.size ());
 		linbox_check (res.size () == x.size ());
 
-		typename Vector1::word_iterator i = res.wordBegin ();
-		typename Vector2::const_word_iterator j = y.wordBegin ();
-		typename Vector3::const_word_iterator k = x.wordBegin ();
-
-		for (; i != res.wordEnd (); ++i)
-			*i = *j++ ^ *k++;
+		BitWords::xor3 (BitWords::data (res), BitWords::data (y), BitWords::data (x),
+				size_t (res.wordEnd () - res.wordBegin ()));
 
 		return res;
 	}
@@ -295,11 +286,7 @@ namespace LinBox
 	{
 		linbox_check (y.size () == x.size ());
 
-		typename Vector1::word_iterator i = y.wordBegin ();
-		typename Vector2::const_word_iterator j = x.wordBegin ();
-
-		for (; i != y.wordEnd (); ++i, ++j)
-			*i ^= *j;
+		BitWords::xorin (BitWords::data (y), BitWords::data (x), size_t (y.wordEnd () - y.wordBegin ()));
 
 		return y;
 	}
@@ -309,10 +296,10 @@ namespace LinBox
 						      VectorCategories::DenseZeroOneVectorTag,
 						      VectorCategories::SparseZeroOneVectorTag) const
 	{
-		typename Vector2::const_iterator i;
+		unsigned long *w = BitWords::data (y);
 
-		for (i = x.begin (); i != x.end (); ++i)
-			y[*i] = !y[*i];
+		for (typename Vector2::const_iterator i = x.begin (); i != x.end (); ++i)
+			BitWords::flip (w, *i);
 
 		return y;
 	}
@@ -330,20 +317,8 @@ namespace LinBox
 	{
 		linbox_check (v1.size () == v2.size ());
 
-		unsigned long t = 0;
-		typename Vector1::const_word_iterator i = v1.wordBegin ();
-		typename Vector2::const_word_iterator j = v2.wordBegin ();
-
-		while (i != v1.wordEnd () - 1)
-			t ^= *i++ & *j++;
-
-		const size_t zeroing = __LINBOX_BITSOF_LONG - (v1.size() % __LINBOX_BITSOF_LONG);
-		unsigned long lastdot = *i & *j;
-		lastdot <<= zeroing;
-		lastdot >>= zeroing;
-
-		t ^= lastdot;
-		return res = __LINBOX_PARITY(t);
+		return res = BitWords::dotParity (BitWords::data (v1), BitWords::data (v2),
+						  size_t (v1.wordEnd () - v1.wordBegin ()), BitTailMask (v1.size ()));
 	}
 
 	// template<>
@@ -353,14 +328,14 @@ namespace LinBox
 	 const Vector1 &v1,
 	 const Vector2 &v2) const
 	{
-		typename Vector2::const_iterator i;
-
-		res = 0;
+		// Gather the words: the parity accumulates in the low bit
+		const unsigned long *x = BitWords::data (v1);
+		unsigned long t = 0UL;
 
-		for (i = v2.begin (); i != v2.end (); ++i)
-			res ^= v1[*i];
+		for (typename Vector2::const_iterator i = v2.begin (); i != v2.end (); ++i)
+			t ^= x[*i >> __LINBOX_LOGOF_SIZE] >> (*i & __LINBOX_POS_ALL_ONES);
 
-		return res;
+		return res = bool (t & 1UL);
 	}
 
 	// template<>
@@ -381,14 +356,8 @@ namespace LinBox
 	 const Vector1 &v1,
 	 const Vector2 &v2) const
 	{
-		typename Vector2::const_iterator i;
-
-		res = 0;
-
-		for (i = v2.begin (); i != v2.end (); ++i)
-			res ^= v1[*i];
-
-		return res;
+		bool tmp;
+		return res = dotSpecializedDSP(tmp, v1, v2);
 	}
 
 }